@@ -0,0 +1,161 @@
+/*
+ * BlockEnvelope.h
+ *
+ * Block-rate linear ADSR bank for polyphonic voice pools
+ *
+ * - Envelope state is stored as structure-of-arrays (one lane per voice)
+ * - render() solves how many samples remain in the current segment
+ *   analytically and fills the gain ramp segment-by-segment, so the inner
+ *   loops are branch-free and auto-vectorize
+ * - Per-sample semantics match stepping level += rate once per sample
+ * - render() works one voice at a time on purpose: the caller multiplies
+ *   each voice's ramp into its own scratch right away, only active voices
+ *   are rendered, and the segment fills vectorize along time. A lane-major
+ *   loop (all voices per sample) needs per-sample transition checks and a
+ *   transpose, and measured several times slower at 8-32 voices
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+namespace DSP {
+
+template <int NumVoices>
+class BlockEnvelopeBank
+{
+public:
+    enum class Phase : uint8_t { Idle, Attack, Decay, Sustain, Release };
+
+    void reset()
+    {
+        level_.fill(0.0f);
+        phase_.fill(Phase::Idle);
+    }
+
+    /** Per-sample rates; sustainLevel is an absolute gain (0-1) */
+    void setRates(int voice, float attackRate, float decayRate,
+                  float sustainLevel, float releaseRate)
+    {
+        attackRate_[voice] = attackRate;
+        decayRate_[voice] = decayRate;
+        sustainLevel_[voice] = sustainLevel;
+        releaseRate_[voice] = releaseRate;
+    }
+
+    void noteOn(int voice)
+    {
+        level_[voice] = 0.0f;
+        phase_[voice] = Phase::Attack;
+    }
+
+    void noteOff(int voice)
+    {
+        if (phase_[voice] != Phase::Idle) {
+            phase_[voice] = Phase::Release;
+        }
+    }
+
+    void kill(int voice)
+    {
+        level_[voice] = 0.0f;
+        phase_[voice] = Phase::Idle;
+    }
+
+    Phase getPhase(int voice) const { return phase_[voice]; }
+    float getLevel(int voice) const { return level_[voice]; }
+    bool isIdle(int voice) const { return phase_[voice] == Phase::Idle; }
+
+    /**
+     * @brief Write the voice's per-sample gain into gain[0..numSamples) and
+     *        advance its state to the end of the block
+     */
+    void render(int voice, float* gain, int numSamples)
+    {
+        float level = level_[voice];
+        Phase phase = phase_[voice];
+        int position = 0;
+
+        while (position < numSamples) {
+            const int remaining = numSamples - position;
+
+            switch (phase) {
+                case Phase::Attack:
+                    position += rampTowards(gain + position, remaining, level,
+                                            attackRate_[voice], 1.0f, phase, Phase::Decay);
+                    break;
+
+                case Phase::Decay:
+                    position += rampTowards(gain + position, remaining, level,
+                                            -decayRate_[voice], sustainLevel_[voice],
+                                            phase, Phase::Sustain);
+                    break;
+
+                case Phase::Release:
+                    position += rampTowards(gain + position, remaining, level,
+                                            -releaseRate_[voice], 0.0f, phase, Phase::Idle);
+                    break;
+
+                case Phase::Sustain:
+                case Phase::Idle:
+                    std::fill(gain + position, gain + numSamples, level);
+                    position = numSamples;
+                    break;
+            }
+        }
+
+        level_[voice] = level;
+        phase_[voice] = phase;
+    }
+
+private:
+    /**
+     * Fill up to maxSamples of a linear segment from level towards target.
+     * Returns the number of samples written; on reaching the target the
+     * level is snapped to it and the phase advances to nextPhase.
+     */
+    static int rampTowards(float* gain, int maxSamples, float& level, float step,
+                           float target, Phase& phase, Phase nextPhase)
+    {
+        const float distance = target - level;
+
+        // A zero rate never reaches the target: hold the current level.
+        // A level already at or past the target snaps to it on the next sample.
+        int segmentLength = maxSamples;
+        if (step != 0.0f) {
+            segmentLength = (distance * step > 0.0f)
+                ? std::max(1, static_cast<int>(std::ceil(distance / step)))
+                : 1;
+        }
+
+        const int count = std::min(segmentLength, maxSamples);
+        const float start = level;
+        for (int i = 0; i < count; ++i) {
+            gain[i] = start + step * static_cast<float>(i + 1);
+        }
+
+        if (count == segmentLength && step != 0.0f) {
+            gain[count - 1] = target;
+            level = target;
+            phase = nextPhase;
+        } else {
+            level = start + step * static_cast<float>(count);
+        }
+
+        return count;
+    }
+
+    alignas(32) std::array<float, NumVoices> level_{};
+    alignas(32) std::array<float, NumVoices> attackRate_{};
+    alignas(32) std::array<float, NumVoices> decayRate_{};
+    alignas(32) std::array<float, NumVoices> sustainLevel_{};
+    alignas(32) std::array<float, NumVoices> releaseRate_{};
+    std::array<Phase, NumVoices> phase_{};
+};
+
+} // namespace DSP
@@ -0,0 +1,187 @@
+/*
+ * DelayLine.h
+ *
+ * Fractional delay line for waveguide strings
+ *
+ * - Power-of-two capacity: every wrap is a mask, never a modulo
+ * - The first GUARD samples are mirrored past the end of the buffer, so
+ *   the four Lagrange taps are always contiguous and never wrap
+ * - 4-point (third-order) Lagrange weights are cached in setDelay() and
+ *   only recomputed when the delay changes; integer delays read one tap
+ * - Block read/write for feedback loops: read up to getMaxBlockLength()
+ *   samples, process them, write them back; the read kernel is a straight
+ *   4-tap FIR over contiguous memory
+ *
+ * Convention: read() before write() for the same sample returns the input
+ * from `delay` samples ago.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+namespace DSP {
+
+class DelayLine
+{
+public:
+    static constexpr int GUARD = 4;
+    static constexpr float MIN_DELAY = 2.0f;  // Newest Lagrange tap is one sample back
+
+    /** @brief Allocate for delays up to maximumDelay samples (the only allocation) */
+    void prepare(int maximumDelay)
+    {
+        maxDelay_ = std::max(maximumDelay, static_cast<int>(MIN_DELAY) + 1);
+
+        int capacity = 1;
+        while (capacity < maxDelay_ + GUARD) {
+            capacity <<= 1;
+        }
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        buffer_.assign(static_cast<size_t>(capacity_ + GUARD), 0.0f);
+        writeIndex_ = 0;
+
+        const float delay = delay_;
+        delay_ = -1.0f;
+        setDelay(delay);
+    }
+
+    void reset()
+    {
+        std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+        writeIndex_ = 0;
+    }
+
+    int getMaximumDelay() const { return maxDelay_; }
+    float getDelay() const { return delay_; }
+
+    /** Clamped to [MIN_DELAY, getMaximumDelay()]; weights recomputed only on change */
+    void setDelay(float delayInSamples)
+    {
+        const float delay = std::clamp(delayInSamples, MIN_DELAY, static_cast<float>(maxDelay_));
+        if (delay == delay_) {
+            return;
+        }
+        delay_ = delay;
+        integerDelay_ = static_cast<int>(delay);
+
+        const float f = delay - static_cast<float>(integerDelay_);
+        fractional_ = f > 0.0f;
+
+        // Taps at delays i+2, i+1, i, i-1 (ascending buffer order)
+        weights_[0] = (f + 1.0f) * f * (f - 1.0f) * (1.0f / 6.0f);
+        weights_[1] = -(f + 1.0f) * f * (f - 2.0f) * 0.5f;
+        weights_[2] = (f + 1.0f) * (f - 1.0f) * (f - 2.0f) * 0.5f;
+        weights_[3] = -f * (f - 1.0f) * (f - 2.0f) * (1.0f / 6.0f);
+    }
+
+    float read() const
+    {
+        if (!fractional_) {
+            return buffer_[static_cast<size_t>((writeIndex_ - integerDelay_) & mask_)];
+        }
+        const float* taps = buffer_.data() + ((writeIndex_ - integerDelay_ - 2) & mask_);
+        return weights_[0] * taps[0] + weights_[1] * taps[1] + weights_[2] * taps[2] + weights_[3] * taps[3];
+    }
+
+    void write(float sample)
+    {
+        buffer_[static_cast<size_t>(writeIndex_)] = sample;
+        if (writeIndex_ < GUARD) {
+            buffer_[static_cast<size_t>(capacity_ + writeIndex_)] = sample;
+        }
+        writeIndex_ = (writeIndex_ + 1) & mask_;
+    }
+
+    /** Add to the most recently written sample (reflection injection) */
+    void addToNewest(float value)
+    {
+        const int index = (writeIndex_ - 1) & mask_;
+        buffer_[static_cast<size_t>(index)] += value;
+        if (index < GUARD) {
+            buffer_[static_cast<size_t>(capacity_ + index)] += value;
+        }
+    }
+
+    /** Longest block read() can produce before any of it has been written back */
+    int getMaxBlockLength() const { return integerDelay_ - 1; }
+
+    /** @brief Read numSamples (<= getMaxBlockLength()) consecutive outputs */
+    void read(float* output, int numSamples) const
+    {
+        const float w0 = weights_[0], w1 = weights_[1], w2 = weights_[2], w3 = weights_[3];
+        int position = fractional_ ? ((writeIndex_ - integerDelay_ - 2) & mask_)
+                                   : ((writeIndex_ - integerDelay_) & mask_);
+        int done = 0;
+
+        while (done < numSamples) {
+            // Up to the end of the buffer; the guard covers the last taps
+            const int length = std::min(numSamples - done, capacity_ - position);
+            const float* taps = buffer_.data() + position;
+            float* out = output + done;
+
+            if (fractional_) {
+                for (int i = 0; i < length; ++i) {
+                    out[i] = w0 * taps[i] + w1 * taps[i + 1] + w2 * taps[i + 2] + w3 * taps[i + 3];
+                }
+            } else {
+                std::memcpy(out, taps, sizeof(float) * static_cast<size_t>(length));
+            }
+
+            done += length;
+            position = (position + length) & mask_;
+        }
+    }
+
+    /** @brief Write numSamples consecutive inputs */
+    void write(const float* input, int numSamples)
+    {
+        int done = 0;
+        bool touchedHead = writeIndex_ < GUARD;
+
+        while (done < numSamples) {
+            const int length = std::min(numSamples - done, capacity_ - writeIndex_);
+            std::memcpy(buffer_.data() + writeIndex_, input + done, sizeof(float) * static_cast<size_t>(length));
+            done += length;
+            writeIndex_ = (writeIndex_ + length) & mask_;
+            touchedHead = touchedHead || writeIndex_ == 0;
+        }
+
+        if (touchedHead) {
+            std::copy(buffer_.begin(), buffer_.begin() + GUARD, buffer_.begin() + capacity_);
+        }
+    }
+
+    /** @brief Overwrite the whole buffer with source looped (string excitation) */
+    void fill(const float* source, int sourceLength, float gain)
+    {
+        if (sourceLength <= 0) {
+            reset();
+            return;
+        }
+        for (int i = 0; i < capacity_; ++i) {
+            buffer_[static_cast<size_t>(i)] = source[i % sourceLength] * gain;
+        }
+        std::copy(buffer_.begin(), buffer_.begin() + GUARD, buffer_.begin() + capacity_);
+        writeIndex_ = 0;
+    }
+
+private:
+    std::vector<float> buffer_;  // capacity_ + GUARD (head mirrored at the end)
+    int capacity_ = 0;
+    int mask_ = 0;
+    int writeIndex_ = 0;
+    int maxDelay_ = 0;
+
+    float delay_ = MIN_DELAY;
+    int integerDelay_ = static_cast<int>(MIN_DELAY);
+    bool fractional_ = false;
+    float weights_[4] = { 0.0f, 0.0f, 1.0f, 0.0f };
+};
+
+} // namespace DSP
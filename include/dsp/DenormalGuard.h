@@ -0,0 +1,122 @@
+/*
+ * DenormalGuard.h
+ *
+ * Denormal (subnormal) protection for the audio thread
+ *
+ * Feedback state that decays towards zero (filter integrators, waveguide
+ * loops, modal energies, reverb lines) eventually reaches the subnormal
+ * range below ~1.2e-38, where x86 pays tens to hundreds of cycles per
+ * operation. Release tails are where this shows up as CPU spikes.
+ *
+ * - ScopedFlushDenormals: RAII guard that turns on flush-to-zero (and
+ *   denormals-are-zero on x86) for the calling thread and restores the
+ *   previous mode on exit. Every engine process() and every render pool
+ *   worker holds one. x86 uses MXCSR FTZ|DAZ, AArch64 FPCR.FZ, 32-bit ARM
+ *   FPSCR.FZ; elsewhere it is a no-op and FLUSHES is false
+ * - flushDenormal(): for feedback paths, zeroes state below
+ *   DENORMAL_THRESHOLD where the guard cannot flush, and compiles to
+ *   nothing where it can. It is a compare rather than the classic
+ *   add-and-subtract of a tiny offset so -ffast-math cannot fold it away
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define NATURE_DENORMAL_GUARD_X86 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define NATURE_DENORMAL_GUARD_AARCH64 1
+#elif defined(__arm__) && defined(__ARM_FP) && (defined(__GNUC__) || defined(__clang__))
+    #define NATURE_DENORMAL_GUARD_ARM32 1
+#endif
+
+namespace DSP {
+
+// -400 dB: far below anything audible, far above the subnormal range
+static constexpr float DENORMAL_THRESHOLD = 1.0e-20f;
+
+class ScopedFlushDenormals
+{
+public:
+#if defined(NATURE_DENORMAL_GUARD_X86) || defined(NATURE_DENORMAL_GUARD_AARCH64) \
+    || defined(NATURE_DENORMAL_GUARD_ARM32)
+    static constexpr bool FLUSHES = true;
+#else
+    static constexpr bool FLUSHES = false;
+#endif
+
+    ScopedFlushDenormals() noexcept
+        : saved_(readMode())
+    {
+        writeMode(saved_ | FLUSH_BITS);
+    }
+
+    ~ScopedFlushDenormals() noexcept { writeMode(saved_); }
+
+    ScopedFlushDenormals(const ScopedFlushDenormals&) = delete;
+    ScopedFlushDenormals& operator=(const ScopedFlushDenormals&) = delete;
+
+    /** @brief True if flush-to-zero is on for the calling thread */
+    static bool isActive() noexcept { return FLUSHES && (readMode() & FLUSH_BITS) == FLUSH_BITS; }
+
+private:
+#if defined(NATURE_DENORMAL_GUARD_X86)
+    using Mode = unsigned int;
+    static constexpr Mode FLUSH_BITS = 0x8040u;  // MXCSR FTZ (bit 15) | DAZ (bit 6)
+
+    static Mode readMode() noexcept { return _mm_getcsr(); }
+    static void writeMode(Mode mode) noexcept { _mm_setcsr(mode); }
+#elif defined(NATURE_DENORMAL_GUARD_AARCH64)
+    using Mode = uint64_t;
+    static constexpr Mode FLUSH_BITS = Mode{1} << 24;  // FPCR.FZ
+
+    static Mode readMode() noexcept
+    {
+        Mode mode;
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(mode));
+        return mode;
+    }
+    static void writeMode(Mode mode) noexcept { __asm__ __volatile__("msr fpcr, %0" : : "r"(mode)); }
+#elif defined(NATURE_DENORMAL_GUARD_ARM32)
+    using Mode = uint32_t;
+    static constexpr Mode FLUSH_BITS = Mode{1} << 24;  // FPSCR.FZ
+
+    static Mode readMode() noexcept
+    {
+        Mode mode;
+        __asm__ __volatile__("vmrs %0, fpscr" : "=r"(mode));
+        return mode;
+    }
+    static void writeMode(Mode mode) noexcept { __asm__ __volatile__("vmsr fpscr, %0" : : "r"(mode)); }
+#else
+    using Mode = uint32_t;
+    static constexpr Mode FLUSH_BITS = 0u;
+
+    static Mode readMode() noexcept { return 0u; }
+    static void writeMode(Mode) noexcept {}
+#endif
+
+    Mode saved_;
+};
+
+/**
+ * @brief Feedback-state flush for targets without hardware flush-to-zero
+ *
+ * Identity when ScopedFlushDenormals::FLUSHES (the engine's guard already
+ * covers it); otherwise values below DENORMAL_THRESHOLD become exactly 0.
+ */
+inline float flushDenormal(float x) noexcept
+{
+    if constexpr (ScopedFlushDenormals::FLUSHES) {
+        return x;
+    } else {
+        return std::fabs(x) < DENORMAL_THRESHOLD ? 0.0f : x;
+    }
+}
+
+} // namespace DSP
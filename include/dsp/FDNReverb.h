@@ -0,0 +1,310 @@
+/*
+ * FDNReverb.h
+ *
+ * 8-line feedback delay network reverb
+ *
+ * - All eight delay lines share one interleaved ring buffer (one frame of
+ *   8 floats per sample) sized to a power of two in prepare(), so indexing
+ *   is a mask and each write is a single 8-wide store
+ * - Householder feedback matrix (x - 2/N * sum(x)), damping and feedback
+ *   gain are evaluated 4-wide (SSE2 / NEON) with a scalar fallback
+ * - True stereo: left feeds the even lines, right the odd lines, and each
+ *   output taps its own set of lines
+ * - Optional half-rate mode runs the network at sampleRate / 2
+ * - The engine bypasses itself once input and tail stay below
+ *   SILENCE_THRESHOLD for longer than the longest delay
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "dsp/NatureKernels.h"
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace DSP {
+
+class FDNReverb
+{
+public:
+    static constexpr int NUM_LINES = 8;
+    static constexpr float SILENCE_THRESHOLD = 1.0e-5f;  // -100 dB
+
+    /**
+     * @brief Size the ring buffer for the largest room at this sample rate
+     *
+     * The only allocation; process() and setHalfRate() never allocate.
+     */
+    void prepare(double sampleRate)
+    {
+        sampleRate_ = sampleRate;
+
+        const double longest = BASE_DELAYS_SECONDS[NUM_LINES - 1] * MAX_SIZE_SCALE;
+        const int maxDelay = static_cast<int>(std::ceil(longest * sampleRate)) + 1;
+
+        int frames = 1;
+        while (frames < maxDelay) {
+            frames <<= 1;
+        }
+        mask_ = frames - 1;
+        buffer_.assign(static_cast<size_t>(frames) * NUM_LINES, 0.0f);
+
+        updateDelays();
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+        damping_.fill(0.0f);
+        writePos_ = 0;
+        pendingInL_ = pendingInR_ = 0.0f;
+        lastL_ = lastR_ = currentL_ = currentR_ = 0.0f;
+        oddSample_ = false;
+        silentSamples_ = 0;
+        idle_ = true;
+    }
+
+    /**
+     * @brief Run the network at half the sample rate (input averaged in
+     *        pairs, output linearly interpolated). Clears the tail.
+     */
+    void setHalfRate(bool enabled)
+    {
+        if (enabled != halfRate_) {
+            halfRate_ = enabled;
+            updateDelays();
+            reset();
+        }
+    }
+
+    bool isHalfRate() const { return halfRate_; }
+    bool isIdle() const { return idle_; }
+
+    /**
+     * @brief Mix reverb into outputL / outputR in place
+     *
+     * outputR may be null for mono; the left wet signal is used then.
+     */
+    void process(float* outputL, float* outputR, int numSamples,
+                 float mix, float roomSize, float damping)
+    {
+        process(outputL, outputR, numSamples, mix, mix, roomSize, damping);
+    }
+
+    /** @brief As above, with the wet/dry mix ramped linearly across the block */
+    void process(float* outputL, float* outputR, int numSamples,
+                 float mixStart, float mixEnd, float roomSize, float damping)
+    {
+        if (buffer_.empty() || numSamples <= 0) {
+            return;
+        }
+
+        if (mixStart <= 0.0f && mixEnd <= 0.0f) {
+            // Wet path inaudible: drop the tail rather than running it
+            if (!idle_) {
+                reset();
+            }
+            return;
+        }
+
+        // Idle and silent input: output stays dry (zero), nothing to do
+        float inputPeak = 0.0f;
+        for (int i = 0; i < numSamples; ++i) {
+            inputPeak = std::max(inputPeak, std::abs(outputL[i]));
+            if (outputR) {
+                inputPeak = std::max(inputPeak, std::abs(outputR[i]));
+            }
+        }
+        if (idle_ && inputPeak < SILENCE_THRESHOLD) {
+            return;
+        }
+        idle_ = false;
+
+        setRoom(roomSize, damping);
+
+        const float mixStep = (mixEnd - mixStart) / static_cast<float>(numSamples);
+        float tailPeak = 0.0f;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float mix = mixStart + mixStep * static_cast<float>(i + 1);
+            const float dry = 1.0f - mix;
+            const float inL = outputL[i];
+            const float inR = outputR ? outputR[i] : inL;
+            float wetL, wetR;
+
+            if (!halfRate_) {
+                tick(inL, inR, wetL, wetR);
+            } else if (!oddSample_) {
+                pendingInL_ = inL;
+                pendingInR_ = inR;
+                wetL = currentL_;
+                wetR = currentR_;
+                oddSample_ = true;
+            } else {
+                lastL_ = currentL_;
+                lastR_ = currentR_;
+                tick((pendingInL_ + inL) * 0.5f, (pendingInR_ + inR) * 0.5f, currentL_, currentR_);
+                wetL = (lastL_ + currentL_) * 0.5f;
+                wetR = (lastR_ + currentR_) * 0.5f;
+                oddSample_ = false;
+            }
+
+            tailPeak = std::max(tailPeak, std::max(std::abs(wetL), std::abs(wetR)));
+
+            outputL[i] = inL * dry + wetL * mix;
+            if (outputR) {
+                outputR[i] = inR * dry + wetR * mix;
+            }
+        }
+
+        // Bypass once everything still circulating is below threshold
+        if (inputPeak < SILENCE_THRESHOLD && tailPeak < SILENCE_THRESHOLD) {
+            silentSamples_ += numSamples;
+            if (silentSamples_ > longestDelaySamples()) {
+                idle_ = true;
+                silentSamples_ = 0;
+            }
+        } else {
+            silentSamples_ = 0;
+        }
+    }
+
+private:
+    static constexpr double MAX_SIZE_SCALE = 1.4;
+
+    // Mutually prime-ish base lengths (before room scaling)
+    static constexpr double BASE_DELAYS_SECONDS[NUM_LINES] = {
+        0.0297, 0.0371, 0.0411, 0.0437, 0.0531, 0.0593, 0.0671, 0.0733
+    };
+
+    void setRoom(float roomSize, float damping)
+    {
+        if (roomSize != roomSize_) {
+            roomSize_ = roomSize;
+            updateDelays();
+        }
+        feedback_ = 0.70f + 0.28f * roomSize;
+        dampingCoeff_ = damping * 0.5f;
+    }
+
+    void updateDelays()
+    {
+        const double rate = halfRate_ ? sampleRate_ * 0.5 : sampleRate_;
+        const double scale = 0.6 + 0.8 * static_cast<double>(roomSize_);
+        for (int j = 0; j < NUM_LINES; ++j) {
+            delays_[j] = std::clamp(static_cast<int>(BASE_DELAYS_SECONDS[j] * scale * rate),
+                                    1, mask_);
+        }
+    }
+
+    int longestDelaySamples() const
+    {
+        const int longest = delays_[NUM_LINES - 1];
+        return halfRate_ ? longest * 2 : longest;
+    }
+
+    /** One network step at the internal rate */
+    void tick(float inL, float inR, float& outL, float& outR)
+    {
+        alignas(16) float frame[NUM_LINES];
+        for (int j = 0; j < NUM_LINES; ++j) {
+            frame[j] = buffer_[static_cast<size_t>((writePos_ - delays_[j]) & mask_) * NUM_LINES + j];
+        }
+
+        outL = (frame[0] + frame[2] + frame[4] + frame[6]) * 0.25f;
+        outR = (frame[1] + frame[3] + frame[5] + frame[7]) * 0.25f;
+
+        float* dst = buffer_.data() + static_cast<size_t>(writePos_) * NUM_LINES;
+        const float inputGain = 0.5f;
+
+#if defined(NATURE_KERNELS_SSE2)
+        const __m128 vDamp = _mm_set1_ps(dampingCoeff_);
+        const __m128 vUndamp = _mm_set1_ps(1.0f - dampingCoeff_);
+        __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_load_ps(frame), vUndamp),
+                               _mm_mul_ps(_mm_load_ps(damping_.data()), vDamp));
+        __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_load_ps(frame + 4), vUndamp),
+                               _mm_mul_ps(_mm_load_ps(damping_.data() + 4), vDamp));
+        _mm_store_ps(damping_.data(), lo);
+        _mm_store_ps(damping_.data() + 4, hi);
+
+        // Householder: y = g * (x - 2/N * sum(x))
+        __m128 sum = _mm_add_ps(lo, hi);
+        sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(2, 3, 0, 1)));
+        const __m128 vReflect = _mm_mul_ps(sum, _mm_set1_ps(2.0f / NUM_LINES));
+        const __m128 vGain = _mm_set1_ps(feedback_);
+        const __m128 vInput = _mm_setr_ps(inL * inputGain, inR * inputGain,
+                                          inL * inputGain, inR * inputGain);
+        lo = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(lo, vReflect), vGain), vInput);
+        hi = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(hi, vReflect), vGain), vInput);
+        _mm_storeu_ps(dst, lo);
+        _mm_storeu_ps(dst + 4, hi);
+#elif defined(NATURE_KERNELS_NEON)
+        const float32x4_t vDamp = vdupq_n_f32(dampingCoeff_);
+        const float32x4_t vUndamp = vdupq_n_f32(1.0f - dampingCoeff_);
+        float32x4_t lo = vmlaq_f32(vmulq_f32(vld1q_f32(frame), vUndamp),
+                                   vld1q_f32(damping_.data()), vDamp);
+        float32x4_t hi = vmlaq_f32(vmulq_f32(vld1q_f32(frame + 4), vUndamp),
+                                   vld1q_f32(damping_.data() + 4), vDamp);
+        vst1q_f32(damping_.data(), lo);
+        vst1q_f32(damping_.data() + 4, hi);
+
+        // Householder: y = g * (x - 2/N * sum(x))
+        float32x4_t sum = vaddq_f32(lo, hi);
+        float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        pair = vpadd_f32(pair, pair);
+        const float32x4_t vReflect = vdupq_n_f32(vget_lane_f32(pair, 0) * (2.0f / NUM_LINES));
+        const float32x4_t vGain = vdupq_n_f32(feedback_);
+        const float inputs[4] = { inL * inputGain, inR * inputGain, inL * inputGain, inR * inputGain };
+        const float32x4_t vInput = vld1q_f32(inputs);
+        lo = vmlaq_f32(vInput, vsubq_f32(lo, vReflect), vGain);
+        hi = vmlaq_f32(vInput, vsubq_f32(hi, vReflect), vGain);
+        vst1q_f32(dst, lo);
+        vst1q_f32(dst + 4, hi);
+#else
+        float sum = 0.0f;
+        for (int j = 0; j < NUM_LINES; ++j) {
+            damping_[j] = flushDenormal(frame[j] * (1.0f - dampingCoeff_) + damping_[j] * dampingCoeff_);
+            sum += damping_[j];
+        }
+
+        // Householder: y = g * (x - 2/N * sum(x))
+        const float reflect = sum * (2.0f / NUM_LINES);
+        for (int j = 0; j < NUM_LINES; ++j) {
+            const float input = (j & 1) ? inR : inL;
+            dst[j] = (damping_[j] - reflect) * feedback_ + input * inputGain;
+        }
+#endif
+
+        writePos_ = (writePos_ + 1) & mask_;
+    }
+
+    std::vector<float> buffer_;  // interleaved: frame * NUM_LINES + line
+    alignas(16) std::array<float, NUM_LINES> damping_{};
+    std::array<int, NUM_LINES> delays_{};
+    int mask_ = 0;
+    int writePos_ = 0;
+
+    double sampleRate_ = 48000.0;
+    float roomSize_ = 0.5f;
+    float feedback_ = 0.84f;
+    float dampingCoeff_ = 0.25f;
+
+    // Half-rate decimation / interpolation state
+    bool halfRate_ = false;
+    bool oddSample_ = false;
+    float pendingInL_ = 0.0f, pendingInR_ = 0.0f;
+    float lastL_ = 0.0f, lastR_ = 0.0f;
+    float currentL_ = 0.0f, currentR_ = 0.0f;
+
+    // Tail-decay bypass
+    int silentSamples_ = 0;
+    bool idle_ = true;
+};
+
+} // namespace DSP
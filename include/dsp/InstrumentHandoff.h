@@ -0,0 +1,107 @@
+/*
+ * InstrumentHandoff.h
+ *
+ * Wait-free handoff of a whole engine instance to the audio thread
+ *
+ * - publish() (any non-audio thread) stores a fully prepared instance in a
+ *   single atomic slot; an instance the audio thread never claimed is simply
+ *   replaced and deleted by the publisher
+ * - claim() (audio thread) takes the pending instance with one exchange,
+ *   only if there is room to retire what it replaces
+ * - retire() (audio thread) parks instances in fixed atomic slots; collect()
+ *   deletes them later on a non-audio thread, so no destructor ever runs
+ *   on the audio thread
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace DSP {
+
+template <typename T, int MaxRetired = 8>
+class InstrumentHandoff
+{
+public:
+    static_assert(MaxRetired > 1, "swaps during a crossfade retire two instances");
+
+    InstrumentHandoff() = default;
+    InstrumentHandoff(const InstrumentHandoff&) = delete;
+    InstrumentHandoff& operator=(const InstrumentHandoff&) = delete;
+
+    /** Audio must be stopped; deletes the pending and all retired instances */
+    ~InstrumentHandoff()
+    {
+        delete pending_.exchange(nullptr, std::memory_order_acquire);
+        collect();
+    }
+
+    /** @brief Non-audio thread: make next the instance the audio thread adopts */
+    void publish(std::unique_ptr<T> next)
+    {
+        delete pending_.exchange(next.release(), std::memory_order_acq_rel);
+    }
+
+    bool hasPending() const { return pending_.load(std::memory_order_acquire) != nullptr; }
+
+    /**
+     * @brief Audio thread: take the pending instance, or nullptr
+     *
+     * Only succeeds while at least retireCount retire slots are free, so the
+     * caller can retire that many instances without failing.
+     */
+    T* claim(int retireCount)
+    {
+        if (pending_.load(std::memory_order_relaxed) == nullptr || freeSlots() < retireCount) {
+            return nullptr;
+        }
+        return pending_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    /** @brief Audio thread: defer deletion of instance; false if every slot is taken */
+    bool retire(T* instance)
+    {
+        if (instance == nullptr) {
+            return true;
+        }
+        for (auto& slot : retired_) {
+            if (slot.load(std::memory_order_relaxed) == nullptr) {
+                slot.store(instance, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** @brief Non-audio thread: delete every retired instance; returns how many */
+    int collect()
+    {
+        int count = 0;
+        for (auto& slot : retired_) {
+            if (T* instance = slot.exchange(nullptr, std::memory_order_acquire)) {
+                delete instance;
+                ++count;
+            }
+        }
+        return count;
+    }
+
+private:
+    int freeSlots() const
+    {
+        int count = 0;
+        for (const auto& slot : retired_) {
+            count += slot.load(std::memory_order_relaxed) == nullptr ? 1 : 0;
+        }
+        return count;
+    }
+
+    std::atomic<T*> pending_{nullptr};
+    std::array<std::atomic<T*>, MaxRetired> retired_{};
+};
+
+} // namespace DSP
@@ -0,0 +1,606 @@
+/*
+ * NatureDSP_Pure.h
+ *
+ * Pure DSP implementation for Nature instrument
+ *
+ * Architecture: Headless DSP (no JUCE dependencies)
+ * Inherits: DSP::InstrumentDSP
+ *
+ * Keyboard layout:
+ *   C2-F2   Water       F#2-B2  Wind
+ *   C3-F3   Insect      F#3-B3  Amphibian
+ *   C4-F4   Bird        F#4-B4  Mammal
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "dsp/InstrumentDSP.h"
+#include "dsp/ScheduledEventQueue.h"
+#include "dsp/DenormalGuard.h"
+#include "dsp/BlockEnvelope.h"
+#include "dsp/NatureKernels.h"
+#include "dsp/OscillatorBank.h"
+#include "dsp/SimdKernels.h"
+#include "dsp/FDNReverb.h"
+#include "dsp/ParameterRegistry.h"
+#include "dsp/ParameterExchange.h"
+#include "dsp/PresetFormat.h"
+#include "dsp/RealtimeTelemetry.h"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+
+namespace DSP {
+
+//==============================================================================
+// Shared Types
+//==============================================================================
+
+enum class SoundCategory { Water, Wind, Insect, Bird, Amphibian, Mammal };
+
+/**
+ * @brief Lightweight LCG random source shared by all synthesis modules
+ */
+struct RandomState
+{
+    uint32_t seed = 12345;
+
+    float nextFloat()
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) * (1.0f / 16777216.0f);
+    }
+};
+
+struct OscillatorPairState
+{
+    float carrierPhase = 0.0f;
+    float modulatorPhase = 0.0f;
+};
+
+struct FormantState
+{
+    float phase = 0.0f;      // Pulse / vibrato phase (cycles)
+    float tonePhase = 0.0f;  // Voiced tone phase (cycles)
+};
+
+struct GrainState
+{
+    float position = 0.0f;
+};
+
+// A sine burst that may span several render chunks
+struct DripState
+{
+    int length = 0;      // Burst length in samples
+    int elapsed = 0;     // Samples rendered so far
+    float frequency = 0.0f;
+    float amplitude = 0.0f;
+};
+
+//==============================================================================
+// Synthesis Modules
+//
+// Modules hold only sample rate and the shared RNG. All evolving DSP state
+// lives in the per-module State struct, which NatureDSP keeps per voice so
+// that overlapping notes of the same category never share filter/LFO state.
+//==============================================================================
+
+class WaterSynthesis
+{
+public:
+    enum SoundType { Rain, Stream, Ocean, Waterfall, Drips };
+
+    struct State
+    {
+        LFOState lfo{0.0f, 0.5f};
+        FilterState lowpass;
+        FilterState bandpass;
+        GrainState grain;
+        DripState drip;
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateRain(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float texture);
+    void generateStream(State& s, float** outputs, int numChannels, int numSamples,
+                        float intensity, float texture);
+    void generateOcean(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float texture);
+    void generateWaterfall(State& s, float** outputs, int numChannels, int numSamples,
+                           float intensity, float texture);
+    void generateDrips(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float texture);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    BlockNoise noise_;
+    alignas(32) float noiseBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float auxBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float lfoBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float filterBuffer_[MAX_BLOCK_SIZE];
+};
+
+class WindSynthesis
+{
+public:
+    enum SoundType { Breeze, Gusts, Whistle, Storm };
+
+    struct State
+    {
+        LFOState lfo{0.0f, 0.2f};
+        FilterState bandpass;
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateBreeze(State& s, float** outputs, int numChannels, int numSamples,
+                        float intensity, float modulation);
+    void generateGusts(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float gustSpeed);
+    void generateWhistle(State& s, float** outputs, int numChannels, int numSamples,
+                         float intensity, float frequency);
+    void generateStorm(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float turbulence);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    BlockNoise noise_;
+    alignas(32) float noiseBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float lfoBuffer_[MAX_BLOCK_SIZE];
+    alignas(32) float filterBuffer_[MAX_BLOCK_SIZE];
+};
+
+class InsectSynthesis
+{
+public:
+    enum SoundType { Cricket, Cicada, Bee, Fly, Mosquito, Swarm };
+
+    static constexpr int MAX_SWARM_SIZE = 10;
+
+    struct State
+    {
+        OscillatorPairState fm;
+        OscillatorPairState am;
+        OscillatorBank<MAX_SWARM_SIZE> swarm;  // Populated on first Swarm block
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateCricket(State& s, float** outputs, int numChannels, int numSamples,
+                         float intensity, float pitch);
+    void generateCicada(State& s, float** outputs, int numChannels, int numSamples,
+                        float intensity, float pitch);
+    void generateBee(State& s, float** outputs, int numChannels, int numSamples,
+                     float intensity, float pitch);
+    void generateFly(State& s, float** outputs, int numChannels, int numSamples,
+                     float intensity, float pitch);
+    void generateMosquito(State& s, float** outputs, int numChannels, int numSamples,
+                          float intensity, float pitch);
+    void generateSwarm(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float density);
+
+    float generateSawtooth(float phase);
+    float generateSquare(float phase);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+    const SimdKernels* kernels_ = &getSimdKernels(SimdLevel::Scalar);  // Selected in init()
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    alignas(32) float toneBuffer_[MAX_BLOCK_SIZE];
+};
+
+class BirdSynthesis
+{
+public:
+    enum SoundType { Songbird, Owl, Crow, Flock };
+
+    static constexpr int MAX_FLOCK_SIZE = 10;
+
+    struct State
+    {
+        OscillatorPairState fm;
+        FormantState formant;
+        OscillatorBank<MAX_FLOCK_SIZE> flock;  // Populated on first Flock block
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateSongbird(State& s, float** outputs, int numChannels, int numSamples,
+                          float intensity, float pitch);
+    void generateOwl(State& s, float** outputs, int numChannels, int numSamples,
+                     float intensity, float pitch);
+    void generateCrow(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float pitch);
+    void generateFlock(State& s, float** outputs, int numChannels, int numSamples,
+                       float intensity, float density);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+    const SimdKernels* kernels_ = &getSimdKernels(SimdLevel::Scalar);  // Selected in init()
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    alignas(32) float toneBuffer_[MAX_BLOCK_SIZE];
+};
+
+class AmphibianSynthesis
+{
+public:
+    enum SoundType { Frog, Toad, TreeFrog };
+
+    struct State
+    {
+        FormantState formant;
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateFrog(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float pitch);
+    void generateToad(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float pitch);
+    void generateTreeFrog(State& s, float** outputs, int numChannels, int numSamples,
+                          float intensity, float pitch);
+    void generatePulsedTone(State& s, float** outputs, int numChannels, int numSamples,
+                            float toneFreq, float pulseRate, float pulseWidth, float gain);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    alignas(32) float toneBuffer_[MAX_BLOCK_SIZE];
+};
+
+class MammalSynthesis
+{
+public:
+    enum SoundType { Wolf, Coyote, Deer, Fox };
+
+    struct State
+    {
+        FormantState formant;
+    };
+
+    void init(double sampleRate, RandomState& rng);
+
+    void process(State& state, float** outputs, int numChannels, int numSamples,
+                 SoundType soundType, float amplitude, float velocity);
+
+private:
+    void generateWolf(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float pitch);
+    void generateCoyote(State& s, float** outputs, int numChannels, int numSamples,
+                        float intensity, float pitch);
+    void generateDeer(State& s, float** outputs, int numChannels, int numSamples,
+                      float intensity, float pitch);
+    void generateFox(State& s, float** outputs, int numChannels, int numSamples,
+                     float intensity, float pitch);
+    void generateTone(State& s, float** outputs, int numChannels, int numSamples,
+                      float toneFreq, float gain);
+
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    double sampleRate_ = 48000.0;
+    RandomState* rng_ = nullptr;
+
+    // Block scratch (process() chunks larger blocks into MAX_BLOCK_SIZE)
+    alignas(32) float toneBuffer_[MAX_BLOCK_SIZE];
+};
+
+//==============================================================================
+// Nature DSP Instrument
+//==============================================================================
+
+class NatureDSP : public InstrumentDSP
+{
+public:
+    static constexpr int MAX_VOICES = 32;
+    static constexpr int MAX_EVENTS_PER_BLOCK = 512;
+    static constexpr int MAX_OUTPUT_CHANNELS = 2;
+    static constexpr int RENDER_CHUNK_SIZE = 256;
+    static constexpr float SILENCE_THRESHOLD = 1.0e-5f;  // -100 dB
+
+    static constexpr const char* PARAM_MASTER_LEVEL = "master_level";
+    static constexpr const char* PARAM_REVERB_MIX = "reverb_mix";
+    static constexpr const char* PARAM_REVERB_ROOM_SIZE = "reverb_room_size";
+    static constexpr const char* PARAM_REVERB_DAMPING = "reverb_damping";
+    static constexpr const char* PARAM_REVERB_HALF_RATE = "reverb_half_rate";
+
+    enum ParameterIndex : int
+    {
+        PARAM_INDEX_MASTER_LEVEL = 0,
+        PARAM_INDEX_REVERB_MIX,
+        PARAM_INDEX_REVERB_ROOM_SIZE,
+        PARAM_INDEX_REVERB_DAMPING,
+        PARAM_INDEX_REVERB_HALF_RATE,
+        NUM_PARAMETERS
+    };
+
+    static constexpr ParameterRegistry<NUM_PARAMETERS> PARAMETERS{{{
+        PARAM_MASTER_LEVEL,
+        PARAM_REVERB_MIX,
+        PARAM_REVERB_ROOM_SIZE,
+        PARAM_REVERB_DAMPING,
+        PARAM_REVERB_HALF_RATE
+    }}};
+    static_assert(PARAMETERS.hasUniqueHashes(), "Parameter ID hash collision");
+
+    NatureDSP();
+    ~NatureDSP() override;
+
+    bool prepare(double sampleRate, int blockSize) override;
+    void reset() override;
+    void process(float** outputs, int numChannels, int numSamples) override;
+    void handleEvent(const ScheduledEvent& event) override;
+
+    /**
+     * @brief Process a block with a sorted list of timestamped events
+     *
+     * Rendering is split into sub-blocks at each event's sampleOffset so
+     * note-ons and parameter changes land on the exact sample. Offsets at or
+     * beyond numSamples are applied at the end of the block.
+     */
+    void process(float** outputs, int numChannels, int numSamples,
+                 const ScheduledEvent* events, int numEvents);
+
+    /**
+     * @brief Queue an event for sample-accurate dispatch in the next process()
+     * @return false if the per-block queue was full: the queued events were
+     *         applied immediately, in order, and event was queued after them
+     */
+    bool scheduleEvent(const ScheduledEvent& event);
+
+    float getParameter(const char* paramId) const override;
+    void setParameter(const char* paramId, float value) override;
+
+    /**
+     * @brief Index-based parameter access (no string handling)
+     *
+     * Resolve IDs once with getParameterIndex() and keep the index; unknown
+     * indices are ignored (get returns 0).
+     */
+    static int getParameterIndex(const char* paramId) { return PARAMETERS.indexOf(paramId); }
+    float getParameter(int index) const;
+    void setParameter(int index, float value);
+
+    /**
+     * @brief Thread-safe parameter update for host / UI threads
+     *
+     * setParameter() and loadPreset-driven updates must otherwise only run on
+     * the audio thread. Published values are applied at the start of the next
+     * process() call (latest value wins) and continuous parameters are
+     * smoothed from there.
+     */
+    void publishParameter(int index, float value) { hostParameters_.publish(index, value); }
+
+    bool savePreset(char* jsonBuffer, int jsonBufferSize) const override;
+    bool loadPreset(const char* jsonData) override;
+
+    /**
+     * @brief Compiled presets (parameter-index keyed, see PresetFormat.h)
+     *
+     * compilePreset() does the one text pass; publishPreset() hands the
+     * values over like host automation (any thread, applied at the next
+     * block start).
+     */
+    using Preset = PresetBlock<NUM_PARAMETERS>;
+    static int compilePreset(const char* jsonData, Preset& preset) { return preset.compileJson(jsonData, PARAMETERS); }
+    bool loadBinaryPreset(const void* data, size_t size);
+    void publishPreset(const Preset& preset)
+    {
+        for (int i = 0; i < preset.size(); ++i) {
+            publishParameter(preset[i].index, preset[i].value);
+        }
+    }
+
+    int getActiveVoiceCount() const override;
+    int getMaxPolyphony() const override;
+
+    const char* getInstrumentName() const override { return "Nature"; }
+    const char* getInstrumentVersion() const override { return "1.0.0"; }
+
+    /** @brief Release every held note (MIDI all notes off) */
+    void allNotesOff();
+
+    /** @brief Silence every voice at once (MIDI all sound off) */
+    void panic();
+
+    /**
+     * @brief True if the last processed block was known to be silent
+     *
+     * Set when no voice produced audible output and the reverb tail has
+     * decayed, in which case the block was only cleared. Hosts may use this
+     * to skip downstream processing.
+     */
+    bool isOutputSilent() const { return outputSilent_; }
+
+    /** @brief Pre-reverb peak estimate of the last processed block */
+    float getOutputPeak() const { return outputPeak_; }
+
+    /**
+     * @brief Audio-thread cost and event counters (see RealtimeTelemetry.h)
+     *
+     * Safe from any thread. Stages used: Voices, Reverb. All zero when built
+     * with NATURE_DSP_TELEMETRY=0.
+     */
+    TelemetryStageStats getStageTelemetry(TelemetryStage stage) const { return telemetry_.getStageStats(stage); }
+    uint64_t getTelemetryEventCount(TelemetryEvent event) const { return telemetry_.getEventCount(event); }
+    void resetTelemetry() { telemetry_.requestReset(); }
+
+    /** Vector kernels selected at the last prepare() (see SimdKernels.h) */
+    SimdLevel getSimdLevel() const { return kernels_->level; }
+
+private:
+    /**
+     * @brief Synthesis state owned by a single voice
+     *
+     * Only the member matching the voice's category is advanced; the others
+     * stay at their defaults until the slot is reused for that category.
+     */
+    struct VoiceSynthState
+    {
+        WaterSynthesis::State water;
+        WindSynthesis::State wind;
+        InsectSynthesis::State insect;
+        BirdSynthesis::State bird;
+        AmphibianSynthesis::State amphibian;
+        MammalSynthesis::State mammal;
+    };
+
+    /**
+     * @brief Voice slot; its envelope lives in envelopes_ at the same index
+     */
+    struct VoiceState
+    {
+        bool active = false;
+
+        int midiNote = -1;
+        float velocity = 0.0f;
+        SoundCategory category = SoundCategory::Water;
+        int soundIndex = 0;
+
+        // Last rendered chunk (post-envelope); silent chunks are not mixed
+        float peak = 0.0f;
+        bool silent = true;
+
+        // Allocator bookkeeping
+        int nextFree = -1;        // intrusive free list link (inactive voices)
+        uint32_t startOrder = 0;  // note-on sequence number, for age
+
+        VoiceSynthState synth;
+    };
+
+    using EnvelopeBank = BlockEnvelopeBank<MAX_VOICES>;
+
+    // Envelope rates (per sample)
+    static constexpr float ENV_ATTACK_RATE = 0.001f;
+    static constexpr float ENV_DECAY_RATE = 0.0005f;
+    static constexpr float ENV_SUSTAIN_LEVEL = 0.7f;
+    static constexpr float ENV_RELEASE_RATE = 0.0002f;
+
+    void renderSegment(float** outputs, int numChannels, int startSample, int numSamples);
+
+    static constexpr int NUM_MIDI_NOTES = 128;
+    static constexpr int STEAL_FADE_SAMPLES = 256;
+    static_assert(STEAL_FADE_SAMPLES <= RENDER_CHUNK_SIZE, "Steal fade renders through voice scratch");
+
+    // Voice helpers
+    VoiceState* allocateVoice();
+    VoiceState* selectVoiceToSteal();
+    void freeVoice(VoiceState* voice);
+    void resetVoiceAllocator();
+    VoiceState* findVoice(int midiNote);
+    void mapNote(VoiceState* voice, int midiNote);
+    void renderStealFade(VoiceState* voice);
+    void mixStealFade(float** outputs, int numChannels, int numSamples);
+    int voiceIndex(const VoiceState* voice) const { return static_cast<int>(voice - voices_.data()); }
+    void renderVoice(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void mixVoiceToOutput(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+
+    void generateWaterSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void generateWindSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void generateInsectSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void generateBirdSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void generateAmphibianSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+    void generateMammalSound(VoiceState* voice, float** outputs, int numChannels, int numSamples);
+
+    // Synthesis modules (stateless renderers, state lives in voices_)
+    WaterSynthesis waterSynth_;
+    WindSynthesis windSynth_;
+    InsectSynthesis insectSynth_;
+    BirdSynthesis birdSynth_;
+    AmphibianSynthesis amphibianSynth_;
+    MammalSynthesis mammalSynth_;
+
+    // Preallocated voice pool
+    std::array<VoiceState, MAX_VOICES> voices_;
+    EnvelopeBank envelopes_;
+    std::atomic<int> activeVoiceCount_{0};
+
+    // Allocator: free list head, note -> voice map, note-on counter
+    int freeListHead_ = -1;
+    std::array<int8_t, NUM_MIDI_NOTES> noteToVoice_{};
+    uint32_t noteOnCounter_ = 0;
+
+    // Pre-rendered fade-out of the last stolen voice(s), mixed into the
+    // following segments
+    alignas(32) float stealFade_[MAX_OUTPUT_CHANNELS][STEAL_FADE_SAMPLES];
+    int stealFadeLength_ = 0;
+    float stealFadePeak_ = 0.0f;
+
+    ScheduledEventQueue<MAX_EVENTS_PER_BLOCK> pendingEvents_;
+
+    RandomState random_;
+    FDNReverb reverb_;
+    Telemetry telemetry_;
+    const SimdKernels* kernels_ = &getSimdKernels(SimdLevel::Scalar);
+
+    // Parameters (targets; the audio path reads the smoothers)
+    float masterLevel_ = 0.8f;
+    float reverbMix_ = 0.15f;
+    float reverbRoomSize_ = 0.5f;
+    float reverbDamping_ = 0.5f;
+
+    static constexpr float PARAMETER_SMOOTHING_SECONDS = 0.02f;
+
+    ParameterExchange<NUM_PARAMETERS> hostParameters_;
+    LinearSmoother masterLevelSmoother_;
+    LinearSmoother reverbMixSmoother_;
+    LinearSmoother reverbDampingSmoother_;
+
+    void snapSmoothers();
+
+    double sampleRate_ = 48000.0;
+    int blockSize_ = 512;
+
+    // Master bus silence tracking for the current / last block
+    bool outputSilent_ = true;
+    float outputPeak_ = 0.0f;
+
+    // Per-voice render scratch (generators render at unit envelope gain)
+    alignas(32) float voiceScratch_[MAX_OUTPUT_CHANNELS][RENDER_CHUNK_SIZE];
+    alignas(32) float gainRamp_[RENDER_CHUNK_SIZE];
+};
+
+} // namespace DSP
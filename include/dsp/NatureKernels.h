@@ -0,0 +1,316 @@
+/*
+ * NatureKernels.h
+ *
+ * Block DSP kernels shared by the Nature synthesis modules
+ *
+ * - BlockNoise: 4-lane xorshift32 white noise that fills whole buffers
+ *   (SSE2 / NEON with a bit-identical scalar fallback)
+ * - One-pole lowpass and resonant bandpass with coefficients computed once
+ *   per block, or once per CONTROL_RATE_INTERVAL when modulated; filter
+ *   state goes through flushDenormal()
+ * - Control-rate sine LFO rendered as a per-sample linear ramp
+ * - Branch-free rational tanh for block saturators and a first-order
+ *   antiderivative anti-aliased (ADAA) hard clipper
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "DenormalGuard.h"
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define NATURE_KERNELS_SSE2 1
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define NATURE_KERNELS_NEON 1
+#endif
+
+namespace DSP {
+
+// Samples between coefficient / LFO evaluations for modulated filters
+static constexpr int CONTROL_RATE_INTERVAL = 16;
+
+struct LFOState
+{
+    float phase = 0.0f;
+    float frequency = 0.5f;
+};
+
+struct FilterState
+{
+    float z1 = 0.0f;
+    float z2 = 0.0f;
+};
+
+//==============================================================================
+// White Noise
+//==============================================================================
+
+class BlockNoise
+{
+public:
+    void seed(uint32_t seed)
+    {
+        // Derive four non-zero lane states from one seed
+        for (int lane = 0; lane < 4; ++lane) {
+            seed = seed * 1664525u + 1013904223u;
+            state_[lane] = (seed != 0u) ? seed : 0x9E3779B9u;
+        }
+    }
+
+    /** Fill dst[0..numSamples) with uniform noise in [-1, 1) */
+    void fill(float* dst, int numSamples)
+    {
+        constexpr float scale = 1.0f / 4194304.0f;  // 23-bit value -> [0, 2)
+        int i = 0;
+
+#if defined(NATURE_KERNELS_SSE2)
+        __m128i s = _mm_load_si128(reinterpret_cast<const __m128i*>(state_));
+        const __m128 vScale = _mm_set1_ps(scale);
+        const __m128 vOne = _mm_set1_ps(1.0f);
+        for (; i + 4 <= numSamples; i += 4) {
+            s = _mm_xor_si128(s, _mm_slli_epi32(s, 13));
+            s = _mm_xor_si128(s, _mm_srli_epi32(s, 17));
+            s = _mm_xor_si128(s, _mm_slli_epi32(s, 5));
+            __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(s, 9));
+            _mm_storeu_ps(dst + i, _mm_sub_ps(_mm_mul_ps(value, vScale), vOne));
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(state_), s);
+#elif defined(NATURE_KERNELS_NEON)
+        uint32x4_t s = vld1q_u32(state_);
+        const float32x4_t vScale = vdupq_n_f32(scale);
+        const float32x4_t vOne = vdupq_n_f32(1.0f);
+        for (; i + 4 <= numSamples; i += 4) {
+            s = veorq_u32(s, vshlq_n_u32(s, 13));
+            s = veorq_u32(s, vshrq_n_u32(s, 17));
+            s = veorq_u32(s, vshlq_n_u32(s, 5));
+            float32x4_t value = vcvtq_f32_u32(vshrq_n_u32(s, 9));
+            vst1q_f32(dst + i, vsubq_f32(vmulq_f32(value, vScale), vOne));
+        }
+        vst1q_u32(state_, s);
+#endif
+
+        // Scalar path / tail: same per-lane sequence as the SIMD loops
+        for (; i < numSamples; i += 4) {
+            float values[4];
+            for (int lane = 0; lane < 4; ++lane) {
+                uint32_t x = state_[lane];
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                state_[lane] = x;
+                values[lane] = static_cast<float>(x >> 9) * scale - 1.0f;
+            }
+            const int count = std::min(4, numSamples - i);
+            for (int lane = 0; lane < count; ++lane) {
+                dst[i + lane] = values[lane];
+            }
+        }
+    }
+
+private:
+    alignas(16) uint32_t state_[4] = {0x12345678u, 0x9E3779B9u, 0x7F4A7C15u, 0x2545F491u};
+};
+
+//==============================================================================
+// Filters
+//==============================================================================
+
+/**
+ * @brief RC one-pole lowpass coefficient
+ */
+struct OnePoleCoefficients
+{
+    float alpha = 1.0f;
+
+    static OnePoleCoefficients lowpass(float cutoff, double sampleRate)
+    {
+        const float rc = 1.0f / (cutoff * 2.0f * static_cast<float>(M_PI));
+        const float dt = 1.0f / static_cast<float>(sampleRate);
+        return { dt / (rc + dt) };
+    }
+};
+
+/**
+ * @brief Resonant bandpass coefficients, pre-divided by a0
+ *
+ * Same recursion the generators have always used
+ * (y = (alpha * x + 2cos(w) * y1 - y2) / (1 + alpha)), evaluated without
+ * per-sample trig or division.
+ */
+struct ResonatorCoefficients
+{
+    float gain = 0.0f;
+    float c1 = 0.0f;
+    float c2 = 0.0f;
+
+    static ResonatorCoefficients bandpass(float cutoff, float resonance, double sampleRate)
+    {
+        // Modulated centres can swing below 0 Hz (e.g. Storm); keep the poles
+        // inside the unit circle
+        cutoff = std::clamp(cutoff, 20.0f, 0.45f * static_cast<float>(sampleRate));
+        const float omega = 2.0f * static_cast<float>(M_PI) * cutoff / static_cast<float>(sampleRate);
+        const float alpha = std::sin(omega) / (2.0f * resonance);
+        const float invA0 = 1.0f / (1.0f + alpha);
+        return { alpha * invA0, 2.0f * std::cos(omega) * invA0, -invA0 };
+    }
+};
+
+inline void processLowpassBlock(FilterState& f, const OnePoleCoefficients& c,
+                                const float* input, float* output, int numSamples)
+{
+    float z1 = f.z1;
+    for (int i = 0; i < numSamples; ++i) {
+        z1 = flushDenormal(z1 + c.alpha * (input[i] - z1));
+        output[i] = z1;
+    }
+    f.z1 = z1;
+}
+
+inline void processBandpassBlock(FilterState& f, const ResonatorCoefficients& c,
+                                 const float* input, float* output, int numSamples)
+{
+    float y1 = f.z1;
+    float y2 = f.z2;
+    for (int i = 0; i < numSamples; ++i) {
+        const float y = c.gain * input[i] + c.c1 * y1 + c.c2 * y2;
+        y2 = y1;
+        y1 = flushDenormal(y);
+        output[i] = y;
+    }
+    f.z1 = y1;
+    f.z2 = y2;
+}
+
+/**
+ * @brief Bandpass whose centre follows baseFreq + depth * lfo[i]
+ *
+ * Coefficients are recomputed once per CONTROL_RATE_INTERVAL from the LFO
+ * value at the start of each interval.
+ */
+inline void processModulatedBandpassBlock(FilterState& f, const float* input, float* output,
+                                          int numSamples, const float* lfo,
+                                          float baseFreq, float depth, float resonance,
+                                          double sampleRate)
+{
+    for (int start = 0; start < numSamples; start += CONTROL_RATE_INTERVAL) {
+        const int count = std::min(CONTROL_RATE_INTERVAL, numSamples - start);
+        const auto coeffs = ResonatorCoefficients::bandpass(baseFreq + depth * lfo[start],
+                                                            resonance, sampleRate);
+        processBandpassBlock(f, coeffs, input + start, output + start, count);
+    }
+}
+
+//==============================================================================
+// LFO
+//==============================================================================
+
+/**
+ * @brief Render sin(phase) for numSamples, advancing lfo.phase
+ *
+ * sin() is evaluated once per CONTROL_RATE_INTERVAL and linearly
+ * interpolated in between.
+ */
+inline void renderSineLFO(LFOState& lfo, float phaseIncrement, float* output, int numSamples)
+{
+    constexpr float twoPi = 2.0f * static_cast<float>(M_PI);
+    float phase = lfo.phase;
+    float current = std::sin(phase);
+
+    for (int start = 0; start < numSamples; start += CONTROL_RATE_INTERVAL) {
+        const int count = std::min(CONTROL_RATE_INTERVAL, numSamples - start);
+
+        phase += phaseIncrement * static_cast<float>(count);
+        if (phase >= twoPi) phase -= twoPi;
+
+        const float next = std::sin(phase);
+        const float step = (next - current) / static_cast<float>(count);
+        for (int i = 0; i < count; ++i) {
+            output[start + i] = current + step * static_cast<float>(i);
+        }
+        current = next;
+    }
+
+    lfo.phase = phase;
+}
+
+//==============================================================================
+// Saturation
+//==============================================================================
+
+/**
+ * @brief tanh(x) via its [7/6] continued-fraction approximant
+ *
+ * Within ~1e-6 of std::tanh for |x| < 3 and ~1e-4 everywhere (clamped to
+ * +-1); plain arithmetic and min/max so block loops vectorize.
+ */
+inline float fastTanh(float x)
+{
+    x = std::clamp(x, -4.97f, 4.97f);
+    const float x2 = x * x;
+    const float num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    const float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    return std::clamp(num / den, -1.0f, 1.0f);
+}
+
+/** @brief output[i] = fastTanh(input[i] * drive) * gain */
+inline void processTanhBlock(const float* input, float* output, int numSamples,
+                             float drive, float gain)
+{
+    for (int i = 0; i < numSamples; ++i) {
+        output[i] = fastTanh(input[i] * drive) * gain;
+    }
+}
+
+/**
+ * @brief Hard clip to [-1, 1] with first-order ADAA
+ *
+ * y[n] = (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]) with F the clipper's
+ * antiderivative; near-equal successive inputs fall back to clipping their
+ * midpoint. Adds half a sample of delay.
+ */
+struct HardClipADAA
+{
+    float x1 = 0.0f;
+    float f1 = 0.0f;
+
+    static float antiderivative(float x)
+    {
+        const float ax = std::abs(x);
+        return (ax <= 1.0f) ? 0.5f * x * x : ax - 0.5f;
+    }
+
+    void reset()
+    {
+        x1 = 0.0f;
+        f1 = 0.0f;
+    }
+
+    /** @brief data[i] = clip(data[i] * drive), in place */
+    void process(float* data, int numSamples, float drive)
+    {
+        constexpr float epsilon = 1.0e-5f;
+        float xPrev = x1;
+        float fPrev = f1;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float x = data[i] * drive;
+            const float f = antiderivative(x);
+            const float dx = x - xPrev;
+            data[i] = (std::abs(dx) > epsilon) ? (f - fPrev) / dx
+                                               : std::clamp(0.5f * (x + xPrev), -1.0f, 1.0f);
+            xPrev = x;
+            fPrev = f;
+        }
+
+        x1 = xPrev;
+        f1 = fPrev;
+    }
+};
+
+} // namespace DSP
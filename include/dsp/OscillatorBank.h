@@ -0,0 +1,118 @@
+/*
+ * OscillatorBank.h
+ *
+ * Table-lookup sine oscillators with persistent phase accumulators
+ *
+ * - Partials read the process-wide SineTable (SharedTables.h)
+ * - OscillatorBank: N sine partials stored as structure-of-arrays, rendered
+ *   partial-major so each inner loop is a straight phase ramp; the
+ *   SimdKernels overload runs the runtime-selected vector variant
+ * - renderFMPair: two-operator FM (carrier/modulator) on table sine
+ *
+ * All phases are in cycles [0, 1) and persist across blocks.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "SharedTables.h"
+#include "SimdKernels.h"
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+namespace DSP {
+
+//==============================================================================
+// Oscillator Bank
+//==============================================================================
+
+template <int MaxOscillators>
+class OscillatorBank
+{
+public:
+    void clear() { count_ = 0; }
+    int size() const { return count_; }
+    static constexpr int capacity() { return MaxOscillators; }
+
+    /** Append a partial; returns false when the bank is full */
+    bool add(float frequency, float phase, float gain, double sampleRate)
+    {
+        if (count_ >= MaxOscillators) {
+            return false;
+        }
+        phase_[count_] = phase - std::floor(phase);
+        increment_[count_] = static_cast<float>(frequency / sampleRate);
+        gain_[count_] = gain;
+        ++count_;
+        return true;
+    }
+
+    void setFrequency(int index, float frequency, double sampleRate)
+    {
+        increment_[index] = static_cast<float>(frequency / sampleRate);
+    }
+
+    /** Add outputGain * sum(gain_k * sin(phase_k)) into output */
+    void render(float* output, int numSamples, float outputGain)
+    {
+        const auto& sine = SineTable::get();
+
+        for (int k = 0; k < count_; ++k) {
+            float phase = phase_[k];
+            const float increment = increment_[k];
+            const float gain = gain_[k] * outputGain;
+
+            for (int i = 0; i < numSamples; ++i) {
+                output[i] += gain * sine.lookup(phase);
+                phase += increment;
+                if (phase >= 1.0f) phase -= 1.0f;
+            }
+
+            phase_[k] = phase;
+        }
+    }
+
+    /** As above with the selected kernel table (see SimdKernels.h) */
+    void render(const SimdKernels& kernels, float* output, int numSamples, float outputGain)
+    {
+        kernels.sineBank(SineTable::get().data(), SineTable::SIZE, phase_.data(), increment_.data(),
+                         gain_.data(), count_, outputGain, output, numSamples);
+    }
+
+private:
+    alignas(32) std::array<float, MaxOscillators> phase_{};
+    alignas(32) std::array<float, MaxOscillators> increment_{};
+    alignas(32) std::array<float, MaxOscillators> gain_{};
+    int count_ = 0;
+};
+
+//==============================================================================
+// FM Pair
+//==============================================================================
+
+/**
+ * @brief Write sin(2pi * carrier + index * sin(2pi * modulator)) to output
+ *
+ * index is in radians, matching the generators' original formulation.
+ */
+inline void renderFMPair(float& carrierPhase, float& modulatorPhase,
+                         float carrierIncrement, float modulatorIncrement,
+                         float index, float* output, int numSamples)
+{
+    const auto& sine = SineTable::get();
+    const float indexCycles = index / (2.0f * static_cast<float>(M_PI));
+
+    for (int i = 0; i < numSamples; ++i) {
+        const float modulator = sine.lookup(modulatorPhase);
+        output[i] = sine.lookupWrapped(carrierPhase + indexCycles * modulator);
+
+        carrierPhase += carrierIncrement;
+        modulatorPhase += modulatorIncrement;
+        if (carrierPhase >= 1.0f) carrierPhase -= 1.0f;
+        if (modulatorPhase >= 1.0f) modulatorPhase -= 1.0f;
+    }
+}
+
+} // namespace DSP
@@ -0,0 +1,152 @@
+/*
+ * ParameterExchange.h
+ *
+ * Host-thread -> audio-thread parameter handoff and smoothing
+ *
+ * - ParameterExchange: one atomic value per parameter plus an atomic dirty
+ *   mask. Any thread may publish; the audio thread drains once per block.
+ *   Bursts of automation collapse to the latest value per parameter.
+ * - LinearSmoother: fixed-length linear ramp towards the latest target,
+ *   advanced once per render segment (control rate) and applied as a
+ *   per-sample linear ramp by the caller
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace DSP {
+
+//==============================================================================
+// Parameter Exchange
+//==============================================================================
+
+template <int NumParameters>
+class ParameterExchange
+{
+public:
+    static_assert(NumParameters > 0 && NumParameters <= 64,
+                  "ParameterExchange tracks dirty parameters in a 64-bit mask");
+
+    /** @brief Publish a value (wait-free; safe from any thread) */
+    void publish(int index, float value)
+    {
+        if (index < 0 || index >= NumParameters) {
+            return;
+        }
+        values_[index].store(value, std::memory_order_relaxed);
+        dirty_.fetch_or(uint64_t{1} << index, std::memory_order_release);
+    }
+
+    /** @brief Latest published value not yet drained, if any */
+    bool peek(int index, float& value) const
+    {
+        if (index < 0 || index >= NumParameters) {
+            return false;
+        }
+        if ((dirty_.load(std::memory_order_acquire) & (uint64_t{1} << index)) == 0) {
+            return false;
+        }
+        value = values_[index].load(std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Audio thread: call apply(index, value) for every parameter
+     *        published since the last drain
+     */
+    template <typename Apply>
+    void drain(Apply&& apply)
+    {
+        uint64_t dirty = dirty_.exchange(0, std::memory_order_acquire);
+        while (dirty != 0) {
+            const int index = countTrailingZeros(dirty);
+            dirty &= dirty - 1;
+            apply(index, values_[index].load(std::memory_order_relaxed));
+        }
+    }
+
+private:
+    static int countTrailingZeros(uint64_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(x);
+#else
+        int count = 0;
+        while ((x & 1u) == 0) {
+            x >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    std::array<std::atomic<float>, NumParameters> values_{};
+    std::atomic<uint64_t> dirty_{0};
+};
+
+//==============================================================================
+// Linear Smoother
+//==============================================================================
+
+class LinearSmoother
+{
+public:
+    void prepare(double sampleRate, float rampSeconds)
+    {
+        rampSamples_ = std::max(1, static_cast<int>(sampleRate * rampSeconds));
+        snap(target_);
+    }
+
+    /** Jump straight to value (no ramp) */
+    void snap(float value)
+    {
+        current_ = target_ = value;
+        step_ = 0.0f;
+        remaining_ = 0;
+    }
+
+    /** Ramp from the current value to target over the ramp length */
+    void setTarget(float target)
+    {
+        if (target == target_) {
+            return;
+        }
+        target_ = target;
+        remaining_ = rampSamples_;
+        step_ = (target_ - current_) / static_cast<float>(remaining_);
+    }
+
+    float getCurrent() const { return current_; }
+    float getTarget() const { return target_; }
+    bool isSmoothing() const { return remaining_ > 0; }
+
+    /** Advance by numSamples; returns the value reached */
+    float advance(int numSamples)
+    {
+        if (remaining_ > 0) {
+            if (numSamples >= remaining_) {
+                current_ = target_;
+                remaining_ = 0;
+            } else {
+                current_ += step_ * static_cast<float>(numSamples);
+                remaining_ -= numSamples;
+            }
+        }
+        return current_;
+    }
+
+private:
+    float current_ = 0.0f;
+    float target_ = 0.0f;
+    float step_ = 0.0f;
+    int remaining_ = 0;
+    int rampSamples_ = 1;
+};
+
+} // namespace DSP
@@ -0,0 +1,107 @@
+/*
+ * ParameterRegistry.h
+ *
+ * Compile-time parameter ID table for InstrumentDSP implementations
+ *
+ * - IDs are hashed (FNV-1a) at compile time; a static_assert in each
+ *   instrument guarantees the hashes are collision-free over its table
+ * - indexOf() resolves a string ID with one hash, a scan over packed
+ *   32-bit hashes and a single strcmp to confirm the hit
+ * - Wrappers resolve IDs once (construction / listener registration) and
+ *   use the integer index on the audio thread
+ * - layoutHash() fingerprints the ordered ID list, so index-keyed data
+ *   (compiled presets) can be checked against the table it was built for
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DSP {
+
+constexpr uint32_t hashParameterId(const char* id)
+{
+    uint32_t hash = 2166136261u;
+    while (*id != '\0') {
+        hash ^= static_cast<uint8_t>(*id++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template <size_t NumParameters>
+class ParameterRegistry
+{
+public:
+    static constexpr int INVALID_INDEX = -1;
+
+    constexpr explicit ParameterRegistry(const std::array<const char*, NumParameters>& ids)
+        : ids_(ids)
+    {
+        for (size_t i = 0; i < NumParameters; ++i) {
+            hashes_[i] = hashParameterId(ids_[i]);
+        }
+
+        // FNV-1a over the IDs in order, each terminated
+        uint32_t layout = 2166136261u;
+        for (size_t i = 0; i < NumParameters; ++i) {
+            for (const char* c = ids_[i]; ; ++c) {
+                layout ^= static_cast<uint8_t>(*c);
+                layout *= 16777619u;
+                if (*c == '\0') {
+                    break;
+                }
+            }
+        }
+        layoutHash_ = layout;
+    }
+
+    static constexpr int size() { return static_cast<int>(NumParameters); }
+
+    /** @return the parameter's index, or INVALID_INDEX if unknown */
+    int indexOf(const char* id) const
+    {
+        if (id == nullptr) {
+            return INVALID_INDEX;
+        }
+
+        const uint32_t hash = hashParameterId(id);
+        for (size_t i = 0; i < NumParameters; ++i) {
+            if (hashes_[i] == hash) {
+                return std::strcmp(ids_[i], id) == 0 ? static_cast<int>(i) : INVALID_INDEX;
+            }
+        }
+        return INVALID_INDEX;
+    }
+
+    constexpr uint32_t layoutHash() const { return layoutHash_; }
+
+    constexpr const char* idAt(int index) const
+    {
+        return (index >= 0 && index < size()) ? ids_[static_cast<size_t>(index)] : nullptr;
+    }
+
+    constexpr bool hasUniqueHashes() const
+    {
+        for (size_t i = 0; i < NumParameters; ++i) {
+            for (size_t j = i + 1; j < NumParameters; ++j) {
+                if (hashes_[i] == hashes_[j]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<const char*, NumParameters> ids_{};
+    std::array<uint32_t, NumParameters> hashes_{};
+    uint32_t layoutHash_ = 0;
+};
+
+} // namespace DSP
@@ -0,0 +1,402 @@
+/*
+ * PhysicalModelCore.h
+ *
+ * Shared physical-modelling core for the Aether and Aether String engines
+ *
+ * Both instruments are built from the same subsystems; the parts that are
+ * the same live here once and each engine instantiates them with its own
+ * compile-time policies:
+ *
+ * - WaveguideLoop<Interpolation>: delay loop over DSP::DelayLine with the
+ *   in-loop filter chain passed as a callable (inlined per instrument),
+ *   per-sample and chunked block processing; fed-back samples pass through
+ *   flushDenormal() so the loop cannot ring down into subnormals
+ * - FilterCascade<Stage, N>: fixed-length cascade (dispersion allpasses)
+ * - ModalBank<Mode, MaxModes>: fixed-capacity body mode storage, no heap
+ * - ModalResonatorBank<MaxModes>: SoA decaying complex oscillators run
+ *   4 modes at a time (SSE2 / NEON, scalar fallback)
+ * - NonlinearBridge: tanh bridge coupling with reflected energy
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "DelayLine.h"
+#include "DenormalGuard.h"
+#include "NatureKernels.h"
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+namespace DSP {
+
+enum class DelayInterpolation { Integer, Lagrange3 };
+
+/**
+ * @brief Delay loop: read, run the loop filter, write back
+ *
+ * The loop filter is any callable float(float) taking the delay output and
+ * returning the sample to feed back. Integer interpolation truncates the
+ * delay so the read is always a single tap.
+ */
+template <DelayInterpolation Interpolation>
+class WaveguideLoop
+{
+public:
+    static constexpr int BLOCK_CHUNK_SIZE = 64;
+
+    void prepare(int maximumDelay) { line_.prepare(maximumDelay); }
+    void reset() { line_.reset(); }
+
+    void setDelay(float delayInSamples)
+    {
+        if constexpr (Interpolation == DelayInterpolation::Integer) {
+            delayInSamples = std::floor(delayInSamples);
+        }
+        line_.setDelay(delayInSamples);
+    }
+
+    float getDelay() const { return line_.getDelay(); }
+    int getMaximumDelay() const { return line_.getMaximumDelay(); }
+
+    /** Excitation helpers */
+    void push(float sample) { line_.write(sample); }
+    void fill(const float* source, int sourceLength, float gain) { line_.fill(source, sourceLength, gain); }
+    void addToNewest(float value) { line_.addToNewest(value); }
+
+    template <typename LoopFilter>
+    float processSample(LoopFilter&& loopFilter)
+    {
+        const float output = line_.read();
+        line_.write(flushDenormal(loopFilter(output)));
+        return output;
+    }
+
+    /** @brief Delay outputs for numSamples, moving the loop in delay-sized chunks */
+    template <typename LoopFilter>
+    void processBlock(float* output, int numSamples, LoopFilter&& loopFilter)
+    {
+        float feedback[BLOCK_CHUNK_SIZE];
+        const int chunkLimit = std::min(BLOCK_CHUNK_SIZE, line_.getMaxBlockLength());
+
+        for (int offset = 0; offset < numSamples; offset += chunkLimit) {
+            // Everything read here was written before this chunk started
+            const int n = std::min(chunkLimit, numSamples - offset);
+            line_.read(output + offset, n);
+
+            for (int i = 0; i < n; ++i) {
+                feedback[i] = flushDenormal(loopFilter(output[offset + i]));
+            }
+
+            line_.write(feedback, n);
+        }
+    }
+
+    /** @brief As above, adding input[i] * inputGain to each fed-back sample (driven string) */
+    template <typename LoopFilter>
+    void processBlock(float* output, const float* input, float inputGain, int numSamples,
+                      LoopFilter&& loopFilter)
+    {
+        float feedback[BLOCK_CHUNK_SIZE];
+        const int chunkLimit = std::min(BLOCK_CHUNK_SIZE, line_.getMaxBlockLength());
+
+        for (int offset = 0; offset < numSamples; offset += chunkLimit) {
+            const int n = std::min(chunkLimit, numSamples - offset);
+            line_.read(output + offset, n);
+
+            for (int i = 0; i < n; ++i) {
+                feedback[i] = flushDenormal(loopFilter(output[offset + i]) + input[offset + i] * inputGain);
+            }
+
+            line_.write(feedback, n);
+        }
+    }
+
+private:
+    DelayLine line_;
+};
+
+/**
+ * @brief NumStages filters in series (Stage needs processSample / reset)
+ */
+template <typename Stage, int NumStages>
+struct FilterCascade
+{
+    static constexpr int NUM_STAGES = NumStages;
+
+    std::array<Stage, NumStages> stages;
+
+    float processSample(float input)
+    {
+        for (auto& stage : stages) {
+            input = stage.processSample(input);
+        }
+        return input;
+    }
+
+    void reset()
+    {
+        for (auto& stage : stages) {
+            stage.reset();
+        }
+    }
+};
+
+/**
+ * @brief Fixed-capacity body mode storage
+ *
+ * Vector-like interface (push_back / resize / range-for) over inline
+ * storage, so loading a body preset never allocates and the modes stay
+ * contiguous with the voice. Mode needs prepare / reset / processSample.
+ */
+template <typename Mode, int MaxModes>
+class ModalBank
+{
+public:
+    static constexpr int MAX_MODES = MaxModes;
+
+    void prepare(double sampleRate)
+    {
+        for (auto& mode : *this) {
+            mode.prepare(sampleRate);
+        }
+    }
+
+    void reset()
+    {
+        for (auto& mode : *this) {
+            mode.reset();
+        }
+    }
+
+    /** Sum of all modes driven by the same excitation */
+    float processSample(float excitation)
+    {
+        float output = 0.0f;
+        for (auto& mode : *this) {
+            output += mode.processSample(excitation);
+        }
+        return output;
+    }
+
+    /** Ignored once MaxModes modes are loaded */
+    void push_back(const Mode& mode)
+    {
+        if (numModes_ < MaxModes) {
+            modes_[static_cast<size_t>(numModes_++)] = mode;
+        }
+    }
+
+    /** New modes are default-constructed; clamped to MaxModes */
+    void resize(int numModes)
+    {
+        numModes = std::clamp(numModes, 0, MaxModes);
+        for (int i = numModes_; i < numModes; ++i) {
+            modes_[static_cast<size_t>(i)] = Mode{};
+        }
+        numModes_ = numModes;
+    }
+
+    void clear() { numModes_ = 0; }
+    int size() const { return numModes_; }
+    bool empty() const { return numModes_ == 0; }
+
+    Mode& operator[](int index) { return modes_[static_cast<size_t>(index)]; }
+    const Mode& operator[](int index) const { return modes_[static_cast<size_t>(index)]; }
+
+    Mode* begin() { return modes_.data(); }
+    Mode* end() { return modes_.data() + numModes_; }
+    const Mode* begin() const { return modes_.data(); }
+    const Mode* end() const { return modes_.data() + numModes_; }
+
+private:
+    std::array<Mode, MaxModes> modes_{};
+    int numModes_ = 0;
+};
+
+/**
+ * @brief Bank of decaying resonant modes, structure-of-arrays
+ *
+ * Per mode and sample: energy = energy * decay + excitation * inputGain,
+ * the unit phasor is rotated by its precomputed e^{jw}, and the output is
+ * energy * sin(phase), i.e. the phasor's imaginary part. Coefficients are
+ * set with setMode() when the owner's parameters change, never per sample.
+ * The phasors are renormalized every RENORMALIZE_INTERVAL samples to stop
+ * rounding drift.
+ */
+template <int MaxModes>
+class ModalResonatorBank
+{
+public:
+    static_assert(MaxModes % 4 == 0, "modes are processed four at a time");
+
+    static constexpr int MAX_MODES = MaxModes;
+    static constexpr int RENORMALIZE_INTERVAL = 1024;
+    static constexpr float ENERGY_FLOOR = 1.0e-10f;
+
+    ModalResonatorBank() { reset(); }
+
+    /** Modes past numModes are silenced (zero input gain and energy) */
+    void setNumModes(int numModes)
+    {
+        numModes_ = std::clamp(numModes, 0, MaxModes);
+        numGroups_ = (numModes_ + 3) / 4;
+        for (int i = numModes_; i < MaxModes; ++i) {
+            inputGain_[i] = 0.0f;
+            decay_[i] = 0.0f;
+            energy_[i] = 0.0f;
+        }
+    }
+
+    int getNumModes() const { return numModes_; }
+
+    void setMode(int index, float frequency, double sampleRate, float inputGain, float decayFactor)
+    {
+        const double omega = 2.0 * M_PI * static_cast<double>(frequency) / sampleRate;
+        cosW_[index] = static_cast<float>(std::cos(omega));
+        sinW_[index] = static_cast<float>(std::sin(omega));
+        inputGain_[index] = inputGain;
+        decay_[index] = decayFactor;
+    }
+
+    void setInputGain(int index, float inputGain) { inputGain_[index] = inputGain; }
+
+    void reset()
+    {
+        for (int i = 0; i < MaxModes; ++i) {
+            energy_[i] = 0.0f;
+            re_[i] = 1.0f;
+            im_[i] = 0.0f;
+        }
+        samplesSinceRenormalize_ = 0;
+    }
+
+    /** Sum of all modes driven by the same excitation */
+    float processSample(float excitation)
+    {
+        float output = 0.0f;
+
+#if defined(NATURE_KERNELS_SSE2)
+        const __m128 vExcitation = _mm_set1_ps(excitation);
+        const __m128 vFloor = _mm_set1_ps(ENERGY_FLOOR);
+        const __m128 vAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        __m128 vSum = _mm_setzero_ps();
+        for (int g = 0; g < numGroups_ * 4; g += 4) {
+            __m128 energy = _mm_add_ps(_mm_mul_ps(_mm_load_ps(energy_ + g), _mm_load_ps(decay_ + g)),
+                                       _mm_mul_ps(vExcitation, _mm_load_ps(inputGain_ + g)));
+            energy = _mm_and_ps(energy, _mm_cmpge_ps(_mm_and_ps(energy, vAbsMask), vFloor));
+            _mm_store_ps(energy_ + g, energy);
+
+            const __m128 re = _mm_load_ps(re_ + g);
+            const __m128 im = _mm_load_ps(im_ + g);
+            const __m128 c = _mm_load_ps(cosW_ + g);
+            const __m128 s = _mm_load_ps(sinW_ + g);
+            const __m128 newIm = _mm_add_ps(_mm_mul_ps(re, s), _mm_mul_ps(im, c));
+            _mm_store_ps(re_ + g, _mm_sub_ps(_mm_mul_ps(re, c), _mm_mul_ps(im, s)));
+            _mm_store_ps(im_ + g, newIm);
+
+            vSum = _mm_add_ps(vSum, _mm_mul_ps(energy, newIm));
+        }
+        vSum = _mm_add_ps(vSum, _mm_shuffle_ps(vSum, vSum, _MM_SHUFFLE(1, 0, 3, 2)));
+        vSum = _mm_add_ps(vSum, _mm_shuffle_ps(vSum, vSum, _MM_SHUFFLE(2, 3, 0, 1)));
+        output = _mm_cvtss_f32(vSum);
+#elif defined(NATURE_KERNELS_NEON)
+        const float32x4_t vExcitation = vdupq_n_f32(excitation);
+        const float32x4_t vFloor = vdupq_n_f32(ENERGY_FLOOR);
+        float32x4_t vSum = vdupq_n_f32(0.0f);
+        for (int g = 0; g < numGroups_ * 4; g += 4) {
+            float32x4_t energy = vmlaq_f32(vmulq_f32(vExcitation, vld1q_f32(inputGain_ + g)),
+                                           vld1q_f32(energy_ + g), vld1q_f32(decay_ + g));
+            energy = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(energy),
+                                                     vcgeq_f32(vabsq_f32(energy), vFloor)));
+            vst1q_f32(energy_ + g, energy);
+
+            const float32x4_t re = vld1q_f32(re_ + g);
+            const float32x4_t im = vld1q_f32(im_ + g);
+            const float32x4_t c = vld1q_f32(cosW_ + g);
+            const float32x4_t s = vld1q_f32(sinW_ + g);
+            const float32x4_t newIm = vmlaq_f32(vmulq_f32(re, s), im, c);
+            vst1q_f32(re_ + g, vmlsq_f32(vmulq_f32(re, c), im, s));
+            vst1q_f32(im_ + g, newIm);
+
+            vSum = vmlaq_f32(vSum, energy, newIm);
+        }
+        float32x2_t pair = vadd_f32(vget_low_f32(vSum), vget_high_f32(vSum));
+        output = vget_lane_f32(vpadd_f32(pair, pair), 0);
+#else
+        for (int i = 0; i < numGroups_ * 4; ++i) {
+            float energy = energy_[i] * decay_[i] + excitation * inputGain_[i];
+            if (std::abs(energy) < ENERGY_FLOOR) {
+                energy = 0.0f;
+            }
+            energy_[i] = energy;
+
+            const float re = re_[i];
+            const float im = im_[i];
+            re_[i] = re * cosW_[i] - im * sinW_[i];
+            im_[i] = re * sinW_[i] + im * cosW_[i];
+
+            output += energy * im_[i];
+        }
+#endif
+
+        if (++samplesSinceRenormalize_ >= RENORMALIZE_INTERVAL) {
+            renormalize();
+        }
+        return output;
+    }
+
+private:
+    void renormalize()
+    {
+        for (int i = 0; i < numGroups_ * 4; ++i) {
+            const float magnitude = std::sqrt(re_[i] * re_[i] + im_[i] * im_[i]);
+            const float scale = (magnitude > 0.0f) ? 1.0f / magnitude : 0.0f;
+            re_[i] = (magnitude > 0.0f) ? re_[i] * scale : 1.0f;
+            im_[i] *= scale;
+        }
+        samplesSinceRenormalize_ = 0;
+    }
+
+    alignas(16) float energy_[MaxModes];
+    alignas(16) float decay_[MaxModes] = {};
+    alignas(16) float inputGain_[MaxModes] = {};
+    alignas(16) float re_[MaxModes];
+    alignas(16) float im_[MaxModes];
+    alignas(16) float cosW_[MaxModes] = {};
+    alignas(16) float sinW_[MaxModes] = {};
+
+    int numModes_ = 0;
+    int numGroups_ = 0;
+    int samplesSinceRenormalize_ = 0;
+};
+
+/**
+ * @brief Nonlinear bridge: tanh-saturated transfer, remainder reflected
+ */
+class NonlinearBridge
+{
+public:
+    void prepare(double) {}
+    void reset() { bridgeEnergy_ = 0.0f; }
+
+    /** Returns the energy reflected back into the string */
+    float processString(float stringOutput)
+    {
+        bridgeEnergy_ = std::tanh(stringOutput * couplingCoefficient_ * (1.0f + nonlinearity_));
+        return stringOutput - bridgeEnergy_;
+    }
+
+    float getBridgeEnergy() const { return bridgeEnergy_; }
+
+    void setCouplingCoefficient(float coeff) { couplingCoefficient_ = std::clamp(coeff, 0.0f, 1.0f); }
+    void setNonlinearity(float nonlinearity) { nonlinearity_ = std::clamp(nonlinearity, 0.0f, 1.0f); }
+
+private:
+    float couplingCoefficient_ = 0.3f;
+    float nonlinearity_ = 0.1f;
+    float bridgeEnergy_ = 0.0f;
+};
+
+} // namespace DSP
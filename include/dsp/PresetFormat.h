@@ -0,0 +1,399 @@
+/*
+ * PresetFormat.h
+ *
+ * One-pass JSON preset scanning and the compiled binary preset format
+ *
+ * - JsonNumberScanner: single forward pass over a JSON document reporting
+ *   every numeric (or boolean) member with its key; strings, arrays and
+ *   nesting are skipped structurally, nothing is allocated
+ * - JsonNumberTable: the scan result as a fixed table, so engines with
+ *   name-mapped presets look keys up instead of rescanning the text
+ * - PresetBlock: a preset compiled against an instrument's
+ *   ParameterRegistry, i.e. (index, value) pairs. Applying it is a loop of
+ *   setParameter(index, value) calls: no parsing and no allocation, so it
+ *   can run on the audio thread at a block boundary
+ *
+ * Binary layout (little-endian, 4-byte aligned, safe to memory-map):
+ *
+ *   offset  size  field
+ *        0     4  magic "NPRB"
+ *        4     2  format version (BINARY_VERSION)
+ *        6     2  entry count
+ *        8     4  registry layout hash (ParameterRegistry::layoutHash())
+ *       12     4  reserved (0)
+ *       16   8*n  entries: uint16 parameter index, uint16 flags, float32 value
+ *
+ * A preset is only accepted by the registry it was compiled against; the
+ * layout hash changes whenever IDs are added, removed or reordered.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "ParameterRegistry.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace DSP {
+
+static_assert(std::endian::native == std::endian::little,
+              "binary presets are stored little-endian and read in place");
+
+//==============================================================================
+// JSON Scanner
+//==============================================================================
+
+class JsonNumberScanner
+{
+public:
+    static constexpr int MAX_DEPTH = 32;
+
+    /**
+     * @brief Call fn(key, keyLength, value, inParameters) for every numeric
+     *        or boolean object member, in document order
+     *
+     * key points into json (not terminated). inParameters is true for
+     * members anywhere inside a "parameters" object.
+     * @return false on malformed input or nesting deeper than MAX_DEPTH
+     *         (members reported before the error stand)
+     */
+    template <typename Fn>
+    static bool scan(const char* json, Fn&& fn)
+    {
+        if (json == nullptr) {
+            return false;
+        }
+
+        // Per open container: is it an object, is it inside "parameters"
+        bool isObject[MAX_DEPTH];
+        bool isParameters[MAX_DEPTH];
+        int depth = 0;
+
+        const char* key = nullptr;
+        int keyLength = 0;
+        bool expectKey = false;
+
+        const char* p = json;
+        while (*p != '\0') {
+            const char c = *p;
+
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',' || c == ':') {
+                if (c == ',' && depth > 0 && isObject[depth - 1]) {
+                    expectKey = true;
+                    key = nullptr;
+                }
+                ++p;
+                continue;
+            }
+
+            if (c == '{' || c == '[') {
+                if (depth >= MAX_DEPTH) {
+                    return false;
+                }
+                const bool parentParameters = depth > 0 && isParameters[depth - 1];
+                const bool namedParameters = key != nullptr && keyLength == 10
+                                             && std::memcmp(key, "parameters", 10) == 0;
+                isObject[depth] = c == '{';
+                isParameters[depth] = parentParameters || (c == '{' && namedParameters);
+                ++depth;
+                expectKey = c == '{';
+                key = nullptr;
+                ++p;
+                continue;
+            }
+
+            if (c == '}' || c == ']') {
+                if (depth == 0) {
+                    return false;
+                }
+                --depth;
+                expectKey = false;
+                key = nullptr;
+                ++p;
+                continue;
+            }
+
+            if (c == '"') {
+                const char* start = ++p;
+                while (*p != '\0' && *p != '"') {
+                    if (*p == '\\' && p[1] != '\0') {
+                        ++p;
+                    }
+                    ++p;
+                }
+                if (*p == '\0') {
+                    return false;
+                }
+                if (expectKey) {
+                    key = start;
+                    keyLength = static_cast<int>(p - start);
+                    expectKey = false;
+                } else {
+                    key = nullptr;  // string value
+                }
+                ++p;
+                continue;
+            }
+
+            // Scalar value: number or literal
+            const bool inParameters = depth > 0 && isParameters[depth - 1];
+            if (c == 't' && std::strncmp(p, "true", 4) == 0) {
+                if (key != nullptr) {
+                    fn(key, keyLength, 1.0, inParameters);
+                }
+                p += 4;
+            } else if (c == 'f' && std::strncmp(p, "false", 5) == 0) {
+                if (key != nullptr) {
+                    fn(key, keyLength, 0.0, inParameters);
+                }
+                p += 5;
+            } else if (c == 'n' && std::strncmp(p, "null", 4) == 0) {
+                p += 4;
+            } else {
+                char* end = nullptr;
+                const double value = std::strtod(p, &end);
+                if (end == p) {
+                    return false;
+                }
+                if (key != nullptr) {
+                    fn(key, keyLength, value, inParameters);
+                }
+                p = end;
+            }
+            key = nullptr;
+        }
+
+        return depth == 0;
+    }
+};
+
+/**
+ * @brief Fixed-capacity key -> number table from one scan of a document
+ *
+ * find() follows the old per-key search semantics: when the document has a
+ * "parameters" object only members inside it are visible, otherwise every
+ * member is; the first occurrence of a key wins. Keys point into the
+ * scanned text, which must outlive the table.
+ */
+template <int Capacity = 128>
+class JsonNumberTable
+{
+public:
+    explicit JsonNumberTable(const char* json)
+    {
+        valid_ = JsonNumberScanner::scan(json, [this](const char* key, int keyLength, double value, bool inParameters) {
+            hasParameters_ = hasParameters_ || inParameters;
+            if (count_ >= Capacity) {
+                overflowed_ = true;
+                return;
+            }
+            entries_[static_cast<size_t>(count_++)] = { hashKey(key, keyLength), key, keyLength, value, inParameters };
+        });
+    }
+
+    bool find(const char* key, double& value) const
+    {
+        const int keyLength = static_cast<int>(std::strlen(key));
+        const uint32_t hash = hashKey(key, keyLength);
+        for (int i = 0; i < count_; ++i) {
+            const Entry& entry = entries_[static_cast<size_t>(i)];
+            if (entry.hash == hash && entry.keyLength == keyLength
+                && (entry.inParameters || !hasParameters_)
+                && std::memcmp(entry.key, key, static_cast<size_t>(keyLength)) == 0) {
+                value = entry.value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int size() const { return count_; }
+    bool isValid() const { return valid_; }
+    bool overflowed() const { return overflowed_; }
+
+private:
+    struct Entry
+    {
+        uint32_t hash;
+        const char* key;
+        int keyLength;
+        double value;
+        bool inParameters;
+    };
+
+    // FNV-1a, same as hashParameterId() for terminated keys
+    static uint32_t hashKey(const char* key, int keyLength)
+    {
+        uint32_t hash = 2166136261u;
+        for (int i = 0; i < keyLength; ++i) {
+            hash ^= static_cast<uint8_t>(key[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    std::array<Entry, Capacity> entries_{};
+    int count_ = 0;
+    bool hasParameters_ = false;
+    bool valid_ = false;
+    bool overflowed_ = false;
+};
+
+//==============================================================================
+// Compiled Preset
+//==============================================================================
+
+template <int MaxParameters>
+class PresetBlock
+{
+public:
+    static constexpr uint16_t BINARY_VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 16;
+    static constexpr size_t ENTRY_SIZE = 8;
+    static constexpr size_t MAX_BINARY_SIZE = HEADER_SIZE + ENTRY_SIZE * MaxParameters;
+
+    struct Entry
+    {
+        uint16_t index;
+        uint16_t flags;
+        float value;
+    };
+    static_assert(sizeof(Entry) == ENTRY_SIZE, "Entry is the on-disk record");
+
+    void clear() { count_ = 0; }
+    int size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    const Entry& operator[](int i) const { return entries_[static_cast<size_t>(i)]; }
+
+    /** Set (or replace) the value for a parameter index */
+    void set(int index, float value)
+    {
+        if (index < 0 || index >= MaxParameters) {
+            return;
+        }
+        for (int i = 0; i < count_; ++i) {
+            if (entries_[static_cast<size_t>(i)].index == index) {
+                entries_[static_cast<size_t>(i)].value = value;
+                return;
+            }
+        }
+        if (count_ < MaxParameters) {
+            entries_[static_cast<size_t>(count_++)] = { static_cast<uint16_t>(index), 0, value };
+        }
+    }
+
+    /**
+     * @brief Compile a JSON preset against registry in one pass
+     *
+     * Members of a "parameters" object take precedence over same-named
+     * members elsewhere; unknown keys are ignored.
+     * @return number of parameters found
+     */
+    template <size_t N>
+    int compileJson(const char* json, const ParameterRegistry<N>& registry)
+    {
+        static_assert(static_cast<int>(N) <= MaxParameters, "block too small for the registry");
+
+        clear();
+        std::array<bool, N> fromParameters{};
+        char id[MAX_ID_LENGTH + 1];
+
+        JsonNumberScanner::scan(json, [&](const char* key, int keyLength, double value, bool inParameters) {
+            if (keyLength > MAX_ID_LENGTH) {
+                return;
+            }
+            std::memcpy(id, key, static_cast<size_t>(keyLength));
+            id[keyLength] = '\0';
+
+            const int index = registry.indexOf(id);
+            if (index < 0 || (fromParameters[static_cast<size_t>(index)] && !inParameters)) {
+                return;
+            }
+            fromParameters[static_cast<size_t>(index)] = fromParameters[static_cast<size_t>(index)] || inParameters;
+            set(index, static_cast<float>(value));
+        });
+
+        return count_;
+    }
+
+    /** @brief Call target.setParameter(index, value) for every entry */
+    template <typename Target>
+    void applyTo(Target& target) const
+    {
+        for (int i = 0; i < count_; ++i) {
+            const Entry& entry = entries_[static_cast<size_t>(i)];
+            target.setParameter(static_cast<int>(entry.index), entry.value);
+        }
+    }
+
+    size_t binarySize() const { return HEADER_SIZE + ENTRY_SIZE * static_cast<size_t>(count_); }
+
+    /** @return bytes written, or 0 if capacity is too small */
+    size_t writeBinary(void* data, size_t capacity, uint32_t layoutHash) const
+    {
+        const size_t size = binarySize();
+        if (data == nullptr || capacity < size) {
+            return 0;
+        }
+
+        uint8_t* out = static_cast<uint8_t*>(data);
+        const uint16_t count = static_cast<uint16_t>(count_);
+        const uint32_t reserved = 0;
+        std::memcpy(out, MAGIC, 4);
+        std::memcpy(out + 4, &BINARY_VERSION, 2);
+        std::memcpy(out + 6, &count, 2);
+        std::memcpy(out + 8, &layoutHash, 4);
+        std::memcpy(out + 12, &reserved, 4);
+        std::memcpy(out + HEADER_SIZE, entries_.data(), ENTRY_SIZE * static_cast<size_t>(count_));
+        return size;
+    }
+
+    /**
+     * @brief Load from the binary format (e.g. a memory-mapped file)
+     * @return false on a bad header, version or layout hash, a truncated
+     *         buffer or out-of-range indices (block left empty)
+     */
+    bool readBinary(const void* data, size_t size, uint32_t layoutHash)
+    {
+        clear();
+        if (data == nullptr || size < HEADER_SIZE) {
+            return false;
+        }
+
+        const uint8_t* in = static_cast<const uint8_t*>(data);
+        uint16_t version = 0;
+        uint16_t count = 0;
+        uint32_t hash = 0;
+        std::memcpy(&version, in + 4, 2);
+        std::memcpy(&count, in + 6, 2);
+        std::memcpy(&hash, in + 8, 4);
+
+        if (std::memcmp(in, MAGIC, 4) != 0 || version != BINARY_VERSION || hash != layoutHash
+            || count > MaxParameters || size < HEADER_SIZE + ENTRY_SIZE * count) {
+            return false;
+        }
+
+        std::memcpy(entries_.data(), in + HEADER_SIZE, ENTRY_SIZE * count);
+        for (int i = 0; i < count; ++i) {
+            if (entries_[static_cast<size_t>(i)].index >= MaxParameters) {
+                return false;
+            }
+        }
+        count_ = count;
+        return true;
+    }
+
+private:
+    static constexpr int MAX_ID_LENGTH = 63;
+    static constexpr char MAGIC[4] = { 'N', 'P', 'R', 'B' };
+
+    std::array<Entry, MaxParameters> entries_{};
+    int count_ = 0;
+};
+
+} // namespace DSP
@@ -0,0 +1,426 @@
+/*
+ * RealtimeTelemetry.h
+ *
+ * Audio-thread cost telemetry: per-stage tick counters and block histograms
+ *
+ * - Stages (voices, modulation, effects, reverb, body resonators) are timed
+ *   with Telemetry::Scope; a stage may be entered any number of times per
+ *   block and its total is recorded once at the end of the block
+ * - Per stage: block count, total / max ticks and a log-linear histogram
+ *   (8 buckets per octave) for percentiles
+ * - Events: voice steals, subnormal output samples, underruns (a block that
+ *   took longer than its own duration)
+ * - Single writer (the audio thread), any number of readers: counters are
+ *   relaxed atomics written with plain load/store, stage groups padded to
+ *   a cache line. Readers see each counter exactly, related counters may
+ *   be a block apart. resetTelemetry-style resets are requested by the
+ *   reader and performed by the writer at the next block start.
+ *
+ * Ticks come from the time-stamp counter on x86, the virtual counter on
+ * AArch64 and steady_clock (ns) elsewhere; getTicksPerSecond() converts.
+ *
+ * Build with NATURE_DSP_TELEMETRY=0 to compile all of it out: the same API
+ * remains, every call is an empty inline function and every read is zero.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#ifndef NATURE_DSP_TELEMETRY
+#define NATURE_DSP_TELEMETRY 1
+#endif
+
+#if NATURE_DSP_TELEMETRY
+#include <chrono>
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define NATURE_TELEMETRY_TSC 1
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define NATURE_TELEMETRY_CNTVCT 1
+#endif
+#endif
+
+namespace DSP {
+
+enum class TelemetryStage : int
+{
+    Block = 0,    // Whole process() call
+    Voices,
+    Modulation,
+    Effects,      // Pedalboard / insert effects
+    Reverb,
+    Body,         // Body resonators, bridge coupling
+    NUM_STAGES
+};
+
+enum class TelemetryEvent : int
+{
+    VoiceSteal = 0,
+    Denormal,     // Subnormal samples in the block output
+    Underrun,     // Block took longer than its duration
+    NUM_EVENTS
+};
+
+struct TelemetryStageStats
+{
+    uint64_t blocks = 0;          // Blocks in which the stage ran
+    double averageTicks = 0.0;    // Per block
+    uint64_t maxTicks = 0;
+    uint64_t p99Ticks = 0;        // Upper edge of the 99th percentile bucket (<= 12.5% high)
+    double averageLoad = 0.0;     // averageTicks / average block duration (1.0 = whole budget)
+    double p99Load = 0.0;
+    double maxLoad = 0.0;
+};
+
+#if NATURE_DSP_TELEMETRY
+
+class Telemetry
+{
+public:
+    static constexpr bool ENABLED = true;
+    static constexpr int NUM_STAGES = static_cast<int>(TelemetryStage::NUM_STAGES);
+    static constexpr int NUM_EVENTS = static_cast<int>(TelemetryEvent::NUM_EVENTS);
+
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int MAX_OCTAVE = 40;  // 2^40 ticks: minutes per block, clamped
+    static constexpr int NUM_BUCKETS = SUB_BUCKETS * (MAX_OCTAVE - SUB_BUCKET_BITS + 2);
+
+    static uint64_t now()
+    {
+#if defined(NATURE_TELEMETRY_TSC)
+        return static_cast<uint64_t>(__rdtsc());
+#elif defined(NATURE_TELEMETRY_CNTVCT)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /** @brief Tick rate of now(); the first call may calibrate for ~20 ms (never on the audio thread) */
+    static double getTicksPerSecond()
+    {
+        static const double ticksPerSecond = measureTicksPerSecond();
+        return ticksPerSecond;
+    }
+
+    //==========================================================================
+    // Audio thread
+    //==========================================================================
+
+    /** @brief Call from prepare(): sets the underrun budget (and calibrates the clock) */
+    void prepare(double sampleRate)
+    {
+        ticksPerSample_.store(sampleRate > 0.0 ? getTicksPerSecond() / sampleRate : 0.0, std::memory_order_relaxed);
+    }
+
+    /** @brief Times one process() call as TelemetryStage::Block */
+    class BlockScope
+    {
+    public:
+        BlockScope(Telemetry& telemetry, int numSamples) : telemetry_(telemetry) { telemetry_.beginBlock(numSamples); }
+        ~BlockScope() { telemetry_.endBlock(); }
+        BlockScope(const BlockScope&) = delete;
+        BlockScope& operator=(const BlockScope&) = delete;
+
+    private:
+        Telemetry& telemetry_;
+    };
+
+    /** @brief Adds the time until destruction to a stage (nullptr: no-op) */
+    class Scope
+    {
+    public:
+        Scope(Telemetry* telemetry, TelemetryStage stage)
+            : telemetry_(telemetry), stage_(static_cast<int>(stage)), start_(telemetry ? now() : 0) {}
+        Scope(Telemetry& telemetry, TelemetryStage stage) : Scope(&telemetry, stage) {}
+        ~Scope()
+        {
+            if (telemetry_) {
+                telemetry_->blockTicks_[stage_] += now() - start_;
+                telemetry_->stagesEntered_ |= 1u << stage_;
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Telemetry* telemetry_;
+        int stage_;
+        uint64_t start_;
+    };
+
+    void addEvent(TelemetryEvent event, uint64_t count = 1)
+    {
+        increment(events_.counts[static_cast<int>(event)], count);
+    }
+
+    /** @brief Count subnormal samples (TelemetryEvent::Denormal) */
+    void countDenormals(const float* samples, int numSamples)
+    {
+        // Bit test rather than a compare: with DAZ set, subnormals compare equal to zero
+        uint64_t count = 0;
+        for (int i = 0; i < numSamples; ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, samples + i, sizeof(bits));
+            count += ((bits & 0x7F800000u) == 0 && (bits & 0x007FFFFFu) != 0) ? 1 : 0;
+        }
+        if (count > 0) {
+            addEvent(TelemetryEvent::Denormal, count);
+        }
+    }
+
+    //==========================================================================
+    // Any thread
+    //==========================================================================
+
+    TelemetryStageStats getStageStats(TelemetryStage stage) const
+    {
+        const StageCounters& c = stages_[static_cast<int>(stage)];
+        const StageCounters& block = stages_[static_cast<int>(TelemetryStage::Block)];
+
+        TelemetryStageStats stats;
+        stats.blocks = c.blocks.load(std::memory_order_relaxed);
+        if (stats.blocks == 0) {
+            return stats;
+        }
+        stats.averageTicks = static_cast<double>(c.totalTicks.load(std::memory_order_relaxed))
+                           / static_cast<double>(stats.blocks);
+        stats.maxTicks = c.maxTicks.load(std::memory_order_relaxed);
+
+        // Percentile over the histogram as it stands (may lag blocks by one)
+        uint64_t histogramTotal = 0;
+        for (const auto& bucket : c.histogram) {
+            histogramTotal += bucket.load(std::memory_order_relaxed);
+        }
+        const uint64_t target = histogramTotal - histogramTotal / 100;
+        uint64_t seen = 0;
+        for (int b = 0; b < NUM_BUCKETS; ++b) {
+            seen += c.histogram[b].load(std::memory_order_relaxed);
+            if (seen >= target && seen > 0) {
+                stats.p99Ticks = bucketUpperEdge(b);
+                break;
+            }
+        }
+
+        // Loads are relative to the average block duration
+        const uint64_t blocks = block.blocks.load(std::memory_order_relaxed);
+        const double budget = blocks > 0 ? static_cast<double>(block.samples.load(std::memory_order_relaxed))
+                                         / static_cast<double>(blocks)
+                                         * ticksPerSample_.load(std::memory_order_relaxed) : 0.0;
+        if (budget > 0.0) {
+            stats.averageLoad = stats.averageTicks / budget;
+            stats.p99Load = static_cast<double>(stats.p99Ticks) / budget;
+            stats.maxLoad = static_cast<double>(stats.maxTicks) / budget;
+        }
+        return stats;
+    }
+
+    uint64_t getEventCount(TelemetryEvent event) const
+    {
+        return events_.counts[static_cast<int>(event)].load(std::memory_order_relaxed);
+    }
+
+    /** @brief Clear everything at the start of the next block */
+    void requestReset() { resetRequested_.store(true, std::memory_order_relaxed); }
+
+    /** @brief Histogram bucket for a tick count (exposed for tests / tools) */
+    static int bucketIndex(uint64_t ticks)
+    {
+        if (ticks < static_cast<uint64_t>(SUB_BUCKETS)) {
+            return static_cast<int>(ticks);
+        }
+        int octave = floorLog2(ticks);
+        if (octave > MAX_OCTAVE) {
+            return NUM_BUCKETS - 1;
+        }
+        const int sub = static_cast<int>((ticks >> (octave - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+        return SUB_BUCKETS * (octave - SUB_BUCKET_BITS + 1) + sub;
+    }
+
+    /** @brief Largest tick count that lands in a bucket */
+    static uint64_t bucketUpperEdge(int bucket)
+    {
+        if (bucket < SUB_BUCKETS) {
+            return static_cast<uint64_t>(bucket);
+        }
+        const int octave = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+        const uint64_t sub = static_cast<uint64_t>(bucket % SUB_BUCKETS);
+        return ((static_cast<uint64_t>(SUB_BUCKETS) + sub + 1) << (octave - SUB_BUCKET_BITS)) - 1;
+    }
+
+private:
+    static constexpr int CACHE_LINE = 64;
+
+    struct alignas(CACHE_LINE) StageCounters
+    {
+        std::atomic<uint64_t> blocks{0};
+        std::atomic<uint64_t> totalTicks{0};
+        std::atomic<uint64_t> maxTicks{0};
+        std::atomic<uint64_t> samples{0};   // Block stage only
+        std::atomic<uint64_t> histogram[NUM_BUCKETS] = {};
+    };
+
+    struct alignas(CACHE_LINE) EventCounters
+    {
+        std::atomic<uint64_t> counts[NUM_EVENTS] = {};
+    };
+
+    /** Single writer: a plain add, no locked read-modify-write */
+    static void increment(std::atomic<uint64_t>& counter, uint64_t amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    static int floorLog2(uint64_t x)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(x);
+#else
+        int log = 0;
+        while (x >>= 1) {
+            ++log;
+        }
+        return log;
+#endif
+    }
+
+    static double measureTicksPerSecond()
+    {
+#if defined(NATURE_TELEMETRY_CNTVCT)
+        uint64_t frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        return static_cast<double>(frequency);
+#elif defined(NATURE_TELEMETRY_TSC)
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const uint64_t startTicks = now();
+        while (Clock::now() - start < std::chrono::milliseconds(20)) {
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return static_cast<double>(now() - startTicks) / seconds;
+#else
+        return 1.0e9;
+#endif
+    }
+
+    void record(int stage, uint64_t ticks)
+    {
+        StageCounters& c = stages_[stage];
+        increment(c.blocks, 1);
+        increment(c.totalTicks, ticks);
+        if (ticks > c.maxTicks.load(std::memory_order_relaxed)) {
+            c.maxTicks.store(ticks, std::memory_order_relaxed);
+        }
+        increment(c.histogram[bucketIndex(ticks)], 1);
+    }
+
+    void clear()
+    {
+        for (auto& c : stages_) {
+            c.blocks.store(0, std::memory_order_relaxed);
+            c.totalTicks.store(0, std::memory_order_relaxed);
+            c.maxTicks.store(0, std::memory_order_relaxed);
+            c.samples.store(0, std::memory_order_relaxed);
+            for (auto& bucket : c.histogram) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+        for (auto& count : events_.counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void beginBlock(int numSamples)
+    {
+        if (resetRequested_.load(std::memory_order_relaxed)) {
+            resetRequested_.store(false, std::memory_order_relaxed);
+            clear();
+        }
+        for (auto& ticks : blockTicks_) {
+            ticks = 0;
+        }
+        stagesEntered_ = 0;
+        blockSamples_ = numSamples;
+        blockStart_ = now();
+    }
+
+    void endBlock()
+    {
+        const uint64_t total = now() - blockStart_;
+        record(static_cast<int>(TelemetryStage::Block), total);
+        increment(stages_[static_cast<int>(TelemetryStage::Block)].samples, static_cast<uint64_t>(blockSamples_));
+
+        for (int s = 1; s < NUM_STAGES; ++s) {
+            if (stagesEntered_ & (1u << s)) {
+                record(s, blockTicks_[s]);
+            }
+        }
+
+        const double ticksPerSample = ticksPerSample_.load(std::memory_order_relaxed);
+        if (ticksPerSample > 0.0 && static_cast<double>(total) > ticksPerSample * blockSamples_) {
+            addEvent(TelemetryEvent::Underrun);
+        }
+    }
+
+    StageCounters stages_[NUM_STAGES];
+    EventCounters events_;
+    alignas(CACHE_LINE) std::atomic<bool> resetRequested_{false};
+    std::atomic<double> ticksPerSample_{0.0};  // Set by prepare()
+
+    // Audio thread only
+    alignas(CACHE_LINE) uint64_t blockTicks_[NUM_STAGES] = {};
+    uint32_t stagesEntered_ = 0;
+    int blockSamples_ = 0;
+    uint64_t blockStart_ = 0;
+};
+
+#else
+
+/** Telemetry compiled out: same API, no state, no code */
+class Telemetry
+{
+public:
+    static constexpr bool ENABLED = false;
+
+    static uint64_t now() { return 0; }
+    static double getTicksPerSecond() { return 0.0; }
+
+    void prepare(double) {}
+
+    class BlockScope
+    {
+    public:
+        BlockScope(Telemetry&, int) {}
+    };
+
+    class Scope
+    {
+    public:
+        Scope(Telemetry*, TelemetryStage) {}
+        Scope(Telemetry&, TelemetryStage) {}
+    };
+
+    void addEvent(TelemetryEvent, uint64_t = 1) {}
+    void countDenormals(const float*, int) {}
+
+    TelemetryStageStats getStageStats(TelemetryStage) const { return {}; }
+    uint64_t getEventCount(TelemetryEvent) const { return 0; }
+    void requestReset() {}
+};
+
+#endif
+
+} // namespace DSP
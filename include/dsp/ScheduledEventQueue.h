@@ -0,0 +1,209 @@
+/*
+ * ScheduledEventQueue.h
+ *
+ * Fixed-capacity, sample-offset ordered event queue for the audio thread
+ *
+ * - Storage is a std::array sized at compile time (never allocates)
+ * - Events are kept sorted by sampleOffset on insertion (stable, so events
+ *   sharing an offset keep their arrival order)
+ * - push() reports overflow instead of growing; pushOrFlush() handles it by
+ *   applying the queued events early, in order, so nothing is dropped or
+ *   reordered (a note-off can never overtake its note-on)
+ * - toScheduledEvent() converts a raw MIDI message in one pass, so hosts
+ *   (JUCE plugins, the FFI layer) fill the queue straight from their MIDI
+ *   buffers with the sample offset intact
+ * - processWithEvents() gives engines whose process() takes no event list
+ *   the same sample-accurate dispatch by splitting the block at each offset
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "dsp/InstrumentDSP.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace DSP {
+
+/** Channel mode controllers engines act on */
+constexpr int MIDI_CC_ALL_SOUND_OFF = 120;
+constexpr int MIDI_CC_ALL_NOTES_OFF = 123;
+
+/**
+ * @brief Convert one raw MIDI message (status byte first)
+ *
+ * All sound off becomes RESET (voices cut at once); all notes off stays a
+ * CONTROL_CHANGE, on which engines release their held notes.
+ *
+ * @return false for messages with no event mapping (SysEx, clock, poly
+ *         aftertouch, ...); event is left unspecified
+ */
+inline bool toScheduledEvent(const uint8_t* data, int size, uint32_t sampleOffset, ScheduledEvent& event)
+{
+    if (data == nullptr || size < 1) {
+        return false;
+    }
+
+    const uint8_t status = data[0] & 0xF0;
+    const int data1 = size > 1 ? (data[1] & 0x7F) : 0;
+    const int data2 = size > 2 ? (data[2] & 0x7F) : 0;
+
+    event = ScheduledEvent{};
+    event.sampleOffset = sampleOffset;
+
+    switch (status) {
+        case 0x80:
+            event.type = ScheduledEvent::NOTE_OFF;
+            event.data.note.midiNote = data1;
+            event.data.note.velocity = 0.0f;
+            return true;
+
+        case 0x90:
+            event.type = data2 > 0 ? ScheduledEvent::NOTE_ON : ScheduledEvent::NOTE_OFF;
+            event.data.note.midiNote = data1;
+            event.data.note.velocity = data2 / 127.0f;
+            return true;
+
+        case 0xB0:
+            if (data1 == MIDI_CC_ALL_SOUND_OFF) {
+                event.type = ScheduledEvent::RESET;
+            } else {
+                event.type = ScheduledEvent::CONTROL_CHANGE;
+                event.data.controlChange.controllerNumber = data1;
+                event.data.controlChange.value = data2 / 127.0f;
+            }
+            return true;
+
+        case 0xC0:
+            event.type = ScheduledEvent::PROGRAM_CHANGE;
+            event.data.programChange.programNumber = data1;
+            return true;
+
+        case 0xD0:
+            event.type = ScheduledEvent::CHANNEL_PRESSURE;
+            event.data.channelPressure.pressure = data1 / 127.0f;
+            return true;
+
+        case 0xE0:
+            event.type = ScheduledEvent::PITCH_BEND;
+            event.data.pitchBend.bendValue = static_cast<float>(((data2 << 7) | data1) - 8192) / 8192.0f;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+template <int Capacity>
+class ScheduledEventQueue
+{
+public:
+    static_assert(Capacity > 0, "ScheduledEventQueue needs a positive capacity");
+
+    /**
+     * @brief Insert an event in sample-offset order
+     * @return false if the queue is full (event not stored)
+     */
+    bool push(const ScheduledEvent& event)
+    {
+        if (size_ >= Capacity) {
+            return false;
+        }
+
+        // Hosts deliver MIDI in order, so this is normally a single compare
+        int insertIndex = size_;
+        while (insertIndex > 0 && events_[insertIndex - 1].sampleOffset > event.sampleOffset) {
+            events_[insertIndex] = events_[insertIndex - 1];
+            --insertIndex;
+        }
+
+        events_[insertIndex] = event;
+        ++size_;
+        return true;
+    }
+
+    /**
+     * @brief push(), flushing the queue into target.handleEvent() if full
+     *
+     * On overflow every queued event is applied immediately, in queue order,
+     * and the queue restarts with event. The flushed events land at the
+     * block start instead of on their offsets. Events must arrive sorted by
+     * sampleOffset (as hosts deliver them) for the overall order to hold.
+     * @return false if the queue had to be flushed (counted in overflowCount())
+     */
+    template <typename Target>
+    bool pushOrFlush(const ScheduledEvent& event, Target& target)
+    {
+        if (push(event)) {
+            return true;
+        }
+
+        for (int i = 0; i < size_; ++i) {
+            target.handleEvent(events_[i]);
+        }
+        clear();
+        push(event);
+
+        // Single writer (the audio thread); any thread may read
+        overflows_.store(overflows_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /** Number of pushOrFlush() overflows since construction (any thread) */
+    uint64_t overflowCount() const { return overflows_.load(std::memory_order_relaxed); }
+
+    void clear() { size_ = 0; }
+
+    int size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ >= Capacity; }
+    static constexpr int capacity() { return Capacity; }
+
+    const ScheduledEvent* data() const { return events_.data(); }
+    const ScheduledEvent& operator[](int index) const { return events_[index]; }
+
+private:
+    std::array<ScheduledEvent, Capacity> events_{};
+    int size_ = 0;
+    std::atomic<uint64_t> overflows_{0};
+};
+
+/**
+ * @brief Render dsp with events (sorted by sampleOffset) on their samples
+ *
+ * For engines whose process() takes no event list: the block is rendered in
+ * segments between event offsets. Offsets at or beyond numSamples are
+ * applied after the block. At most MaxChannels channels are rendered.
+ */
+template <int MaxChannels = 2>
+void processWithEvents(InstrumentDSP& dsp, float** outputs, int numChannels, int numSamples,
+                       const ScheduledEvent* events, int numEvents)
+{
+    numChannels = std::min(numChannels, MaxChannels);
+    float* segment[MaxChannels] = {};
+
+    int position = 0;
+    int e = 0;
+    while (position < numSamples) {
+        while (e < numEvents && static_cast<int>(events[e].sampleOffset) <= position) {
+            dsp.handleEvent(events[e++]);
+        }
+
+        const int end = e < numEvents ? std::min(static_cast<int>(events[e].sampleOffset), numSamples)
+                                      : numSamples;
+        for (int ch = 0; ch < numChannels; ++ch) {
+            segment[ch] = outputs[ch] + position;
+        }
+        dsp.process(segment, numChannels, end - position);
+        position = end;
+    }
+
+    for (; e < numEvents; ++e) {
+        dsp.handleEvent(events[e]);
+    }
+}
+
+} // namespace DSP
@@ -0,0 +1,72 @@
+/*
+ * ScratchArena.h
+ *
+ * Block-sized scratch buffers for InstrumentDSP implementations
+ *
+ * - prepare() carves N buffers of the host's maximum block size out of one
+ *   allocation (each 32-byte aligned); process() only hands out pointers
+ * - forEachChunk() splits a host block into chunks no larger than the
+ *   prepared size, so engines accept any block size without overflowing
+ *   their scratch
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+namespace DSP {
+
+class ScratchArena
+{
+public:
+    static constexpr int ALIGNMENT_FLOATS = 8;  // 32 bytes
+
+    /**
+     * @brief Allocate numBuffers buffers of maxBlockSize samples
+     *
+     * The only allocation; call from prepare() / the constructor.
+     */
+    void prepare(int maxBlockSize, int numBuffers)
+    {
+        maxBlockSize_ = std::max(1, maxBlockSize);
+        numBuffers_ = std::max(1, numBuffers);
+        stride_ = (maxBlockSize_ + ALIGNMENT_FLOATS - 1) / ALIGNMENT_FLOATS * ALIGNMENT_FLOATS;
+        storage_.assign(static_cast<size_t>(stride_) * numBuffers_ + ALIGNMENT_FLOATS, 0.0f);
+
+        // Align the first buffer; the stride keeps the rest aligned
+        const auto address = reinterpret_cast<std::uintptr_t>(storage_.data());
+        const size_t misalignment = (address / sizeof(float)) % ALIGNMENT_FLOATS;
+        base_ = storage_.data() + (misalignment == 0 ? 0 : ALIGNMENT_FLOATS - misalignment);
+    }
+
+    int getMaxBlockSize() const { return maxBlockSize_; }
+    int getNumBuffers() const { return numBuffers_; }
+
+    float* getBuffer(int index)
+    {
+        return base_ + static_cast<size_t>(stride_) * static_cast<size_t>(index);
+    }
+
+    /** @brief Call fn(offset, length) for consecutive chunks of at most getMaxBlockSize() */
+    template <typename Fn>
+    void forEachChunk(int numSamples, Fn&& fn) const
+    {
+        for (int offset = 0; offset < numSamples; offset += maxBlockSize_) {
+            fn(offset, std::min(maxBlockSize_, numSamples - offset));
+        }
+    }
+
+private:
+    std::vector<float> storage_;
+    float* base_ = nullptr;
+    int maxBlockSize_ = 0;
+    int numBuffers_ = 0;
+    int stride_ = 0;
+};
+
+} // namespace DSP
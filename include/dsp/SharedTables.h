@@ -0,0 +1,142 @@
+/*
+ * SharedTables.h
+ *
+ * Process-wide function tables shared by every engine and plugin instance
+ *
+ * - SineTable: 2048-point sine with a guard point, read in cycles (~1e-6)
+ * - SharedTables: radian sin / cos on SineTable and MIDI note -> Hz
+ *
+ * Both are built once per binary by the first get() (thread-safe static
+ * initialization) and shared read-only by every instance, about 9 KB in
+ * total however many the host loads; engines call get() from prepare() so
+ * the build never lands on the audio thread. Tables are cache-line aligned.
+ *
+ * Nothing here is per sample rate: filter coefficients depend on the rate
+ * only through hz / fs, and ResonatorCoefficients measures no faster from
+ * a table than from sinf / cosf, so there are no per-rate grids to build
+ * or share. Not tabulated for the
+ * same reason: tanh (the rational fastTanh() in NatureKernels.h touches no
+ * memory) and exp2 / pow. nature-bench micro/tables compares each table
+ * with the libm call it replaces.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <cmath>
+
+namespace DSP {
+
+//==============================================================================
+// Sine Table
+//==============================================================================
+
+class SineTable
+{
+public:
+    static constexpr int SIZE = 2048;
+
+    static const SineTable& get()
+    {
+        static const SineTable table;
+        return table;
+    }
+
+    /** phase in cycles, must be in [0, 1) */
+    float lookup(float phase) const
+    {
+        const float position = phase * static_cast<float>(SIZE);
+        const int index = static_cast<int>(position);
+        const float frac = position - static_cast<float>(index);
+        const float a = table_[index & (SIZE - 1)];
+        const float b = table_[(index & (SIZE - 1)) + 1];
+        return a + frac * (b - a);
+    }
+
+    /** SIZE + 1 points (the last is a guard copy of the first) */
+    const float* data() const { return table_; }
+
+    /** phase in cycles, any range */
+    float lookupWrapped(float phase) const
+    {
+        return lookup(phase - static_cast<float>(floorToInt(phase)));
+    }
+
+    /** @brief floor for |x| < 2^31 without a libm call (no SSE4.1 round in the baseline) */
+    static int floorToInt(float x)
+    {
+        const int truncated = static_cast<int>(x);
+        return truncated - (x < static_cast<float>(truncated) ? 1 : 0);
+    }
+
+private:
+    SineTable()
+    {
+        for (int i = 0; i <= SIZE; ++i) {
+            table_[i] = static_cast<float>(std::sin(2.0 * M_PI * i / SIZE));
+        }
+    }
+
+    alignas(64) float table_[SIZE + 1];
+};
+
+//==============================================================================
+// Shared Tables
+//==============================================================================
+
+class SharedTables
+{
+public:
+    static constexpr int NUM_MIDI_NOTES = 128;
+
+    static const SharedTables& get()
+    {
+        static const SharedTables tables;
+        return tables;
+    }
+
+    /** @brief sin(radians), any range */
+    float sin(float radians) const
+    {
+        return sine_.lookupWrapped(radians * INV_TWO_PI);
+    }
+
+    /** @brief cos(radians), any range */
+    float cos(float radians) const
+    {
+        return sine_.lookupWrapped(radians * INV_TWO_PI + 0.25f);
+    }
+
+    /**
+     * @brief Equal-tempered frequency of a (fractional) MIDI note, A4 = 440 Hz
+     *
+     * Whole notes 0..127 (every note-on) are a single load; the fraction
+     * (pitch bend, detune) and notes outside the MIDI range use std::exp2.
+     */
+    float midiToFrequency(float note) const
+    {
+        if (note >= 0.0f && note < static_cast<float>(NUM_MIDI_NOTES)) {
+            const int whole = static_cast<int>(note);
+            const float frac = note - static_cast<float>(whole);
+            return frac == 0.0f ? midiHz_[whole] : midiHz_[whole] * std::exp2(frac * (1.0f / 12.0f));
+        }
+        return 440.0f * std::exp2((note - 69.0f) * (1.0f / 12.0f));
+    }
+
+private:
+    static constexpr float INV_TWO_PI = static_cast<float>(1.0 / (2.0 * M_PI));
+
+    SharedTables()
+        : sine_(SineTable::get())
+    {
+        for (int note = 0; note < NUM_MIDI_NOTES; ++note) {
+            midiHz_[note] = static_cast<float>(440.0 * std::exp2((note - 69) / 12.0));
+        }
+    }
+
+    const SineTable& sine_;
+    alignas(64) float midiHz_[NUM_MIDI_NOTES];
+};
+
+} // namespace DSP
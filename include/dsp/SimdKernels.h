@@ -0,0 +1,80 @@
+/*
+ * SimdKernels.h
+ *
+ * Runtime-dispatched SIMD block kernels for the nature_dsp library
+ *
+ * - Each kernel is compiled once per instruction set in its own
+ *   translation unit (src/dsp/simd/SimdKernels_<ISA>.cpp) with that ISA's
+ *   compiler flags, so one binary carries SSE2, AVX2 and AVX-512 variants
+ *   on x86 and NEON on ARM
+ * - selectSimdKernels() detects the CPU once and returns the best table;
+ *   engines call it from prepare() and keep the pointer, so the audio
+ *   thread pays one indirect call per kernel per block and never detects
+ * - setSimdLevelOverride() (or NATURE_DSP_SIMD=scalar|sse2|avx2|avx512|neon
+ *   in the environment) caps the level for A/B testing; Scalar forces the
+ *   portable reference kernels. Engines pick it up at their next prepare()
+ *
+ * Vector variants are not bit-identical to the scalar kernels: the sine
+ * bank advances phases a vector at a time, so the accumulated phase
+ * rounds differently (a few thousandths of a cycle apart after seconds,
+ * amplitude unaffected). Force Scalar to reproduce the original output.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+namespace DSP {
+
+enum class SimdLevel { Scalar = 0, SSE2, AVX2, AVX512, NEON };
+
+struct SimdKernels
+{
+    SimdLevel level;
+    const char* name;
+
+    /** @brief dst[i] += src[i] * gain[i] */
+    void (*multiplyAdd)(float* dst, const float* src, const float* gain, int numSamples);
+
+    /** @brief max(|src[i]|), 0 for an empty block */
+    float (*peak)(const float* src, int numSamples);
+
+    /**
+     * @brief output[i] += outputGain * sum_k gains[k] * sin(2pi * phase_k)
+     *
+     * Linear interpolation into a tableSize-point sine table (tableSize a
+     * power of two, table[tableSize] a guard point). Phases are in cycles
+     * [0, 1) and are advanced by increments[k] per sample.
+     */
+    void (*sineBank)(const float* table, int tableSize, float* phases, const float* increments,
+                     const float* gains, int count, float outputGain, float* output, int numSamples);
+};
+
+/** @brief Best level this CPU supports among the variants compiled into this build */
+SimdLevel detectSimdLevel();
+
+/**
+ * @brief Kernels for a level, falling back to the best available level below it
+ *
+ * Never returns a variant the CPU cannot run.
+ */
+const SimdKernels& getSimdKernels(SimdLevel level);
+
+/** @brief Detected level capped by the override; call from prepare(), not per block */
+const SimdKernels& selectSimdKernels();
+
+/**
+ * @brief Cap the level selectSimdKernels() returns (process-wide)
+ *
+ * Takes precedence over NATURE_DSP_SIMD; clearSimdLevelOverride() returns
+ * to the environment / detected level.
+ */
+void setSimdLevelOverride(SimdLevel maximum);
+void clearSimdLevelOverride();
+
+const char* getSimdLevelName(SimdLevel level);
+
+/** @brief "scalar", "sse2", "avx2", "avx512" or "neon" (case-insensitive) */
+bool parseSimdLevel(const char* text, SimdLevel& level);
+
+} // namespace DSP
@@ -0,0 +1,297 @@
+/*
+ * VoiceRenderPool.h
+ *
+ * Real-time work-stealing pool for parallel voice rendering
+ *
+ * - Worker threads are created (and optionally pinned to cores) in start(),
+ *   never on the audio thread
+ * - run() splits tasks [0, numTasks) evenly across the calling thread and
+ *   the workers, one range per participant; a participant that runs out
+ *   steals single tasks from the back of the others' ranges. Each range is
+ *   one atomic word (generation | begin | end), so claiming a task is a
+ *   single CAS: no locks and no allocation
+ * - Idle workers spin for a while after each job, then park on a futex
+ *   (std::atomic::wait); run() only issues a wake-up when someone is parked
+ * - The caller always takes part and run() returns once every task is done.
+ *   If the pool is already running a job (another engine sharing it), the
+ *   caller renders all tasks itself instead of waiting
+ *
+ * Determinism: tasks must write only their own outputs (one buffer per
+ * voice); the caller sums them in a fixed order afterwards, so the result
+ * does not depend on which thread ran which task.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "DenormalGuard.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace DSP {
+
+class VoiceRenderPool
+{
+public:
+    static constexpr int MAX_WORKERS = 15;
+    static constexpr int MAX_PARTICIPANTS = MAX_WORKERS + 1;  // Workers + calling thread
+    static constexpr int MAX_TASKS = 0xffff;
+
+    /** task is in [0, numTasks); participant 0 is the calling thread */
+    using TaskFunction = void (*)(void* context, int task, int participant);
+
+    /**
+     * Pool configuration.
+     *
+     * Engines split their renders around serial stages: the Aether shared
+     * bridge and sympathetic string bank need every voice's bridge input for
+     * the chunk, so coupled rendering dispatches twice per coupling chunk
+     * with the bridge in between as a sync point. Short host blocks or few
+     * active voices therefore gain less than the worker count suggests.
+     */
+    struct Config
+    {
+        int numWorkers = 0;           // <= 0: hardware threads - 1
+        bool pinWorkers = true;       // One core per worker (Linux; ignored elsewhere)
+        int firstCore = 1;            // Worker i is pinned to core firstCore + i
+        bool realtimePriority = true; // Try SCHED_FIFO; keeps normal priority if refused
+        int spinIterations = 20000;   // Spins after a job before parking
+    };
+
+    VoiceRenderPool() = default;
+    ~VoiceRenderPool() { stop(); }
+
+    VoiceRenderPool(const VoiceRenderPool&) = delete;
+    VoiceRenderPool& operator=(const VoiceRenderPool&) = delete;
+
+    /** @brief Non-audio thread: (re)start the workers */
+    void start() { start(Config{}); }
+
+    void start(const Config& config)
+    {
+        stop();
+
+        int workers = config.numWorkers;
+        if (workers <= 0) {
+            workers = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+        }
+        numWorkers_ = std::clamp(workers, 0, MAX_WORKERS);
+        spinIterations_ = std::max(0, config.spinIterations);
+        running_.store(true, std::memory_order_release);
+
+        threads_.reserve(static_cast<size_t>(numWorkers_));
+        for (int i = 0; i < numWorkers_; ++i) {
+            threads_.emplace_back([this, i] { workerLoop(i + 1); });
+            configureThread(threads_.back(), config, i);
+        }
+    }
+
+    /** @brief Non-audio thread, no job in flight: join the workers */
+    void stop()
+    {
+        if (threads_.empty()) {
+            numWorkers_ = 0;
+            return;
+        }
+        running_.store(false, std::memory_order_release);
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        generation_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+        threads_.clear();
+        numWorkers_ = 0;
+    }
+
+    int getNumWorkers() const { return numWorkers_; }
+    int getNumParticipants() const { return numWorkers_ + 1; }
+
+    /**
+     * @brief Audio thread: run fn(context, task, participant) for every task
+     *        and return when all have finished
+     */
+    void run(TaskFunction fn, void* context, int numTasks)
+    {
+        if (numTasks <= 0) {
+            return;
+        }
+
+        if (numWorkers_ == 0 || numTasks == 1 || numTasks > MAX_TASKS
+            || busy_.exchange(true, std::memory_order_acquire)) {
+            for (int task = 0; task < numTasks; ++task) {
+                fn(context, task, 0);
+            }
+            return;
+        }
+
+        function_ = fn;
+        context_ = context;
+        remaining_.store(numTasks, std::memory_order_relaxed);
+
+        // Even split, earlier participants take the remainder
+        const uint32_t generation = generation_.load(std::memory_order_relaxed) + 1;
+        const int participants = std::min(getNumParticipants(), numTasks);
+        int begin = 0;
+        for (int p = 0; p < MAX_PARTICIPANTS; ++p) {
+            int count = 0;
+            if (p < participants) {
+                count = numTasks / participants + (p < numTasks % participants ? 1 : 0);
+            }
+            ranges_[static_cast<size_t>(p)].word.store(pack(generation, begin, begin + count),
+                                                       std::memory_order_relaxed);
+            begin += count;
+        }
+
+        // seq_cst pairs with the worker's parked_ increment: either it sees
+        // the new generation or this sees it parked
+        generation_.store(generation, std::memory_order_seq_cst);
+        if (parked_.load(std::memory_order_seq_cst) > 0) {
+            generation_.notify_all();
+        }
+
+        runTasks(0, generation);
+
+        // Tasks still running on workers finish shortly
+        while (remaining_.load(std::memory_order_acquire) > 0) {
+            pause();
+        }
+
+        busy_.store(false, std::memory_order_release);
+    }
+
+private:
+    struct alignas(64) Range
+    {
+        std::atomic<uint64_t> word{0};
+    };
+
+    static uint64_t pack(uint32_t generation, int begin, int end)
+    {
+        return (static_cast<uint64_t>(generation) << 32)
+               | (static_cast<uint64_t>(begin) << 16) | static_cast<uint64_t>(end);
+    }
+    static uint32_t generationOf(uint64_t word) { return static_cast<uint32_t>(word >> 32); }
+    static int beginOf(uint64_t word) { return static_cast<int>((word >> 16) & 0xffff); }
+    static int endOf(uint64_t word) { return static_cast<int>(word & 0xffff); }
+
+    static void pause()
+    {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // Own range from the front, then steal from the back of the others'
+    void runTasks(int participant, uint32_t generation)
+    {
+        for (int offset = 0; offset < MAX_PARTICIPANTS; ++offset) {
+            const int victim = (participant + offset) % MAX_PARTICIPANTS;
+            const bool own = offset == 0;
+            auto& word = ranges_[static_cast<size_t>(victim)].word;
+
+            uint64_t current = word.load(std::memory_order_acquire);
+            while (generationOf(current) == generation && beginOf(current) < endOf(current)) {
+                const int begin = beginOf(current);
+                const int end = endOf(current);
+                const int task = own ? begin : end - 1;
+                const uint64_t next = own ? pack(generation, begin + 1, end)
+                                          : pack(generation, begin, end - 1);
+
+                if (word.compare_exchange_weak(current, next, std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+                    function_(context_, task, participant);
+                    remaining_.fetch_sub(1, std::memory_order_release);
+                    current = word.load(std::memory_order_acquire);
+                }
+            }
+        }
+    }
+
+    void workerLoop(int participant)
+    {
+        // Flush-to-zero is per thread: workers render voices too
+        ScopedFlushDenormals noDenormals;
+        uint32_t seen = generation_.load(std::memory_order_acquire);
+
+        while (true) {
+            // A worker scheduled only after stop() bumped the generation
+            // already counts that bump as seen: check running_ before parking
+            if (!running_.load(std::memory_order_acquire)) {
+                return;
+            }
+
+            // Spin, then park until the next job
+            uint32_t generation = generation_.load(std::memory_order_acquire);
+            for (int spin = 0; generation == seen && spin < spinIterations_; ++spin) {
+                pause();
+                generation = generation_.load(std::memory_order_acquire);
+            }
+            if (generation == seen) {
+                parked_.fetch_add(1, std::memory_order_seq_cst);
+                generation_.wait(seen, std::memory_order_seq_cst);
+                parked_.fetch_sub(1, std::memory_order_acq_rel);
+                generation = generation_.load(std::memory_order_acquire);
+            }
+
+            if (!running_.load(std::memory_order_acquire)) {
+                return;
+            }
+            seen = generation;
+            runTasks(participant, generation);
+        }
+    }
+
+    static void configureThread(std::thread& thread, const Config& config, int workerIndex)
+    {
+#if defined(__linux__)
+        if (config.pinWorkers) {
+            const int cores = static_cast<int>(std::thread::hardware_concurrency());
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cores > 0 ? (config.firstCore + workerIndex) % cores : 0, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+        }
+        if (config.realtimePriority) {
+            sched_param param{};
+            param.sched_priority = std::max(1, sched_get_priority_max(SCHED_FIFO) - 1);
+            pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param);
+        }
+#else
+        (void)thread;
+        (void)config;
+        (void)workerIndex;
+#endif
+    }
+
+    std::vector<std::thread> threads_;
+    int numWorkers_ = 0;
+    int spinIterations_ = 0;
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> busy_{false};
+    std::atomic<uint32_t> generation_{0};
+    std::atomic<int> parked_{0};
+    alignas(64) std::atomic<int> remaining_{0};
+
+    TaskFunction function_ = nullptr;
+    void* context_ = nullptr;
+    std::array<Range, MAX_PARTICIPANTS> ranges_{};
+};
+
+} // namespace DSP
@@ -0,0 +1,122 @@
+/*
+ * WavetableBank.h
+ *
+ * Mipmapped band-limited wavetables for the classic analog shapes
+ *
+ * - One table per octave: level L holds MAX_HARMONICS >> L harmonics, so a
+ *   phase increment dt plays level levelForIncrement(dt) without aliasing
+ * - Tables are summed additively once per process and shared read-only by
+ *   every oscillator instance; call get() from prepare() so the build never
+ *   happens on the audio thread
+ * - Lookup is linear interpolation with a guard point (no wrap branch)
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+namespace DSP {
+
+class WavetableBank
+{
+public:
+    enum Shape { SAW = 0, SQUARE, TRIANGLE, NUM_SHAPES };
+
+    static constexpr int TABLE_SIZE = 4096;
+    static constexpr int MAX_HARMONICS = 1024;
+    static constexpr int NUM_LEVELS = 11;  // 1024 harmonics down to 1
+
+    static const WavetableBank& get()
+    {
+        static const WavetableBank bank;
+        return bank;
+    }
+
+    /** @brief Mip level whose highest harmonic stays below Nyquist at dt cycles/sample */
+    static int levelForIncrement(double dt)
+    {
+        // Need (MAX_HARMONICS >> level) * dt <= 0.5, i.e. level >= log2(2 * MAX_HARMONICS * dt)
+        const double x = std::abs(dt) * (2.0 * MAX_HARMONICS);
+        if (x <= 1.0) {
+            return 0;
+        }
+        int exponent = 0;
+        const double mantissa = std::frexp(x, &exponent);  // x = mantissa * 2^exponent
+        const int level = (mantissa > 0.5) ? exponent : exponent - 1;
+        return std::min(level, NUM_LEVELS - 1);
+    }
+
+    /** TABLE_SIZE + 1 samples (last is a copy of the first) */
+    const float* table(Shape shape, int level) const
+    {
+        return tables_.data() + static_cast<size_t>(shape * NUM_LEVELS + level) * (TABLE_SIZE + 1);
+    }
+
+    /** phase in cycles, must be in [0, 1) */
+    static float lookup(const float* table, double phase)
+    {
+        const double position = phase * TABLE_SIZE;
+        const int index = std::min(static_cast<int>(position), TABLE_SIZE - 1);
+        const float frac = static_cast<float>(position - index);
+        return table[index] + frac * (table[index + 1] - table[index]);
+    }
+
+private:
+    WavetableBank()
+        : tables_(static_cast<size_t>(NUM_SHAPES * NUM_LEVELS) * (TABLE_SIZE + 1), 0.0f)
+    {
+        std::vector<double> sine(TABLE_SIZE), cosine(TABLE_SIZE), sum(TABLE_SIZE);
+        for (int n = 0; n < TABLE_SIZE; ++n) {
+            sine[n] = std::sin(2.0 * M_PI * n / TABLE_SIZE);
+            cosine[n] = std::cos(2.0 * M_PI * n / TABLE_SIZE);
+        }
+
+        for (int shape = 0; shape < NUM_SHAPES; ++shape) {
+            for (int level = 0; level < NUM_LEVELS; ++level) {
+                const int harmonics = MAX_HARMONICS >> level;
+                std::fill(sum.begin(), sum.end(), 0.0);
+
+                for (int k = 1; k <= harmonics; ++k) {
+                    // Fourier series of the naive shapes the oscillator used:
+                    // saw 2p-1, square +1/-1 at 0.5, triangle 2|2p-1|-1
+                    double amplitude = 0.0;
+                    const std::vector<double>* basis = &sine;
+                    switch (shape) {
+                        case SAW:
+                            amplitude = -2.0 / (M_PI * k);
+                            break;
+                        case SQUARE:
+                            amplitude = (k & 1) ? 4.0 / (M_PI * k) : 0.0;
+                            break;
+                        case TRIANGLE:
+                            amplitude = (k & 1) ? 8.0 / (M_PI * M_PI * k * k) : 0.0;
+                            basis = &cosine;
+                            break;
+                    }
+                    if (amplitude == 0.0) {
+                        continue;
+                    }
+
+                    const std::vector<double>& b = *basis;
+                    for (int n = 0; n < TABLE_SIZE; ++n) {
+                        sum[n] += amplitude * b[(static_cast<size_t>(k) * n) & (TABLE_SIZE - 1)];
+                    }
+                }
+
+                float* dst = tables_.data() + static_cast<size_t>(shape * NUM_LEVELS + level) * (TABLE_SIZE + 1);
+                for (int n = 0; n < TABLE_SIZE; ++n) {
+                    dst[n] = static_cast<float>(sum[n]);
+                }
+                dst[TABLE_SIZE] = dst[0];
+            }
+        }
+    }
+
+    std::vector<float> tables_;
+};
+
+} // namespace DSP
@@ -24,6 +24,15 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "../../../../include/dsp/ScratchArena.h"
+#include "../../../../include/dsp/DelayLine.h"
+#include "../../../../include/dsp/PhysicalModelCore.h"
+#include "../../../../include/dsp/NatureKernels.h"
+#include "../../../../include/dsp/Oversampler.h"
+#include "../../../../include/dsp/PresetFormat.h"
+#include "../../../../include/dsp/VoiceRenderPool.h"
+#include "../../../../include/dsp/RealtimeTelemetry.h"
+#include "../../../../include/dsp/DenormalGuard.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -38,7 +47,6 @@ namespace DSP {
 //==============================================================================
 
 class AetherVoiceManager;
-class Pedalboard;
 class SharedBridgeCoupling;
 class SympatheticStringBank;
 
@@ -46,33 +54,6 @@ class SympatheticStringBank;
 // Pure DSP Building Blocks (JUCE-free implementations)
 //==============================================================================
 
-/**
- * @brief Fractional delay line with Lagrange interpolation
- */
-class FractionalDelayLine
-{
-public:
-    FractionalDelayLine();
-    ~FractionalDelayLine() = default;
-
-    void prepare(double sampleRate, int maximumDelay);
-    void reset();
-
-    void setDelay(float delayInSamples);
-    float popSample();
-    void pushSample(float sample);
-
-    float getDelay() const { return delay_; }
-    int getMaximumDelay() const { return maxDelay_; }
-
-private:
-    std::vector<float> buffer_;
-    int writeIndex_ = 0;
-    float delay_ = 0.0f;
-    int maxDelay_ = 0;
-    float interpolate(float fractionalDelay);
-};
-
 /**
  * @brief Topology-Preserving TPT Filter (Zolzer style)
  */
@@ -135,6 +116,9 @@ struct ModalFilter
      * Material factor affects overall brightness
      */
     float computeQ(float freq, float damping, float structure);
+
+    /** Per-sample energy decay implied by computedQ */
+    float getDecayFactor() const;
 };
 
 //==============================================================================
@@ -178,6 +162,12 @@ public:
     void excite(const float* exciterSignal, int exciterLength, float velocity);
     float processSample();
 
+    /** @brief Render numSamples of string output, moving the loop in delay-sized chunks */
+    void processBlock(float* output, int numSamples);
+
+    /** @brief As processBlock, with drive[i] * driveGain injected into the loop */
+    void processBlock(float* output, const float* drive, float driveGain, int numSamples);
+
     void setFrequency(float freq);
     void setDamping(float damping);
     void setStiffness(float stiffness);
@@ -194,14 +184,13 @@ public:
 
 private:
     Parameters params_;
-    FractionalDelayLine fractionalDelay_;
+    WaveguideLoop<DelayInterpolation::Lagrange3> loop_;
     TPTFilter stiffnessFilter_;
     TPTFilter dampingFilter_;
 
-    // Dispersion filters (3 cascaded allpass for realistic dispersion)
-    TPTFilter dispersionFilter1_;
-    TPTFilter dispersionFilter2_;
-    TPTFilter dispersionFilter3_;
+    // Dispersion filters (cascaded allpass for realistic dispersion)
+    static constexpr int DISPERSION_STAGES = 3;
+    FilterCascade<TPTFilter, DISPERSION_STAGES> dispersion_;
 
     // Sympathetic resonance state
     float sympatheticEnergy_ = 0.0f;
@@ -213,31 +202,15 @@ private:
     // Bridge impedance modeling
     float bridgeImpedance_ = 1000.0f;  // Ohms
     void updateBridgeImpedance();
+
+    /** Filters, bridge and sympathetic state for one delay output; returns the reflection */
+    float reflect(float output);
 };
 
 /**
- * @brief Bridge Coupling
+ * @brief Bridge Coupling (shared core)
  */
-class BridgeCoupling
-{
-public:
-    BridgeCoupling();
-    ~BridgeCoupling() = default;
-
-    void prepare(double sampleRate);
-    void reset();
-
-    float processString(float stringOutput);
-    float getBridgeEnergy() const { return bridgeEnergy_; }
-
-    void setCouplingCoefficient(float coeff) { couplingCoefficient_ = coeff; }
-    void setNonlinearity(float nonlinearity) { nonlinearity_ = nonlinearity; }
-
-private:
-    float couplingCoefficient_ = 0.3f;
-    float nonlinearity_ = 0.1f;
-    float bridgeEnergy_ = 0.0f;
-};
+using BridgeCoupling = NonlinearBridge;
 
 /**
  * @brief Modal Body Resonator with per-mode Q calculation
@@ -246,6 +219,10 @@ private:
  * - Frequency-dependent damping per mode
  * - Material parameter (wood vs metal)
  * - Realistic decay profiles
+ *
+ * modes_ holds the mode parameters; processing runs on a SoA
+ * ModalResonatorBank whose coefficients are rebuilt (updateBank) only when
+ * a preset, material, Q or resonance change touches them.
  */
 class ModalBodyResonator
 {
@@ -269,10 +246,16 @@ public:
     // Advanced: Re-calculate Q values for all modes based on material
     void recalculateModeQ(float damping, float structure);
 
+    static constexpr int MAX_MODES = 16;
+
 private:
-    std::vector<ModalFilter> modes_;
+    ModalBank<ModalFilter, MAX_MODES> modes_;
+    ModalResonatorBank<MAX_MODES> bank_;
+    float outputScale_ = 0.0f;  // 1 / number of modes
     double sr = 48000.0;
     MaterialType material_ = MaterialType::StandardWood;
+
+    void updateBank();
 };
 
 //==============================================================================
@@ -328,6 +311,13 @@ private:
 // v2: Giant Instrument Features
 //==============================================================================
 
+/**
+ * @brief One bridge shared by every voice
+ *
+ * processBlock() is the global coupling stage: each sample, all voices'
+ * string energies are summed and saturated once into the bridge motion
+ * that every body and the sympathetic bank read.
+ */
 class SharedBridgeCoupling
 {
 public:
@@ -340,6 +330,9 @@ public:
     float addStringEnergy(float stringEnergy, int voiceIndex);
     float getBridgeMotion() const;
 
+    /** @brief motion[i] = tanh(0.3 * sum over voices of inputs[v][i]) */
+    void processBlock(const float* const* voiceInputs, int numVoices, float* motion, int numSamples);
+
 private:
     std::vector<float> bridgeEnergies_;
     float totalBridgeMotion_ = 0.0f;
@@ -365,7 +358,20 @@ public:
     void exciteFromBridge(float bridgeEnergy);
     float processSample();
 
+    /**
+     * @brief Drive every string with the bridge motion for numSamples
+     *
+     * String-major: each string runs its whole block through the block
+     * delay loop, so cost is strings x samples regardless of voice count.
+     */
+    void processBlock(const float* bridgeMotion, float* output, int numSamples);
+
+    bool isEnabled() const { return enabled_ && !strings_.empty(); }
+
 private:
+    static constexpr float BRIDGE_DRIVE_GAIN = 0.1f;
+    static constexpr int BLOCK_CHUNK_SIZE = 64;
+
     std::vector<WaveguideString> strings_;
     bool enabled_ = false;
     double sr = 48000.0;
@@ -377,14 +383,13 @@ private:
 
 struct AetherVoice
 {
+    static constexpr int STRING_CHUNK_SIZE = 64;
+
     WaveguideString string;
     BridgeCoupling bridge;
     ModalBodyResonator body;
     ArticulationStateMachine fsm;
 
-    Pedalboard* pedalboard = nullptr;
-    SharedBridgeCoupling* sharedBridge = nullptr;
-    SympatheticStringBank* sympatheticStrings = nullptr;
 
     bool isActive = false;
     int currentNote = 0;
@@ -395,6 +400,12 @@ struct AetherVoice
     void noteOn(int note, float velocity);
     void noteOff();
     void processBlock(float* output, int numSamples, double sampleRate);
+
+    // Coupled rendering (shared bridge), split around the global bridge stage:
+    // string + excitation into bridgeInput and the articulation gain per sample...
+    void renderBridgeInput(float* bridgeInput, float* gain, int numSamples, double sampleRate);
+    // ...then the body driven by the shared bridge motion
+    void renderFromBridge(const float* bridgeMotion, const float* gain, float* output, int numSamples);
 };
 
 class AetherVoiceManager
@@ -416,16 +427,79 @@ public:
     void processBlock(float* output, int numSamples, double sampleRate);
     int getActiveVoiceCount() const;
 
+    /** Per-voice render scratch (owner's arena); processBlock chunks to its size */
+    void setScratchBuffer(float* buffer, int size);
+
     void enableSharedBridge(bool enabled);
     void enableSympatheticStrings(const SympatheticStringBank::SympatheticStringConfig& config);
 
+    /**
+     * @brief Render voices on pool's workers (nullptr: serial, the default)
+     *
+     * Each voice renders into its own buffer and the buffers are summed in
+     * voice order, so the result does not depend on scheduling. Coupled
+     * rendering dispatches twice per coupling chunk: the shared bridge runs
+     * serially between the stages, and the sympathetic bank renders as one
+     * more task alongside the bodies.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { renderPool_ = pool; }
+
+    /**
+     * @brief Owner's telemetry (nullptr: none)
+     *
+     * Voices, or Voices + Body when coupled (the bridge and the bodies are
+     * separate stages there; otherwise bodies run inside each voice).
+     * Timed on the calling thread around each dispatch.
+     */
+    void setTelemetry(Telemetry* telemetry) { telemetry_ = telemetry; }
+
     // Apply parameters to all voices (called by loadPreset)
     void applyVoiceParameters(const AetherPureDSP& dsp);
 
 private:
-    std::array<AetherVoice, 6> voices_;
+    static constexpr int NUM_VOICES = 6;
+    static constexpr int COUPLING_CHUNK_SIZE = 64;
+
+    std::array<AetherVoice, NUM_VOICES> voices_;
     std::unique_ptr<SharedBridgeCoupling> sharedBridge_;
     std::unique_ptr<SympatheticStringBank> sympatheticStrings_;
+    double sampleRate_ = 48000.0;
+
+    // Global bridge stage state, one chunk at a time
+    alignas(32) float bridgeInputs_[NUM_VOICES][COUPLING_CHUNK_SIZE];
+    alignas(32) float voiceGains_[NUM_VOICES][COUPLING_CHUNK_SIZE];
+    alignas(32) float bridgeMotion_[COUPLING_CHUNK_SIZE];
+    alignas(32) float sympatheticOut_[COUPLING_CHUNK_SIZE];
+
+    void processCoupledBlock(float* output, int numSamples, double sampleRate);
+
+    // Parallel rendering: one job per dispatch, read by renderTask()
+    enum class RenderStage { Voice, BridgeInput, FromBridge };
+    struct RenderJob
+    {
+        RenderStage stage = RenderStage::Voice;
+        int voices[NUM_VOICES] = {};
+        int numVoices = 0;
+        int numSamples = 0;
+        double sampleRate = 48000.0;
+        bool sympathetic = false;  // FromBridge: task numVoices is the sympathetic bank
+    };
+
+    VoiceRenderPool* renderPool_ = nullptr;
+    Telemetry* telemetry_ = nullptr;
+    RenderJob job_;
+    ScratchArena voiceOutputs_;  // One buffer per voice, sized in prepare()
+
+    bool isParallel() const { return renderPool_ != nullptr && renderPool_->getNumWorkers() > 0; }
+    void processParallelBlock(float* output, int numSamples, double sampleRate);
+    void dispatch(RenderStage stage, int numTasks);
+    static void renderTask(void* context, int task, int participant);
+
+    // One scratch buffer reused by every voice in turn
+    static constexpr int FALLBACK_BUFFER_SIZE = 64;
+    float* voiceBuffer_ = fallbackVoiceBuffer_;
+    int voiceBufferSize_ = FALLBACK_BUFFER_SIZE;
+    alignas(32) float fallbackVoiceBuffer_[FALLBACK_BUFFER_SIZE];
 };
 
 //==============================================================================
@@ -441,12 +515,20 @@ public:
     RATDistortion();
     ~RATDistortion() = default;
 
-    void prepare(double sampleRate);
+    void prepare(double sampleRate, int maxBlockSize = 512);
     void reset();
 
     void setDiodeType(DiodeType type);
     float processSample(float input);
 
+    /**
+     * @brief Block version of processSample: tone cutoff set once per block,
+     *        clipper oversampled (setOversampling) with a rational tanh
+     */
+    void processBlock(const float* input, float* output, int numSamples);
+
+    void setOversampling(int factor) { oversampler_.setFactor(factor); }
+
     float drive = 1.0f;
     float filter = 0.5f;
     float output = 1.0f;
@@ -457,6 +539,7 @@ private:
     float asymmetry = 1.0f;
     TPTFilter preFilter_;
     TPTFilter toneFilter_;
+    Oversampler oversampler_;
     double sr = 48000.0;
 };
 
@@ -469,8 +552,21 @@ struct Pedal
     float mix = 1.0f;
     RATDistortion rat;
 
-    void prepare(double sampleRate);
+    // Block path nonlinearities run oversampled (1x / 2x / 4x / 8x)
+    Oversampler oversampler;
+    HardClipADAA clipper;
+
+    void prepare(double sampleRate, int maxBlockSize = 512);
     float processSample(float input);
+    void setOversampling(int factor);
+
+    /** True when processing would return the input unchanged */
+    bool isPassThrough() const;
+
+    /**
+     * @brief Process buffer in place; wet must hold numSamples (used when mix < 1)
+     */
+    void processBlock(float* buffer, float* wet, int numSamples);
 };
 
 class Pedalboard
@@ -479,19 +575,41 @@ public:
     Pedalboard();
     ~Pedalboard() = default;
 
+    static constexpr int NUM_PEDALS = 8;
+
     void prepare(double sampleRate, int samplesPerBlock);
     void reset();
 
     float processSample(float input);
 
+    /** @brief Process the summed voice bus in place, once per block */
+    void processBlock(float* buffer, int numSamples);
+
     void setPedal(int index, PedalType type, bool enable);
     void setRouting(int index, int pedalIndex);
-    void setParallelMode(bool parallel) { parallelMode_ = parallel; }
+    void setParallelMode(bool parallel);
+
+    /** Pedal nonlinearity oversampling: 1 (live) up to 8 (offline render) */
+    void setOversampling(int factor);
+    int getOversampling() const { return oversampling_; }
+
+    /** Pedals that actually run, in routing order */
+    int getChainLength() const { return chainLength_; }
 
 private:
-    std::array<Pedal, 8> pedals_;
-    std::array<int, 8> routingOrder_ = {0, 1, 2, 3, 4, 5, 6, 7};
+    enum ScratchBuffer { SCRATCH_DRY = 0, SCRATCH_WET, SCRATCH_SUM, NUM_SCRATCH_BUFFERS };
+
+    std::array<Pedal, NUM_PEDALS> pedals_;
+    std::array<int, NUM_PEDALS> routingOrder_ = {0, 1, 2, 3, 4, 5, 6, 7};
     bool parallelMode_ = false;
+    int oversampling_ = 1;
+
+    // Flat chain resolved from routing / enables at configuration time
+    std::array<int, NUM_PEDALS> chain_{};
+    int chainLength_ = 0;
+    ScratchArena scratch_;
+
+    void rebuildChain();
 };
 
 //==============================================================================
@@ -525,6 +643,25 @@ public:
     void enableSympatheticStrings(bool enabled);
     void setPedal(int index, PedalType type, bool enable);
 
+    /**
+     * @brief Opt-in parallel voice rendering (nullptr: serial)
+     *
+     * Set while audio is stopped; pool must outlive its use here. Pedals
+     * still run once on the summed voices.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { voiceManager_.setRenderPool(pool); }
+
+    /**
+     * @brief Audio-thread cost and event counters (see RealtimeTelemetry.h)
+     *
+     * Safe from any thread. Stages used: Voices, Body (coupled bridge and
+     * bodies), Effects (pedalboard). All zero when built with
+     * NATURE_DSP_TELEMETRY=0.
+     */
+    TelemetryStageStats getStageTelemetry(TelemetryStage stage) const { return telemetry_.getStageStats(stage); }
+    uint64_t getTelemetryEventCount(TelemetryEvent event) const { return telemetry_.getEventCount(event); }
+    void resetTelemetry() { telemetry_.requestReset(); }
+
     // Expose parameters publicly for easier access by voice manager
     struct Parameters
     {
@@ -551,25 +688,29 @@ public:
         double sympatheticCoupling = 0.1;  // Sympathetic resonance (0-1)
         double material = 1.0;  // Material factor (0.5=soft wood, 1.0=standard, 1.5=bright metal)
         int bodyPreset = 0;  // 0=guitar, 1=piano, 2=orchestral
+        int pedalOversampling = 1;  // Pedal nonlinearity oversampling: 1, 2, 4 or 8
     } params_;
 
 private:
     AetherVoiceManager voiceManager_;
     Pedalboard pedalboard_;
+    Telemetry telemetry_;
 
     double sampleRate_ = 48000.0;
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
 
-    // Real-time safe temporary buffer for audio processing
-    static constexpr int MAX_BLOCK_SIZE = 512;
-    alignas(32) float tempBuffer_[MAX_BLOCK_SIZE];
+    // Real-time safe scratch, sized from the host's maximum block in prepare();
+    // larger blocks are processed in chunks
+    enum ScratchBuffer { SCRATCH_MIX = 0, SCRATCH_VOICE, NUM_SCRATCH_BUFFERS };
+    static constexpr int DEFAULT_MAX_BLOCK_SIZE = 512;
+    ScratchArena scratch_;
+    void prepareScratch(int maxBlockSize);
 
     void applyParameters();
     void processStereoSample(float& left, float& right);
     inline float softClip(float x) const;
     bool writeJsonParameter(const char* name, double value, char* buffer, int& offset, int bufferSize) const;
-    bool parseJsonParameter(const char* json, const char* param, double& value) const;
 
     // UPFS v1.0 preset loading support
     bool isUPFSFormat(const char* jsonData) const;
@@ -8,7 +8,7 @@
     Pure DSP implementation of Nature Marco Hybrid Virtual Analog Synthesizer
     - Inherits from DSP::InstrumentDSP (no JUCE dependencies)
     - Headless operation (no GUI)
-    - PolyBLEP anti-aliasing oscillators
+    - Band-limited oscillators (mipmapped wavetables, PolyBLEP pulse)
     - WARP phase manipulation (-1.0 to +1.0)
     - FM synthesis with carrier/modulator swap
     - 16-slot modulation matrix with lock-free std::atomic
@@ -24,6 +24,14 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "../../../../include/dsp/ParameterRegistry.h"
+#include "../../../../include/dsp/WavetableBank.h"
+#include "../../../../include/dsp/ScratchArena.h"
+#include "../../../../include/dsp/PresetFormat.h"
+#include "../../../../include/dsp/ParameterExchange.h"
+#include "../../../../include/dsp/VoiceRenderPool.h"
+#include "../../../../include/dsp/RealtimeTelemetry.h"
+#include "../../../../include/dsp/DenormalGuard.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -50,7 +58,11 @@ class MacroSystem;
 class NaturePureDSP;
 
 //==============================================================================
-// Oscillator with PolyBLEP Anti-Aliasing
+// Band-Limited Oscillator
+//
+// Saw, square and triangle read the shared WavetableBank at the mip level
+// for the current pitch; sine and phase warp read the shared SineTable;
+// pulse (variable width) uses PolyBLEP.
 //==============================================================================
 
 enum class Waveform { SAW, SQUARE, TRIANGLE, SINE, PULSE };
@@ -73,6 +85,13 @@ public:
 
     float processSample();
     float processSampleWithFM(float modulationInput);
+    void processBlock(float* output, int numSamples);
+
+    // Shared by processSample() and the voice-lane renderer
+    static double applyWarp(double p, float warpAmount);
+    static double wrapPhase(double p);
+    static float evaluate(Waveform waveform, double p, double dt, float pulseWidth);
+    static int wavetableShape(Waveform waveform);  // -1 if not table-based
 
     double phase = 0.0;
     double phaseIncrement = 0.0;
@@ -84,11 +103,8 @@ public:
 
 private:
     float generateWaveform(double p) const;
-    float polyBlep(double t, double dt) const;
-    float polyBlepSaw(double p) const;
-    float polyBlepSquare(double p) const;
-    float polyBlepTriangle(double p) const;
-    float polyBlepPulse(double p, double pw) const;
+    static float polyBlep(double t, double dt);
+    static float polyBlepPulse(double p, double pw, double dt);
 };
 
 //==============================================================================
@@ -109,6 +125,7 @@ public:
     void setLevel(float l) { level = l; }
 
     float processSample();
+    void processBlock(float* output, int numSamples);
 
     double phase = 0.0;
     bool enabled = true;
@@ -132,6 +149,7 @@ public:
     void reset();
 
     float nextFloat();
+    void fill(float* output, int numSamples);
     void setLevel(float level) { level_ = level; }
 
 private:
@@ -160,6 +178,51 @@ public:
     void setResonance(float res);
 
     float processSample(float input);
+    void processBlock(float* buffer, int numSamples);
+
+    /** As above with the cutoff ramped from cutoff * ratioStart to cutoff * ratioEnd */
+    void processBlock(float* buffer, int numSamples, float cutoffRatioStart, float cutoffRatioEnd);
+
+    struct Coefficients
+    {
+        float fs = 0.0f;  // Normalized frequency
+        float q = 1.0f;   // Damping
+    };
+
+    /** Coefficients for a cutoff / resonance, computed once and shared by all voices */
+    static Coefficients computeCoefficients(float cutoffHz, float resonance, double sampleRate);
+
+    /** Cached; updated by prepare(), reset(), setCutoff(), setResonance() and setParameters() */
+    Coefficients getCoefficients() const { return coefficients_; }
+
+    /** Apply already-clamped settings with their precomputed coefficients */
+    void setParameters(FilterType newType, float cutoffHz, float newResonance, const Coefficients& c);
+
+    /** One step of the SVF on external state (used by the voice-lane renderer) */
+    static inline float tick(const Coefficients& c, FilterType type, float input,
+                             float& v1, float& v2, float& v3)
+    {
+        // Integrator 1
+        float v1_new = v1 + c.fs * v3;
+        v3 = c.fs * (input - v1 - c.q * v1);
+
+        // Integrator 2
+        float v2_new = v2 + c.fs * v1;
+        v1 = flushDenormal(v1_new);
+        v2 = flushDenormal(v2_new);
+
+        switch (type)
+        {
+            case FilterType::HIGHPASS: return input - c.q * v1 - v2;
+            case FilterType::BANDPASS: return v1;
+            case FilterType::NOTCH:    return input - c.q * v1;
+            case FilterType::LOWPASS:
+            default:                   return v2;
+        }
+    }
+
+    void getState(float& outV1, float& outV2, float& outV3) const { outV1 = v1; outV2 = v2; outV3 = v3; }
+    void setState(float newV1, float newV2, float newV3) { v1 = newV1; v2 = newV2; v3 = newV3; }
 
     FilterType type = FilterType::LOWPASS;
     float cutoff = 1000.0f;
@@ -167,6 +230,7 @@ public:
 
 private:
     double sampleRate_ = 48000.0;
+    Coefficients coefficients_;
     float v0 = 0.0f;  // Input
     float v1 = 0.0f;  // Lowpass
     float v2 = 0.0f;  // Bandpass
@@ -188,17 +252,30 @@ public:
         float release = 0.2f;
     };
 
+    /** Level change per sample for each ramp stage */
+    struct Rates
+    {
+        float attack = 0.0f;
+        float decay = 0.0f;
+        float release = 0.0f;
+    };
+
     Envelope();
     ~Envelope() = default;
 
     void prepare(double sampleRate);
     void reset();
 
-    void setParameters(const Parameters& params);
+    static Rates computeRates(const Parameters& params, double sampleRate);
+
+    void setParameters(const Parameters& params);  // Computes rates
+    void setParameters(const Parameters& params, const Rates& rates);
+    const Rates& getRates() const { return rates_; }
     void noteOn();
     void noteOff();
 
     float processSample();
+    void processBlock(float* output, int numSamples);
     bool isActive() const;
 
     Parameters params;
@@ -209,6 +286,7 @@ private:
     State state = State::IDLE;
     float currentLevel = 0.0f;
     double sampleRate_ = 48000.0;
+    Rates rates_;
 };
 
 //==============================================================================
@@ -233,6 +311,12 @@ public:
 
     float processSample();
 
+    /**
+     * Control-rate step: output at the current phase, then advance numSamples.
+     * rateScale / depthOffset apply modulation without touching rate / depth.
+     */
+    float advance(int numSamples, float rateScale = 1.0f, float depthOffset = 0.0f);
+
     float rate = 5.0f;
     float depth = 0.5f;
     LFOWaveform waveform = LFOWaveform::SINE;
@@ -270,6 +354,24 @@ enum class ModDestination {
     LFO1_RATE, LFO1_DEPTH, LFO2_RATE, LFO2_DEPTH
 };
 
+static constexpr int NUM_MOD_SLOTS = 16;
+static constexpr int NUM_MOD_SOURCES = 16;
+static constexpr int NUM_MOD_DESTINATIONS = static_cast<int>(ModDestination::LFO2_DEPTH) + 1;
+
+/**
+ * @brief Summed modulation per destination at one control tick
+ *
+ * Units: levels, warp, pulse width, resonance, sustain and LFO depth are
+ * additive offsets; pitch is octaves; cutoff is octaves x5; envelope
+ * times and LFO rates are octaves x2 (as time/rate multipliers).
+ */
+struct ModulationFrame
+{
+    std::array<float, NUM_MOD_DESTINATIONS> values{};
+
+    float operator[](ModDestination d) const { return values[static_cast<size_t>(d)]; }
+};
+
 struct ModulationSlot
 {
     ModSource source = ModSource::LFO1;
@@ -297,15 +399,40 @@ public:
 
     void processModulationSources();
 
-    std::array<std::atomic<float>, 16> modulationAmounts;
-    float sourceValues[16];  // Updated each sample
-    std::array<ModulationSlot, 16> slots;
+    /**
+     * @brief Two-rate evaluation
+     *
+     * beginBlock() snapshots slot amounts once per audio block and works out
+     * which sources are routed; processControlBlock() then advances only the
+     * routed sources by one control period and writes the destination sums.
+     * Callers ramp destinations linearly between consecutive frames.
+     */
+    void beginBlock();
+    bool hasRoutings() const { return routedSources_ != 0; }
+    void processControlBlock(int numSamples, ModulationFrame& frame);
+
+    void setSourceValue(ModSource source, float value) { sourceValues[static_cast<int>(source)] = value; }
+
+    static constexpr int DEFAULT_CONTROL_RATE = 32;
+    static constexpr int MAX_CONTROL_RATE = 512;
+    void setControlRate(int samples) { controlRate_ = std::clamp(samples, 1, MAX_CONTROL_RATE); }
+    int getControlRate() const { return controlRate_; }
+
+    std::array<std::atomic<float>, NUM_MOD_SLOTS> modulationAmounts;
+    float sourceValues[NUM_MOD_SOURCES];  // Indexed by ModSource; LFOs updated at control rate
+    std::array<ModulationSlot, NUM_MOD_SLOTS> slots;
 
     LFO lfo1;
     LFO lfo2;
 
 private:
     float applyCurve(float value, int curveType) const;
+
+    // Audio-thread snapshot taken in beginBlock()
+    float slotAmounts_[NUM_MOD_SLOTS] = {};
+    uint32_t routedSources_ = 0;  // Bit per ModSource
+    int controlRate_ = DEFAULT_CONTROL_RATE;
+    ModulationFrame lastFrame_;   // For control-rate LFO destinations
 };
 
 //==============================================================================
@@ -397,6 +524,18 @@ struct Voice
 
     bool isActive() const;
     float renderSample();
+
+    /**
+     * Render numSamples into output (overwrites), stage by stage.
+     * With modulation frames, levels and cutoff ramp linearly from modStart
+     * to modEnd; pitch, warp, pulse width, resonance and envelope settings
+     * take modEnd for the whole call (control rate).
+     */
+    void renderBlock(float* output, int numSamples,
+                     const ModulationFrame* modStart = nullptr,
+                     const ModulationFrame* modEnd = nullptr);
+
+    static constexpr int RENDER_CHUNK_SIZE = 64;
 };
 
 //==============================================================================
@@ -405,6 +544,59 @@ struct Voice
 
 enum class PolyphonyMode { POLY, MONO, LEGATO };
 
+/** What a parameter change has to recompute and push to the voices */
+enum VoiceParameterGroup : uint32_t
+{
+    VOICE_GROUP_NONE        = 0,
+    VOICE_GROUP_OSCILLATORS = 1u << 0,  // Shapes, warp, pulse width, levels, sub, noise, FM
+    VOICE_GROUP_FILTER      = 1u << 1,  // Type, cutoff, resonance (SVF coefficients)
+    VOICE_GROUP_FILTER_ENV  = 1u << 2,  // Filter envelope rates
+    VOICE_GROUP_AMP_ENV     = 1u << 3,  // Amp envelope rates
+    VOICE_GROUP_LFO         = 1u << 4,  // Modulation matrix LFOs
+    VOICE_GROUP_ALL         = 0x1fu
+};
+
+/**
+ * @brief Voice settings derived from the synth parameters
+ *
+ * Rebuilt group by group (only groups whose parameters changed) and then
+ * copied into the voices; coefficients are computed here once rather than
+ * per voice.
+ */
+struct VoiceParameterSnapshot
+{
+    // VOICE_GROUP_OSCILLATORS
+    int osc1Shape = 0;
+    int osc2Shape = 0;
+    float osc1Warp = 0.0f;
+    float osc2Warp = 0.0f;
+    float osc1PulseWidth = 0.5f;
+    float osc2PulseWidth = 0.5f;
+    float osc1Level = 0.7f;
+    float osc2Level = 0.5f;
+    bool subEnabled = true;
+    float subLevel = 0.3f;
+    float noiseLevel = 0.0f;
+    bool fmEnabled = false;
+    int fmCarrierIndex = 0;
+    float fmDepth = 0.0f;
+
+    // VOICE_GROUP_FILTER
+    FilterType filterType = FilterType::LOWPASS;
+    float filterCutoffHz = 1000.0f;
+    float filterResonance = 0.5f;
+    SVFFilter::Coefficients filterCoefficients;
+    float filterEnvAmount = 0.0f;
+
+    // VOICE_GROUP_FILTER_ENV / VOICE_GROUP_AMP_ENV
+    Envelope::Parameters filterEnv;
+    Envelope::Rates filterEnvRates;
+    Envelope::Parameters ampEnv;
+    Envelope::Rates ampEnvRates;
+
+    uint32_t generation = 0;  // Bumped on every rebuild
+};
+
 class VoiceManager
 {
 public:
@@ -421,20 +613,75 @@ public:
     void handleNoteOff(int note);
     void allNotesOff();
 
-    void processBlock(float* output, int numSamples, double sampleRate);
+    void processBlock(float* output, int numSamples, double sampleRate,
+                      const ModulationFrame* modStart = nullptr,
+                      const ModulationFrame* modEnd = nullptr);
     int getActiveVoiceCount() const;
 
+    /**
+     * @brief Render groups of VOICE_LANES voices together with oscillator and
+     *        filter state packed structure-of-arrays (one lane per voice)
+     *
+     * Each step of the phase accumulators, table reads and SVF runs on all
+     * lanes at once; wavetables are picked once per lane per block. Output
+     * matches the per-voice renderer. Used only when FM is off and no
+     * modulation is routed; leftover voices fall back to per-voice rendering.
+     */
+    void setVoiceLaneMode(bool enabled) { voiceLaneMode_ = enabled; }
+    bool getVoiceLaneMode() const { return voiceLaneMode_; }
+
+    static constexpr int MAX_VOICES = 16;
+    static constexpr int VOICE_LANES = 4;
+
+    /** Per-voice render scratch (owner's arena); processBlock chunks to its size */
+    void setScratchBuffer(float* buffer, int size);
+
+    /**
+     * @brief Render voices on pool's workers (nullptr: serial, the default)
+     *
+     * Each voice renders into its own buffer; buffers are summed in voice
+     * order, so output matches the per-voice serial renderer. Voice lane
+     * mode does not apply while a pool is set.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { renderPool_ = pool; }
+
+    /** Owner's telemetry for voice-steal counts (nullptr: none) */
+    void setTelemetry(Telemetry* telemetry) { telemetry_ = telemetry; }
+
     void setPolyphonyMode(PolyphonyMode mode) { polyMode_ = mode; }
     PolyphonyMode getPolyphonyMode() const { return polyMode_; }
 
     void enableGlide(bool enable) { glideEnabled_ = enable; }
     void setGlideTime(float time) { glideTime_ = time; }
 
-    // Update all voices with current parameters
-    void updateVoiceParameters(const NaturePureDSP& synth);
+    // Rebuild the snapshot groups in `groups` and push them to all voices
+    void updateVoiceParameters(const NaturePureDSP& synth, uint32_t groups = VOICE_GROUP_ALL);
+    const VoiceParameterSnapshot& getParameterSnapshot() const { return snapshot_; }
 
 private:
-    std::array<Voice, 16> voices_;
+    void renderVoiceLanes(Voice* const* lanes, float* output, int numSamples);
+    void processParallelBlock(float* output, int numSamples,
+                              const ModulationFrame* modStart, const ModulationFrame* modEnd);
+    static void renderTask(void* context, int task, int participant);
+
+    std::array<Voice, MAX_VOICES> voices_;
+    VoiceParameterSnapshot snapshot_;
+    bool voiceLaneMode_ = false;
+
+    // Per-voice render scratch
+    float* voiceBuffer_ = nullptr;
+    int voiceBufferSize_ = 0;
+    alignas(32) float fallbackVoiceBuffer_[Voice::RENDER_CHUNK_SIZE];
+
+    // Parallel rendering: one buffer per voice, sized in prepare()
+    VoiceRenderPool* renderPool_ = nullptr;
+    ScratchArena voiceOutputs_;
+    Telemetry* telemetry_ = nullptr;
+    int renderVoices_[MAX_VOICES] = {};
+    int renderSamples_ = 0;
+    const ModulationFrame* renderModStart_ = nullptr;
+    const ModulationFrame* renderModEnd_ = nullptr;
+
     PolyphonyMode polyMode_ = PolyphonyMode::POLY;
     int monoVoiceIndex_ = -1;
     bool glideEnabled_ = false;
@@ -449,6 +696,89 @@ private:
 class NaturePureDSP : public InstrumentDSP
 {
 public:
+    enum ParameterIndex : int
+    {
+        PARAM_OSC1_SHAPE = 0,
+        PARAM_OSC1_WARP,
+        PARAM_OSC1_PULSE_WIDTH,
+        PARAM_OSC1_DETUNE,
+        PARAM_OSC1_LEVEL,
+        PARAM_OSC2_SHAPE,
+        PARAM_OSC2_WARP,
+        PARAM_OSC2_PULSE_WIDTH,
+        PARAM_OSC2_DETUNE,
+        PARAM_OSC2_LEVEL,
+        PARAM_SUB_ENABLED,
+        PARAM_SUB_LEVEL,
+        PARAM_FM_ENABLED,
+        PARAM_FM_DEPTH,
+        PARAM_FILTER_TYPE,
+        PARAM_FILTER_CUTOFF,
+        PARAM_FILTER_RESONANCE,
+        PARAM_FILTER_ENV_ATTACK,
+        PARAM_FILTER_ENV_DECAY,
+        PARAM_FILTER_ENV_SUSTAIN,
+        PARAM_FILTER_ENV_RELEASE,
+        PARAM_FILTER_ENV_AMOUNT,
+        PARAM_AMP_ENV_ATTACK,
+        PARAM_AMP_ENV_DECAY,
+        PARAM_AMP_ENV_SUSTAIN,
+        PARAM_AMP_ENV_RELEASE,
+        PARAM_LFO1_RATE,
+        PARAM_LFO1_DEPTH,
+        PARAM_LFO2_RATE,
+        PARAM_LFO2_DEPTH,
+        PARAM_MASTER_VOLUME,
+        PARAM_POLY_MODE,
+        PARAM_LFO1_WAVEFORM,
+        PARAM_LFO1_BIPOLAR,
+        PARAM_LFO2_WAVEFORM,
+        PARAM_LFO2_BIPOLAR,
+        PARAM_MASTER_TUNE,
+        NUM_PARAMETERS
+    };
+
+    static constexpr ParameterRegistry<NUM_PARAMETERS> PARAMETERS{{{
+        "osc1_shape",
+        "osc1_warp",
+        "osc1_pulse_width",
+        "osc1_detune",
+        "osc1_level",
+        "osc2_shape",
+        "osc2_warp",
+        "osc2_pulse_width",
+        "osc2_detune",
+        "osc2_level",
+        "sub_enabled",
+        "sub_level",
+        "fm_enabled",
+        "fm_depth",
+        "filter_type",
+        "filter_cutoff",
+        "filter_resonance",
+        "filter_env_attack",
+        "filter_env_decay",
+        "filter_env_sustain",
+        "filter_env_release",
+        "filter_env_amount",
+        "amp_env_attack",
+        "amp_env_decay",
+        "amp_env_sustain",
+        "amp_env_release",
+        "lfo1_rate",
+        "lfo1_depth",
+        "lfo2_rate",
+        "lfo2_depth",
+        "master_volume",
+        "poly_mode",
+        "lfo1_waveform",
+        "lfo1_bipolar",
+        "lfo2_waveform",
+        "lfo2_bipolar",
+        "master_tune"
+    }}};
+    static_assert(PARAMETERS.hasUniqueHashes(), "Parameter ID hash collision");
+
     NaturePureDSP();
     ~NaturePureDSP() override;
 
@@ -463,19 +793,87 @@ public:
     float getParameter(const char* paramId) const override;
     void setParameter(const char* paramId, float value) override;
 
+    // Index-based access: resolve IDs once with getParameterIndex()
+    static int getParameterIndex(const char* paramId) { return PARAMETERS.indexOf(paramId); }
+    float getParameter(int index) const;
+    void setParameter(int index, float value);
+
+    /** Number of times the parameter's value has changed (0 if never / invalid) */
+    uint32_t getParameterGeneration(int index) const
+    {
+        return (index >= 0 && index < NUM_PARAMETERS) ? parameterGenerations_[static_cast<size_t>(index)] : 0;
+    }
+
     bool savePreset(char* jsonBuffer, int jsonBufferSize) const override;
     bool loadPreset(const char* jsonData) override;
 
+    // Compiled presets: compile once off the audio thread (or ship the
+    // binary form), then apply at a block boundary
+    using Preset = PresetBlock<NUM_PARAMETERS>;
+    static int compilePreset(const char* jsonData, Preset& preset) { return preset.compileJson(jsonData, PARAMETERS); }
+
+    /** Decode a binary preset and publishPreset() it; false if rejected */
+    bool loadBinaryPreset(const void* data, size_t size);
+
+    /** Apply between process() calls: no parsing, no allocation */
+    void applyPreset(const Preset& preset);
+
+    /**
+     * @brief Stage preset for the start of the next process() (any thread)
+     *
+     * Values go through a ParameterExchange like host automation; the next
+     * block stores them all and recomputes each touched group once.
+     */
+    void publishPreset(const Preset& preset);
+
     int getActiveVoiceCount() const override;
     int getMaxPolyphony() const override { return 16; }
 
+    /** Modulation matrix evaluation period in samples (default 32) */
+    void setModulationControlRate(int samples) { modMatrix_.setControlRate(samples); }
+    int getModulationControlRate() const { return modMatrix_.getControlRate(); }
+
     const char* getInstrumentName() const override { return "Nature"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
+    /**
+     * @brief Opt-in parallel voice rendering (nullptr: serial)
+     *
+     * Set while audio is stopped; pool must outlive its use here.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { voiceManager_.setRenderPool(pool); }
+
+    /**
+     * @brief Opt-in voice lane rendering (see VoiceManager::setVoiceLaneMode)
+     *
+     * Off by default; set while audio is stopped. Ignored while a render
+     * pool with workers is set.
+     */
+    void setVoiceLaneMode(bool enabled) { voiceManager_.setVoiceLaneMode(enabled); }
+    bool getVoiceLaneMode() const { return voiceManager_.getVoiceLaneMode(); }
+
+    /**
+     * @brief Audio-thread cost and event counters (see RealtimeTelemetry.h)
+     *
+     * Safe from any thread. Stages used: Voices, Modulation. All zero when
+     * built with NATURE_DSP_TELEMETRY=0.
+     */
+    TelemetryStageStats getStageTelemetry(TelemetryStage stage) const { return telemetry_.getStageStats(stage); }
+    uint64_t getTelemetryEventCount(TelemetryEvent event) const { return telemetry_.getEventCount(event); }
+    void resetTelemetry() { telemetry_.requestReset(); }
+
 private:
     VoiceManager voiceManager_;
     ModulationMatrix modMatrix_;
     MacroSystem macros_;
+    Telemetry telemetry_;
+
+    // Block scratch, sized from the host's maximum block in prepare()
+    enum ScratchBuffer { SCRATCH_MIX = 0, SCRATCH_VOICE, NUM_SCRATCH_BUFFERS };
+    static constexpr int DEFAULT_MAX_BLOCK_SIZE = 512;
+    ScratchArena scratch_;
+    void prepareScratch(int maxBlockSize);
+    void renderChunk(float** outputs, int numChannels, int offset, int numSamples);
 
     struct Parameters
     {
@@ -570,7 +968,24 @@ private:
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
 
+    // Last control-rate modulation frame (ramp start for the next one)
+    ModulationFrame modFrame_;
+
+    // Full push (prepare, reset, preset load) / push of changed groups only
     void applyParameters();
+    void applyDirtyParameters();
+    static uint32_t groupsForParameter(int index);
+
+    /** Store a value without pushing it to the voices; false if unchanged */
+    bool storeParameter(int index, float value);
+
+    std::array<uint32_t, NUM_PARAMETERS> parameterGenerations_{};
+    uint32_t dirtyGroups_ = VOICE_GROUP_ALL;
+
+    // Published by publishPreset(), drained at the start of process()
+    ParameterExchange<NUM_PARAMETERS> publishedParameters_;
+    void applyPublishedParameters();
+
     void processStereoSample(float& left, float& right);
 
     float calculateFrequency(int midiNote, float bend = 0.0f) const;
@@ -580,7 +995,6 @@ private:
     bool loadLegacyPreset(const char* jsonData);
 
     bool writeJsonParameter(const char* name, double value, char* buffer, int& offset, int bufferSize) const;
-    bool parseJsonParameter(const char* json, const char* param, double& value) const;
 };
 
 //==============================================================================
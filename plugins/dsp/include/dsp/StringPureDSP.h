@@ -20,6 +20,11 @@
 #pragma once
 
 #include "../../../../include/dsp/InstrumentDSP.h"
+#include "../../../../include/dsp/ScratchArena.h"
+#include "../../../../include/dsp/PhysicalModelCore.h"
+#include "../../../../include/dsp/PresetFormat.h"
+#include "../../../../include/dsp/VoiceRenderPool.h"
+#include "../../../../include/dsp/DenormalGuard.h"
 #include <vector>
 #include <array>
 #include <memory>
@@ -67,9 +72,8 @@ public:
 private:
     Parameters params;
 
-    // Fractional delay line
-    std::vector<float> delayLine;
-    int writeIndex = 0;
+    // Masked ring buffer (integer delay: single tap)
+    WaveguideLoop<DelayInterpolation::Integer> delayLine;
     int delayLength = 0;
 
     // Filter states
@@ -90,27 +94,7 @@ private:
 // Bridge Coupling
 //==============================================================================
 
-class AetherStringBridgeCoupling
-{
-public:
-    AetherStringBridgeCoupling();
-    ~AetherStringBridgeCoupling() = default;
-
-    void prepare(double sampleRate);
-    void reset();
-
-    float processString(float stringOutput);
-    float getBridgeEnergy() const { return bridgeEnergy; }
-
-    void setCouplingCoefficient(float coeff);
-    void setNonlinearity(float nonlin);
-
-private:
-    float couplingCoefficient = 0.3f;
-    float nonlinearity = 0.1f;
-    float bridgeEnergy = 0.0f;
-    double sampleRate = 48000.0;
-};
+using AetherStringBridgeCoupling = NonlinearBridge;  // Shared core
 
 //==============================================================================
 // Modal Filter (Single Body Mode)
@@ -148,11 +132,13 @@ public:
     void setResonance(float amount);
     void loadGuitarBodyPreset();
 
-    int getNumModes() const { return static_cast<int>(modes.size()); }
+    int getNumModes() const { return modes.size(); }
+
+    static constexpr int MAX_MODES = 8;
     float getModeFrequency(int index) const;
 
 private:
-    std::vector<AetherStringModalFilter> modes;
+    ModalBank<AetherStringModalFilter, MAX_MODES> modes;
     double sampleRate = 48000.0;
     float resonanceAmount = 1.0f;
 };
@@ -271,10 +257,29 @@ public:
     void setBodyResonance(float amount);
     void loadGuitarBodyPreset();
 
+    /**
+     * @brief Render voices on pool's workers (nullptr: serial, the default)
+     *
+     * Each voice renders into its own buffer; buffers are summed in voice
+     * order, so output is identical to the serial path.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { renderPool_ = pool; }
+
 private:
-    std::array<AetherStringVoice, 6> voices_;
+    static constexpr int NUM_VOICES = 6;
+
+    std::array<AetherStringVoice, NUM_VOICES> voices_;
     double currentSampleRate_ = 48000.0;
     int maxDelaySamples_ = 0;
+
+    // Parallel rendering
+    VoiceRenderPool* renderPool_ = nullptr;
+    ScratchArena voiceOutputs_;  // One buffer per voice, sized in prepare()
+    int renderVoices_[NUM_VOICES] = {};
+    int renderSamples_ = 0;
+
+    void processParallelBlock(float* output, int numSamples);
+    static void renderTask(void* context, int task, int participant);
 };
 
 //==============================================================================
@@ -304,6 +309,13 @@ public:
     const char* getInstrumentName() const override { return "NatureAetherString"; }
     const char* getInstrumentVersion() const override { return "1.0.0"; }
 
+    /**
+     * @brief Opt-in parallel voice rendering (nullptr: serial)
+     *
+     * Set while audio is stopped; pool must outlive its use here.
+     */
+    void setRenderPool(VoiceRenderPool* pool) { voiceManager_.setRenderPool(pool); }
+
 private:
     AetherStringVoiceManager voiceManager_;
 
@@ -345,9 +357,12 @@ private:
     int blockSize_ = 512;
     double pitchBend_ = 0.0;
 
-    // Real-time safe temporary buffer for audio processing
-    static constexpr int MAX_BLOCK_SIZE = 512;
-    alignas(32) float tempBuffer_[MAX_BLOCK_SIZE];
+    // Real-time safe scratch, sized from the host's maximum block in prepare();
+    // larger blocks are processed in chunks
+    enum ScratchBuffer { SCRATCH_MIX = 0, NUM_SCRATCH_BUFFERS };
+    static constexpr int DEFAULT_MAX_BLOCK_SIZE = 512;
+    ScratchArena scratch_;
+    void writeOutput(const float* mix, float** outputs, int numChannels, int offset, int numSamples);
 
     void applyParameters();
     void processStereoSample(float& left, float& right);
@@ -358,7 +373,6 @@ private:
 
     bool writeJsonParameter(const char* name, double value, char* buffer,
                             int& offset, int bufferSize) const;
-    bool parseJsonParameter(const char* json, const char* param, double& value) const;
 
     // UPFS v1.0 preset loading support
     bool loadUPFSPreset(const char* jsonData);
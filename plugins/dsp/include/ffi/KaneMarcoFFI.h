@@ -117,6 +117,8 @@ bool nature_initialize(NatureDSPInstance* instance, double sampleRate, int sampl
  * @param numSamples Number of samples to process
  * @param midiData MIDI message data
  * @param midiSize Size of MIDI data in bytes
+ * @note Allocates per call and stamps MIDI at offset 0; real-time hosts
+ *       should use nature_render() / nature_render_interleaved()
  */
 void nature_process(NatureDSPInstance* instance,
                         float* output,
@@ -132,6 +134,8 @@ void nature_process(NatureDSPInstance* instance,
  * @param midiMessages Array of MIDI messages
  * @param midiSizes Array of MIDI message sizes
  * @param numMessages Number of MIDI messages
+ * @note Allocates per call and stamps MIDI at offset 0; real-time hosts
+ *       should use nature_render() / nature_render_interleaved()
  */
 void nature_process_midi_buffer(NatureDSPInstance* instance,
                                     float* output,
@@ -140,6 +144,63 @@ void nature_process_midi_buffer(NatureDSPInstance* instance,
                                     const int* midiSizes,
                                     int numMessages);
 
+//==============================================================================
+// Real-Time Render Functions
+//==============================================================================
+
+/**
+ * @brief Timestamped MIDI event for the real-time render functions
+ */
+typedef struct NatureMidiEvent
+{
+    int32_t sampleOffset;                     ///< Sample within the block the event lands on
+    uint8_t size;                             ///< Number of valid bytes in data (1-3)
+    uint8_t data[3];                          ///< Raw MIDI bytes, status byte first
+} NatureMidiEvent;
+
+/**
+ * @brief Render a block into caller-owned planar channel buffers
+ *
+ * Real-time safe: renders straight into the caller's buffers through the
+ * pure DSP engine (no JUCE buffers, no allocation, no copies). Events must be
+ * sorted by sampleOffset; each is applied on its sample, and offsets at or
+ * beyond numSamples are applied at the end of the block.
+ *
+ * @param instance Handle to the synth instance (after nature_initialize)
+ * @param outputs Array of numChannels channel pointers, numSamples each
+ * @param numChannels Number of output channels (1-8)
+ * @param numSamples Number of samples to render (any length)
+ * @param events Timestamped MIDI events (may be NULL if numEvents is 0)
+ * @param numEvents Number of events
+ * @return true on success, false on invalid arguments or before initialize
+ */
+bool nature_render(NatureDSPInstance* instance,
+                       float* const* outputs,
+                       int numChannels,
+                       int numSamples,
+                       const NatureMidiEvent* events,
+                       int numEvents);
+
+/**
+ * @brief Render a block as interleaved stereo
+ *
+ * Same as nature_render(), but renders through a planar buffer preallocated
+ * in nature_initialize() and interleaves into output. Blocks longer than the
+ * initialized block size are rendered in chunks.
+ *
+ * @param instance Handle to the synth instance (after nature_initialize)
+ * @param output Output audio buffer (interleaved stereo, 2 * numSamples)
+ * @param numSamples Number of samples to render
+ * @param events Timestamped MIDI events (may be NULL if numEvents is 0)
+ * @param numEvents Number of events
+ * @return true on success, false on invalid arguments or before initialize
+ */
+bool nature_render_interleaved(NatureDSPInstance* instance,
+                                   float* output,
+                                   int numSamples,
+                                   const NatureMidiEvent* events,
+                                   int numEvents);
+
 //==============================================================================
 // Parameter Control Functions
 //==============================================================================
@@ -178,11 +239,44 @@ float nature_get_parameter_value(NatureDSPInstance* instance, const char* parame
  * @param parameterId Parameter ID (null-terminated string)
  * @param value New parameter value (0.0 to 1.0)
  * @return true on success, false on failure
+ * @note Safe while another thread runs nature_render*(); the render path
+ *       picks the value up at the start of its next block
  */
 bool nature_set_parameter_value(NatureDSPInstance* instance,
                                   const char* parameterId,
                                   float value);
 
+/**
+ * @brief Resolve a parameter ID to its index
+ *
+ * Resolve once at setup and use the index-based calls for automation: they
+ * do no string comparison.
+ *
+ * @param instance Handle to the synth instance
+ * @param parameterId Parameter ID (null-terminated string)
+ * @return Index in nature_get_parameter_id() order, or -1 if unknown
+ */
+int nature_get_parameter_index(NatureDSPInstance* instance, const char* parameterId);
+
+/**
+ * @brief Get parameter value by index
+ * @param instance Handle to the synth instance
+ * @param index Parameter index from nature_get_parameter_index()
+ * @return Current value in the parameter's range (0.0 if index is invalid)
+ */
+float nature_get_parameter_value_at(NatureDSPInstance* instance, int index);
+
+/**
+ * @brief Set parameter value by index
+ * @param instance Handle to the synth instance
+ * @param index Parameter index from nature_get_parameter_index()
+ * @param value New value in the parameter's range
+ * @return true on success, false if index is invalid
+ * @note Safe while another thread runs nature_render*(); the render path
+ *       picks the value up at the start of its next block
+ */
+bool nature_set_parameter_value_at(NatureDSPInstance* instance, int index, float value);
+
 /**
  * @brief Get parameter name
  * @param instance Handle to the synth instance
@@ -305,6 +399,9 @@ int nature_save_preset(NatureDSPInstance* instance,
  * @param instance Handle to the synth instance
  * @param jsonData JSON preset data (null-terminated string)
  * @return true on success, false on failure
+ * @note Safe while another thread runs nature_render*(); the preset is
+ *       compiled on the calling thread and applied at the start of the
+ *       render path's next block
  */
 bool nature_load_preset(NatureDSPInstance* instance, const char* jsonData);
 
@@ -416,6 +513,84 @@ int nature_get_active_voice_count(NatureDSPInstance* instance);
  */
 int nature_get_latency(NatureDSPInstance* instance);
 
+
+//==============================================================================
+// Real-time Telemetry
+//==============================================================================
+
+/**
+ * @brief Audio-thread stages timed by the render path (nature_render*)
+ */
+typedef enum NatureTelemetryStage
+{
+    NATURE_TELEMETRY_STAGE_BLOCK = 0,         ///< Whole block
+    NATURE_TELEMETRY_STAGE_VOICES = 1,        ///< Voice rendering
+    NATURE_TELEMETRY_STAGE_MODULATION = 2,    ///< Modulation matrix
+    NATURE_TELEMETRY_STAGE_EFFECTS = 3,       ///< Insert effects (unused by this engine)
+    NATURE_TELEMETRY_STAGE_REVERB = 4,        ///< Reverb (unused by this engine)
+    NATURE_TELEMETRY_STAGE_BODY = 5           ///< Body resonators (unused by this engine)
+} NatureTelemetryStage;
+
+/**
+ * @brief Counted audio-thread events
+ */
+typedef enum NatureTelemetryEvent
+{
+    NATURE_TELEMETRY_EVENT_VOICE_STEAL = 0,   ///< Note-on took a sounding voice
+    NATURE_TELEMETRY_EVENT_DENORMAL = 1,      ///< Subnormal output samples
+    NATURE_TELEMETRY_EVENT_UNDERRUN = 2       ///< Block took longer than its duration
+} NatureTelemetryEvent;
+
+/**
+ * @brief Per-block cost of one stage since the last reset
+ *
+ * Ticks convert to seconds with nature_get_telemetry_ticks_per_second().
+ * Loads are fractions of the average block duration (1.0 = all of it).
+ */
+typedef struct NatureStageTelemetry
+{
+    uint64_t blocks;          ///< Blocks in which the stage ran
+    double averageTicks;
+    uint64_t maxTicks;
+    uint64_t p99Ticks;        ///< Upper edge of the 99th percentile bucket
+    double averageLoad;
+    double p99Load;
+    double maxLoad;
+} NatureStageTelemetry;
+
+/**
+ * @brief Get one stage's cost (safe while rendering)
+ * @param instance Handle to the synth instance
+ * @param stage Stage to read
+ * @param outStats Receives the statistics (all zero in builds without telemetry)
+ * @return true on success
+ */
+bool nature_get_stage_telemetry(NatureDSPInstance* instance,
+                                NatureTelemetryStage stage,
+                                NatureStageTelemetry* outStats);
+
+/**
+ * @brief Get how often an event happened since the last reset (safe while rendering)
+ * @param instance Handle to the synth instance
+ * @param event Event to read
+ * @return Count, 0 in builds without telemetry
+ */
+uint64_t nature_get_telemetry_event_count(NatureDSPInstance* instance, NatureTelemetryEvent event);
+
+/**
+ * @brief Tick rate of the telemetry clock (0 in builds without telemetry)
+ *
+ * The first call may take ~20 ms to calibrate; do not call it from the
+ * audio thread.
+ */
+double nature_get_telemetry_ticks_per_second(void);
+
+/**
+ * @brief Clear all telemetry at the start of the next rendered block
+ * @param instance Handle to the synth instance
+ */
+void nature_reset_telemetry(NatureDSPInstance* instance);
+
 #ifdef __cplusplus
 }
 #endif
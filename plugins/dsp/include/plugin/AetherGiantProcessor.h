@@ -18,6 +18,10 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "../dsp/InstrumentDSP.h"
+#include "../../../../include/dsp/InstrumentHandoff.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
+#include "../../../../include/dsp/VoiceRenderPool.h"
+#include "PresetIndex.h"
 #include <memory>
 #include <array>
 
@@ -39,11 +43,17 @@ enum class GiantInstrumentType
  * Audio Processor for Aether Giant Instruments
  *
  * Implements both VST3 and AU formats via JUCE
+ *
+ * Instrument switches never block the audio thread: the new instrument is
+ * created and prepared on the calling thread, handed over wait-free, and
+ * crossfaded in; replaced instruments are deleted by a timer on the message
+ * thread.
  */
 class AetherGiantProcessor : public juce::AudioProcessor
 #if JucePlugin_Enable_ARA
                              , public juce::AudioProcessorARAExtension
 #endif
+                           , private juce::Timer
 {
 public:
     //==============================================================================
@@ -98,6 +108,11 @@ public:
     bool savePresetToFile(const juce::File& presetFile);
     void refreshPresetList();
 
+    //==============================================================================
+    // Parallel rendering (opt-in): voices render on numWorkers pinned worker
+    // threads. Call while audio is stopped; 0 renders serially (default).
+    void enableParallelRendering(int numWorkers);
+
     //==============================================================================
     // MPE Support
     bool isMPEEnabled() const { return mpeEnabled; }
@@ -125,36 +140,70 @@ protected:
 
 private:
     //==============================================================================
-    // Current instrument DSP instance
-    std::unique_ptr<DSP::InstrumentDSP> currentInstrument;
+    // Instrument instances
+    //  - currentInstrument: newest instrument (message thread view; parameter
+    //    and preset calls go here)
+    //  - activeInstrument / fadingInstrument: owned by the audio thread, which
+    //    crossfades from the fading one after adopting a new instrument
+    DSP::InstrumentDSP* currentInstrument = nullptr;
+    DSP::InstrumentDSP* activeInstrument = nullptr;
+    DSP::InstrumentDSP* fadingInstrument = nullptr;
+    DSP::InstrumentHandoff<DSP::InstrumentDSP> instrumentHandoff;
     GiantInstrumentType instrumentType = GiantInstrumentType::GiantStrings;
 
+    // Instrument switch crossfade
+    static constexpr double CROSSFADE_SECONDS = 0.02;
+    static constexpr int RECLAIM_TIMER_HZ = 10;
+    juce::AudioBuffer<float> crossfadeBuffer;
+    int crossfadeLength = 0;
+    int crossfadeRemaining = 0;
+
+    // Shared by every instrument this processor creates
+    DSP::VoiceRenderPool renderPool;
+
+    // This block's MIDI as events in sample-offset order (never allocates)
+    static constexpr int MAX_EVENTS_PER_BLOCK = 512;
+    DSP::ScheduledEventQueue<MAX_EVENTS_PER_BLOCK> pendingEvents;
+
     // MPE state
     bool mpeEnabled = false;
 
-    // Preset management
-    juce::File presetsFolder;
-    juce::StringArray presetNames;
+    // Preset management: the index scans and preloads in the background, so
+    // program changes never touch the disk; a program restored before the
+    // index is ready is applied once it arrives
+    PresetIndex presetIndex;
+    std::shared_ptr<const PresetIndex::Snapshot> getPresets() const;
+    void setPresets(std::shared_ptr<const PresetIndex::Snapshot> next);
+    juce::String pendingProgramName;
     int currentProgramIndex = 0;
 
-    // Critical section for DSP access
-    juce::CriticalSection dspLock;
+    // Replaced on the message thread while hosts call getNumPrograms() /
+    // getProgramName() from others: only touched through get/setPresets()
+    mutable juce::CriticalSection presetsLock;
+    std::shared_ptr<const PresetIndex::Snapshot> presets;
 
     //==============================================================================
     // Factory functions to create instruments
     std::unique_ptr<DSP::InstrumentDSP> createInstrument(GiantInstrumentType type);
     void switchInstrument(GiantInstrumentType type);
 
+    // Audio thread: adopt a published instrument / mix the outgoing one
+    void adoptPendingInstrument();
+    void renderCrossfade(juce::AudioBuffer<float>& buffer);
+
+    // Message thread: delete instruments retired by the audio thread
+    void timerCallback() override;
+
     // MIDI processing
-    void processMIDI(juce::MidiBuffer& midiMessages,
-                     std::vector<DSP::ScheduledEvent>& events);
-    void midiMessageToEvent(const juce::MidiMessage& msg,
-                           DSP::ScheduledEvent& event,
-                           double sampleRate);
+    void processMIDI(const juce::MidiBuffer& midiMessages);
 
     // Preset scanning
     void scanPresetsFolder();
+    void presetIndexChanged();
+    bool presetsMatchInstrument() const;
+    bool loadPresetContent(int index);
     juce::File getPresetsFolder() const;
+    juce::File getPresetManifestFile() const;
 
     //==============================================================================
     // Parameter definitions
@@ -18,6 +18,7 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "dsp/AetherPureDSP.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
 #include <memory>
 #include <atomic>
 
@@ -99,6 +100,10 @@ private:
     // Critical section for DSP access
     juce::CriticalSection dspLock;
 
+    // This block's MIDI as events in sample-offset order (never allocates)
+    static constexpr int MAX_EVENTS_PER_BLOCK = 512;
+    DSP::ScheduledEventQueue<MAX_EVENTS_PER_BLOCK> pendingEvents;
+
     //==============================================================================
     // Parameter definitions
     enum ParameterIndex
@@ -129,8 +134,7 @@ private:
 
     //==============================================================================
     // MIDI processing
-    void processMIDI(juce::MidiBuffer& midiMessages,
-                     std::vector<DSP::ScheduledEvent>& events);
+    void processMIDI(const juce::MidiBuffer& midiMessages);
 
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NaturePluginProcessor)
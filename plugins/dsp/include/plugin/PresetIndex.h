@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+   PresetIndex.h
+   Background preset index for the plugin processors
+
+   Provides:
+   - Folder scanning on a background thread (never on the message thread)
+   - Preset text preloaded into memory, so selecting a program never reads
+     a file
+   - A persisted manifest (name, instrument, mtime, size, content): a new
+     instance reads one cache file instead of every preset
+   - Incremental invalidation: only files whose mtime or size changed are
+     read again
+   - A process-wide snapshot cache, so further instances of a plugin get
+     their preset list without waiting for a scan
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+/**
+ * Immutable result of one scan; shared between threads by shared_ptr
+ */
+struct PresetIndexSnapshot
+{
+    struct Entry
+    {
+        juce::String fileName;
+        juce::int64 modificationTime = 0;
+        juce::int64 size = 0;
+        juce::String content;
+    };
+
+    juce::String instrument;
+    std::vector<Entry> entries;  // Sorted by file name
+
+    int indexOf(const juce::String& fileName) const;
+};
+
+//==============================================================================
+/**
+ * Asynchronous preset index for one preset folder at a time
+ *
+ * setFolder() and refresh() only post a request; the snapshot is replaced
+ * when the background scan finishes and onChanged is called on the message
+ * thread. getSnapshot() is cheap and never blocks on a scan.
+ */
+class PresetIndex : private juce::Thread,
+                    private juce::AsyncUpdater
+{
+public:
+    using Snapshot = PresetIndexSnapshot;
+
+    PresetIndex();
+    ~PresetIndex() override;
+
+    /**
+     * @brief Index folder (tagged with instrument) in the background
+     *
+     * If this process already indexed folder, that snapshot is published
+     * immediately and revalidated in the background.
+     * @param manifestFile Where the manifest is cached between sessions
+     */
+    void setFolder(const juce::File& folder, const juce::String& instrument,
+                   const juce::File& manifestFile);
+
+    /** Revalidate the current folder (e.g. after saving a preset) */
+    void refresh();
+
+    std::shared_ptr<const Snapshot> getSnapshot() const;
+
+    /** Called on the message thread whenever the snapshot changes */
+    std::function<void()> onChanged;
+
+private:
+    struct Request
+    {
+        juce::File folder;
+        juce::String instrument;
+        juce::File manifestFile;
+    };
+
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    void publish(std::shared_ptr<const Snapshot> next);
+    std::shared_ptr<const Snapshot> scan(const Request& request,
+                                         const std::shared_ptr<const Snapshot>& previous);
+
+    static std::shared_ptr<const Snapshot> readManifest(const juce::File& manifestFile,
+                                                        const juce::String& instrument);
+    static void writeManifest(const juce::File& manifestFile, const Snapshot& snapshot);
+
+    mutable juce::CriticalSection lock;
+    std::shared_ptr<const Snapshot> snapshot;
+    Request request;
+    bool requestPending = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetIndex)
+};
@@ -11,7 +11,8 @@
 */
 
 #include "dsp/AetherPureDSP.h"
-#include "../../../../include/dsp/LookupTables.h"
+#include "../../../../include/dsp/SharedTables.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
 #include "../../../../include/dsp/DSPLogging.h"
 #include <cstring>
 #include <random>
@@ -21,79 +22,6 @@
 
 namespace DSP {
 
-//==============================================================================
-// FractionalDelayLine Implementation
-//==============================================================================
-
-FractionalDelayLine::FractionalDelayLine()
-{
-    buffer_.resize(1024, 0.0f);
-    writeIndex_ = 0;
-    delay_ = 0.0f;
-    maxDelay_ = 1024;
-}
-
-void FractionalDelayLine::prepare(double sampleRate, int maximumDelay)
-{
-    maxDelay_ = maximumDelay + 4;  // Extra space for interpolation
-    buffer_.resize(maxDelay_, 0.0f);
-    std::fill(buffer_.begin(), buffer_.end(), 0.0f);
-    writeIndex_ = 0;
-}
-
-void FractionalDelayLine::reset()
-{
-    std::fill(buffer_.begin(), buffer_.end(), 0.0f);
-    writeIndex_ = 0;
-}
-
-void FractionalDelayLine::setDelay(float delayInSamples)
-{
-    delay_ = std::max(0.0f, std::min(static_cast<float>(maxDelay_ - 4), delayInSamples));
-}
-
-float FractionalDelayLine::popSample()
-{
-    float readPos = writeIndex_ - delay_;
-    if (readPos < 0.0f)
-        readPos += maxDelay_;
-
-    return interpolate(readPos);
-}
-
-void FractionalDelayLine::pushSample(float sample)
-{
-    buffer_[writeIndex_] = sample;
-    writeIndex_ = (writeIndex_ + 1) % maxDelay_;
-}
-
-float FractionalDelayLine::interpolate(float fractionalDelay)
-{
-    int delayIndex = static_cast<int>(fractionalDelay);
-    float frac = fractionalDelay - delayIndex;
-
-    int index0 = (writeIndex_ - 1 - delayIndex + maxDelay_) % maxDelay_;
-    int index1 = (index0 - 1 + maxDelay_) % maxDelay_;
-    int index2 = (index0 - 2 + maxDelay_) % maxDelay_;
-    int index3 = (index0 - 3 + maxDelay_) % maxDelay_;
-
-    // 4-point Lagrange interpolation
-    float y0 = buffer_[index0];
-    float y1 = buffer_[index1];
-    float y2 = buffer_[index2];
-    float y3 = buffer_[index3];
-
-    float frac2 = frac * frac;
-    float frac3 = frac2 * frac;
-
-    float w0 = -0.16666667f * frac3 + 0.5f * frac2 - 0.33333333f * frac;
-    float w1 = 0.5f * frac3 - frac2 - 0.5f * frac + 1.0f;
-    float w2 = -0.5f * frac3 + 0.5f * frac2 + frac;
-    float w3 = 0.16666667f * frac3 - 0.33333333f * frac2;
-
-    return w0 * y3 + w1 * y0 + w2 * y1 + w3 * y2;
-}
-
 //==============================================================================
 // TPTFilter Implementation
 //==============================================================================
@@ -126,8 +54,7 @@ void TPTFilter::setCutoffFrequency(float freq)
 {
     cutoff_ = freq;
     float wd = 2.0f * 3.14159265359f * cutoff_ / sampleRate_;
-    // Use LookupTables for sine calculation
-    float wa = SchillingerEcosystem::DSP::fastSineLookup(wd);
+    float wa = SharedTables::get().sin(wd);
     g_ = wa / std::sqrt(1.0f + wa * wa);  // CRITICAL FIX: Removed 'float' to update member variable
     h_ = 1.0f / (1.0f - g_);
 }
@@ -136,7 +63,7 @@ float TPTFilter::processSample(float input)
 {
     float v1 = (input - z1_) * g_;
     float v2 = v1 + z1_;
-    z1_ = v2 + v1;
+    z1_ = flushDenormal(v2 + v1);
 
     switch (type_)
     {
@@ -201,15 +128,18 @@ float ModalFilter::computeQ(float freq, float damping, float structure)
     return computedQ;
 }
 
-float ModalFilter::processSample(float excitation)
+float ModalFilter::getDecayFactor() const
 {
-    energy += excitation * amplitude;
-
     // Use frequency-dependent Q for more realistic decay
     // Q determines how quickly energy decays
-    float decayFactor = 1.0f - (1.0f / (computedQ * sr * 0.001f));  // Scale Q for sample rate
-    decayFactor = std::max(0.999f, std::min(0.99999f, decayFactor));  // Keep in reasonable range
-    energy *= decayFactor;
+    float decayFactor = 1.0f - (1.0f / (computedQ * static_cast<float>(sr) * 0.001f));  // Scale Q for sample rate
+    return std::max(0.999f, std::min(0.99999f, decayFactor));  // Keep in reasonable range
+}
+
+float ModalFilter::processSample(float excitation)
+{
+    energy += excitation * amplitude;
+    energy *= getDecayFactor();
 
     if (std::abs(energy) < 1e-10f)
         energy = 0.0f;
@@ -219,8 +149,7 @@ float ModalFilter::processSample(float excitation)
     if (phase >= 1.0f)
         phase -= 1.0f;
 
-    // Use LookupTables for sine calculation
-    float output = energy * SchillingerEcosystem::DSP::fastSineLookup(phase * 2.0f * 3.14159265359f);
+    float output = energy * SineTable::get().lookup(phase);
     return output;
 }
 
@@ -255,10 +184,10 @@ void WaveguideString::prepare(double sampleRate)
     int maxDelay = static_cast<int>(sampleRate / 82.4) + 100;
     maxDelayInSamples = maxDelay;
 
-    fractionalDelay_.prepare(sampleRate, maxDelay);
+    loop_.prepare(maxDelay);
 
     // Set initial frequency
-    fractionalDelay_.setDelay(static_cast<float>(sr / params_.frequency));
+    loop_.setDelay(static_cast<float>(sr / params_.frequency));
 
     stiffnessFilter_.prepare(sampleRate);
     stiffnessFilter_.setType(TPTFilter::Type::allpass);
@@ -273,18 +202,15 @@ void WaveguideString::prepare(double sampleRate)
     dampingFilter_.setCutoffFrequency(dampingCutoff);
 
     // Prepare dispersion filters (cascaded allpass for realistic dispersion)
-    // Each filter operates at a different frequency for broad dispersion
-    dispersionFilter1_.prepare(sampleRate);
-    dispersionFilter1_.setType(TPTFilter::Type::allpass);
-    dispersionFilter1_.setCutoffFrequency(3000.0f);
-
-    dispersionFilter2_.prepare(sampleRate);
-    dispersionFilter2_.setType(TPTFilter::Type::allpass);
-    dispersionFilter2_.setCutoffFrequency(6000.0f);
-
-    dispersionFilter3_.prepare(sampleRate);
-    dispersionFilter3_.setType(TPTFilter::Type::allpass);
-    dispersionFilter3_.setCutoffFrequency(12000.0f);
+    // Each stage an octave above the last (3 kHz, 6 kHz, 12 kHz) for broad dispersion
+    float dispersionCutoff = 3000.0f;
+    for (auto& stage : dispersion_.stages)
+    {
+        stage.prepare(sampleRate);
+        stage.setType(TPTFilter::Type::allpass);
+        stage.setCutoffFrequency(dispersionCutoff);
+        dispersionCutoff *= 2.0f;
+    }
 
     updateBridgeImpedance();
 }
@@ -299,31 +225,42 @@ void WaveguideString::updateBridgeImpedance()
 
 void WaveguideString::reset()
 {
-    fractionalDelay_.reset();
+    loop_.reset();
     stiffnessFilter_.reset();
     dampingFilter_.reset();
-    dispersionFilter1_.reset();
-    dispersionFilter2_.reset();
-    dispersionFilter3_.reset();
+    dispersion_.reset();
     lastBridgeEnergy_ = 0.0f;
     sympatheticEnergy_ = 0.0f;
 }
 
 void WaveguideString::excite(const float* exciterSignal, int exciterLength, float velocity)
 {
-    int length = fractionalDelay_.getMaximumDelay();
+    int length = loop_.getMaximumDelay();
     
     for (int i = 0; i < length; ++i)
     {
         float sample = exciterSignal[i % exciterLength];
-        fractionalDelay_.pushSample(sample * velocity);
+        loop_.push(sample * velocity);
     }
 }
 
 float WaveguideString::processSample()
 {
-    float output = fractionalDelay_.popSample();
+    return loop_.processSample([this](float output) { return reflect(output); });
+}
 
+void WaveguideString::processBlock(float* output, int numSamples)
+{
+    loop_.processBlock(output, numSamples, [this](float output) { return reflect(output); });
+}
+
+void WaveguideString::processBlock(float* output, const float* drive, float driveGain, int numSamples)
+{
+    loop_.processBlock(output, drive, driveGain, numSamples, [this](float output) { return reflect(output); });
+}
+
+float WaveguideString::reflect(float output)
+{
     // Stiffness (allpass for inharmonicity)
     float stiffOutput = stiffnessFilter_.processSample(output);
 
@@ -337,12 +274,10 @@ float WaveguideString::processSample()
         float dispersionAmount = params_.dispersion;
 
         // Blend between dispersed and non-dispersed signal
-        float dispersed1 = dispersionFilter1_.processSample(dispersed);
-        float dispersed2 = dispersionFilter2_.processSample(dispersed1);
-        float dispersed3 = dispersionFilter3_.processSample(dispersed2);
+        float fullyDispersed = dispersion_.processSample(dispersed);
 
         // Dry/wet mix for dispersion
-        dispersed = dispersed * (1.0f - dispersionAmount) + dispersed3 * dispersionAmount;
+        dispersed = dispersed * (1.0f - dispersionAmount) + fullyDispersed * dispersionAmount;
     }
 
     // Damping (lowpass for brightness)
@@ -360,24 +295,22 @@ float WaveguideString::processSample()
     linearBridgeEnergy *= impedanceFactor;
 
     float nonlinearFactor = 1.0f + params_.nonlinearity;
-    float saturatedBridge = std::tanh(linearBridgeEnergy * nonlinearFactor);
+    float saturatedBridge = fastTanh(linearBridgeEnergy * nonlinearFactor);
 
     lastBridgeEnergy_ = saturatedBridge;
     float reflectedEnergy = damped - saturatedBridge;
 
     // Store some energy for sympathetic coupling
-    sympatheticEnergy_ = sympatheticEnergy_ * 0.99f + saturatedBridge * 0.01f;
-
-    fractionalDelay_.pushSample(reflectedEnergy);
+    sympatheticEnergy_ = flushDenormal(sympatheticEnergy_ * 0.99f + saturatedBridge * 0.01f);
 
-    return output;
+    return reflectedEnergy;
 }
 
 void WaveguideString::setFrequency(float freq)
 {
     params_.frequency = std::max(20.0f, std::min(20000.0f, freq));
     float delayInSamples = static_cast<float>(sr / params_.frequency);
-    fractionalDelay_.setDelay(delayInSamples);
+    loop_.setDelay(delayInSamples);
 }
 
 void WaveguideString::setDamping(float damping) {
@@ -457,59 +390,42 @@ void WaveguideString::setPickPosition(float position)
     params_.pickPosition = std::max(0.0f, std::min(1.0f, position));
 }
 
-//==============================================================================
-// BridgeCoupling Implementation
-//==============================================================================
-
-BridgeCoupling::BridgeCoupling() = default;
-
-void BridgeCoupling::prepare(double sampleRate) {}
-void BridgeCoupling::reset() { bridgeEnergy_ = 0.0f; }
-
-float BridgeCoupling::processString(float stringOutput)
-{
-    float linearBridgeEnergy = stringOutput * couplingCoefficient_;
-    float nonlinearBridge = std::tanh(linearBridgeEnergy * (1.0f + nonlinearity_));
-    
-    bridgeEnergy_ = nonlinearBridge;
-    float reflectedEnergy = stringOutput - nonlinearBridge;
-    
-    return reflectedEnergy;
-}
-
 //==============================================================================
 // ModalBodyResonator Implementation
 //==============================================================================
 
-ModalBodyResonator::ModalBodyResonator()
-{
-    modes_.reserve(16);
-}
+ModalBodyResonator::ModalBodyResonator() = default;
 
 void ModalBodyResonator::prepare(double sampleRate)
 {
     sr = sampleRate;
-    for (auto& mode : modes_)
-        mode.prepare(sampleRate);
+    modes_.prepare(sampleRate);
+    updateBank();
 }
 
 void ModalBodyResonator::reset()
 {
-    for (auto& mode : modes_)
-        mode.reset();
+    modes_.reset();
+    updateBank();
+    bank_.reset();
 }
 
 float ModalBodyResonator::processSample(float bridgeEnergy)
 {
-    float output = 0.0f;
-    
-    for (auto& mode : modes_)
-        output += mode.processSample(bridgeEnergy);
-    
-    if (!modes_.empty())
-        output /= static_cast<float>(modes_.size());
-    
-    return output;
+    return bank_.processSample(bridgeEnergy) * outputScale_;
+}
+
+void ModalBodyResonator::updateBank()
+{
+    // energy = (energy + x * amplitude) * decay, folded to energy * decay + x * (amplitude * decay)
+    bank_.setNumModes(modes_.size());
+    for (int i = 0; i < modes_.size(); ++i)
+    {
+        const ModalFilter& mode = modes_[i];
+        const float decayFactor = mode.getDecayFactor();
+        bank_.setMode(i, mode.frequency, sr, mode.amplitude * decayFactor, decayFactor);
+    }
+    outputScale_ = modes_.empty() ? 0.0f : 1.0f / static_cast<float>(modes_.size());
 }
 
 void ModalBodyResonator::setResonance(float amount)
@@ -517,6 +433,8 @@ void ModalBodyResonator::setResonance(float amount)
     amount = std::max(0.0f, std::min(2.0f, amount));
     for (auto& mode : modes_)
         mode.amplitude = mode.baseAmplitude * amount;
+
+    updateBank();
 }
 
 void ModalBodyResonator::setMaterial(MaterialType material)
@@ -546,15 +464,19 @@ void ModalBodyResonator::setMaterial(MaterialType material)
         mode.materialFactor = materialFactor;
         mode.computedQ = mode.computeQ(mode.frequency, mode.decay, 1.0f);
     }
+
+    updateBank();
 }
 
 void ModalBodyResonator::recalculateModeQ(float damping, float structure)
 {
-    for (size_t i = 0; i < modes_.size(); ++i)
+    for (int i = 0; i < modes_.size(); ++i)
     {
         modes_[i].modeIndex = static_cast<float>(i);
         modes_[i].computedQ = modes_[i].computeQ(modes_[i].frequency, damping, structure);
     }
+
+    updateBank();
 }
 
 void ModalBodyResonator::loadGuitarBodyPreset()
@@ -655,6 +577,9 @@ void ModalBodyResonator::loadGuitarBodyPreset()
     // Prepare all modes (this will compute Q values)
     for (auto& mode : modes_)
         mode.prepare(sr);
+
+    updateBank();
+    bank_.reset();
 }
 
 void ModalBodyResonator::loadPianoBodyPreset()
@@ -681,6 +606,9 @@ void ModalBodyResonator::loadPianoBodyPreset()
 
     for (auto& mode : modes_)
         mode.prepare(sr);
+
+    updateBank();
+    bank_.reset();
 }
 
 void ModalBodyResonator::loadOrchestralStringPreset()
@@ -707,11 +635,14 @@ void ModalBodyResonator::loadOrchestralStringPreset()
 
     for (auto& mode : modes_)
         mode.prepare(sr);
+
+    updateBank();
+    bank_.reset();
 }
 
 float ModalBodyResonator::getModeFrequency(int index) const
 {
-    if (index >= 0 && index < static_cast<int>(modes_.size()))
+    if (index >= 0 && index < modes_.size())
         return modes_[index].frequency;
     return 0.0f;
 }
@@ -792,8 +723,7 @@ void ArticulationStateMachine::triggerHarmonic(float velocity)
     for (int i = 0; i < harmonicLength; ++i)
     {
         float phase = static_cast<float>(i) / static_cast<float>(sr);
-        // Use LookupTables for sine calculation
-        exciterBuffer[i] = SchillingerEcosystem::DSP::fastSineLookup(harmonicFreq * phase * 2.0f * 3.14159265359f) * velocity;
+        exciterBuffer[i] = SineTable::get().lookupWrapped(harmonicFreq * phase) * velocity;
     }
     exciterLength = harmonicLength;
     exciterIndex = 0;
@@ -850,14 +780,12 @@ void ArticulationStateMachine::update(float deltaTime)
 
 float ArticulationStateMachine::getPreviousGain() const
 {
-    // Use LookupTables for cosine calculation
-    return SchillingerEcosystem::DSP::fastCosineLookup(static_cast<float>(crossfadeProgress) * 1.570796327f);
+    return SharedTables::get().cos(static_cast<float>(crossfadeProgress) * 1.570796327f);
 }
 
 float ArticulationStateMachine::getCurrentGain() const
 {
-    // Use LookupTables for sine calculation
-    return SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(crossfadeProgress) * 1.570796327f);
+    return SharedTables::get().sin(static_cast<float>(crossfadeProgress) * 1.570796327f);
 }
 
 float ArticulationStateMachine::getCurrentExcitation()
@@ -897,7 +825,7 @@ float SharedBridgeCoupling::addStringEnergy(float stringEnergy, int voiceIndex)
     for (float energy : bridgeEnergies_)
         total += energy;
     
-    totalBridgeMotion_ = std::tanh(total * 0.3f);
+    totalBridgeMotion_ = fastTanh(total * 0.3f);
     
     float reflected = stringEnergy - totalBridgeMotion_;
     return reflected;
@@ -908,6 +836,23 @@ float SharedBridgeCoupling::getBridgeMotion() const
     return totalBridgeMotion_;
 }
 
+void SharedBridgeCoupling::processBlock(const float* const* voiceInputs, int numVoices, float* motion, int numSamples)
+{
+    std::fill(motion, motion + numSamples, 0.0f);
+    for (int v = 0; v < numVoices; ++v)
+    {
+        const float* input = voiceInputs[v];
+        for (int i = 0; i < numSamples; ++i)
+            motion[i] += input[i];
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+        motion[i] = fastTanh(motion[i] * 0.3f);
+
+    if (numSamples > 0)
+        totalBridgeMotion_ = motion[numSamples - 1];
+}
+
 //==============================================================================
 // SympatheticStringBank Implementation
 //==============================================================================
@@ -957,6 +902,29 @@ float SympatheticStringBank::processSample()
     return output * 0.3f / static_cast<float>(strings_.size());
 }
 
+void SympatheticStringBank::processBlock(const float* bridgeMotion, float* output, int numSamples)
+{
+    std::fill(output, output + numSamples, 0.0f);
+    if (!isEnabled())
+        return;
+
+    float stringOut[BLOCK_CHUNK_SIZE];
+    for (auto& string : strings_)
+    {
+        for (int offset = 0; offset < numSamples; offset += BLOCK_CHUNK_SIZE)
+        {
+            const int n = std::min(BLOCK_CHUNK_SIZE, numSamples - offset);
+            string.processBlock(stringOut, bridgeMotion + offset, BRIDGE_DRIVE_GAIN, n);
+            for (int i = 0; i < n; ++i)
+                output[offset + i] += stringOut[i];
+        }
+    }
+
+    const float scale = 0.3f / static_cast<float>(strings_.size());
+    for (int i = 0; i < numSamples; ++i)
+        output[i] *= scale;
+}
+
 //==============================================================================
 // AetherVoice Implementation
 //==============================================================================
@@ -982,8 +950,7 @@ void AetherVoice::noteOn(int note, float velocity)
     // This prevents muddy sound when changing notes
     string.reset();
 
-    // Use LookupTables for MIDI to frequency conversion
-    float frequency = SchillingerEcosystem::DSP::LookupTables::getInstance().midiToFreq(static_cast<float>(note));
+    float frequency = SharedTables::get().midiToFrequency(static_cast<float>(note));
 
     string.setFrequency(frequency);
 
@@ -1010,37 +977,21 @@ void AetherVoice::processBlock(float* output, int numSamples, double sampleRate)
         return;
     }
     
+    // The string loop does not depend on the bridge / body path below,
+    // so render it a chunk at a time through the block delay API
+    float stringBuffer[STRING_CHUNK_SIZE];
+
     for (int i = 0; i < numSamples; ++i)
     {
+        const int chunkIndex = i % STRING_CHUNK_SIZE;
+        if (chunkIndex == 0)
+            string.processBlock(stringBuffer, std::min(STRING_CHUNK_SIZE, numSamples - i));
+
         float excitation = fsm.getCurrentExcitation();
-        float stringOut = string.processSample();
+        float stringOut = stringBuffer[chunkIndex];
         
-        float processed;
-        if (sharedBridge != nullptr)
-        {
-            int voiceIndex = 0;
-            float reflected = sharedBridge->addStringEnergy(stringOut + excitation, voiceIndex);
-            stringOut = reflected;
-            
-            float bridgeEnergy = sharedBridge->getBridgeMotion();
-            float bodyOut = body.processSample(bridgeEnergy);
-            
-            float sympOut = 0.0f;
-            if (sympatheticStrings != nullptr)
-            {
-                if (i == 0)
-                    sympatheticStrings->exciteFromBridge(bridgeEnergy);
-                sympOut = sympatheticStrings->processSample();
-            }
-            
-            processed = (pedalboard != nullptr) ? pedalboard->processSample(bodyOut + sympOut * 0.3f) : (bodyOut + sympOut * 0.3f);
-        }
-        else
-        {
-            float bridgeEnergy = bridge.processString(stringOut + excitation);
-            float bodyOut = body.processSample(bridgeEnergy);
-            processed = (pedalboard != nullptr) ? pedalboard->processSample(bodyOut) : bodyOut;
-        }
+        float bridgeEnergy = bridge.processString(stringOut + excitation);
+        float processed = body.processSample(bridgeEnergy);
         
         fsm.update(1.0f / sampleRate);
         
@@ -1055,6 +1006,30 @@ void AetherVoice::processBlock(float* output, int numSamples, double sampleRate)
     }
 }
 
+void AetherVoice::renderBridgeInput(float* bridgeInput, float* gain, int numSamples, double sampleRate)
+{
+    string.processBlock(bridgeInput, numSamples);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        bridgeInput[i] += fsm.getCurrentExcitation();
+
+        fsm.update(1.0f / sampleRate);
+        gain[i] = fsm.getPreviousGain() + fsm.getCurrentGain();
+
+        age += 1.0f / sampleRate;
+
+        if (fsm.getCurrentState() == ArticulationState::IDLE)
+            isActive = false;
+    }
+}
+
+void AetherVoice::renderFromBridge(const float* bridgeMotion, const float* gain, float* output, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+        output[i] = body.processSample(bridgeMotion[i]) * gain[i];
+}
+
 //==============================================================================
 // AetherVoiceManager Implementation
 //==============================================================================
@@ -1063,6 +1038,11 @@ AetherVoiceManager::AetherVoiceManager() = default;
 
 void AetherVoiceManager::prepare(double sampleRate, int samplesPerBlock)
 {
+    sampleRate_ = sampleRate;
+    voiceOutputs_.prepare(std::max(samplesPerBlock, COUPLING_CHUNK_SIZE), NUM_VOICES);
+    if (sharedBridge_)
+        sharedBridge_->prepare(sampleRate, NUM_VOICES);
+
     for (auto& voice : voices_)
     {
         voice.string.prepare(sampleRate);
@@ -1102,6 +1082,8 @@ AetherVoice* AetherVoiceManager::findFreeVoice()
             oldest = &voice;
     }
     
+    if (telemetry_)
+        telemetry_->addEvent(TelemetryEvent::VoiceSteal);
     oldest->noteOff();
     return oldest;
 }
@@ -1146,20 +1128,50 @@ void AetherVoiceManager::allNotesOff()
     }
 }
 
+void AetherVoiceManager::setScratchBuffer(float* buffer, int size)
+{
+    if (buffer != nullptr && size > 0)
+    {
+        voiceBuffer_ = buffer;
+        voiceBufferSize_ = size;
+    }
+    else
+    {
+        voiceBuffer_ = fallbackVoiceBuffer_;
+        voiceBufferSize_ = FALLBACK_BUFFER_SIZE;
+    }
+}
+
 void AetherVoiceManager::processBlock(float* output, int numSamples, double sampleRate)
 {
+    if (sharedBridge_)
+    {
+        processCoupledBlock(output, numSamples, sampleRate);
+        return;
+    }
+
+    if (isParallel())
+    {
+        processParallelBlock(output, numSamples, sampleRate);
+        return;
+    }
+
+    Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
     std::fill(output, output + numSamples, 0.0f);
     
-    float temp[6][512];
-    
-    for (int v = 0; v < 6; ++v)
+    for (int offset = 0; offset < numSamples; offset += voiceBufferSize_)
     {
-        if (voices_[v].isActive)
+        const int n = std::min(voiceBufferSize_, numSamples - offset);
+
+        for (int v = 0; v < 6; ++v)
         {
-            voices_[v].processBlock(temp[v], numSamples, sampleRate);
-            
-            for (int i = 0; i < numSamples; ++i)
-                output[i] += temp[v][i];
+            if (voices_[v].isActive)
+            {
+                voices_[v].processBlock(voiceBuffer_, n, sampleRate);
+
+                for (int i = 0; i < n; ++i)
+                    output[offset + i] += voiceBuffer_[i];
+            }
         }
     }
     
@@ -1172,6 +1184,156 @@ void AetherVoiceManager::processBlock(float* output, int numSamples, double samp
     }
 }
 
+void AetherVoiceManager::processParallelBlock(float* output, int numSamples, double sampleRate)
+{
+    Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
+    std::fill(output, output + numSamples, 0.0f);
+    job_.sampleRate = sampleRate;
+
+    voiceOutputs_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        job_.numVoices = 0;
+        for (int v = 0; v < NUM_VOICES; ++v)
+        {
+            if (voices_[v].isActive)
+                job_.voices[job_.numVoices++] = v;
+        }
+        job_.numSamples = n;
+
+        dispatch(RenderStage::Voice, job_.numVoices);
+
+        // Summed in voice order, as in the serial path
+        for (int r = 0; r < job_.numVoices; ++r)
+        {
+            const float* voiceOut = voiceOutputs_.getBuffer(job_.voices[r]);
+            for (int i = 0; i < n; ++i)
+                output[offset + i] += voiceOut[i];
+        }
+    });
+
+    int activeCount = getActiveVoiceCount();
+    if (activeCount > 0)
+    {
+        float normalization = 1.5f / std::sqrt(static_cast<float>(activeCount));
+        for (int i = 0; i < numSamples; ++i)
+            output[i] *= normalization;
+    }
+}
+
+void AetherVoiceManager::processCoupledBlock(float* output, int numSamples, double sampleRate)
+{
+    // Three stages per chunk: voices -> shared bridge (once per sample for
+    // all voices) -> bodies and sympathetic strings. Cost is additive in
+    // voices and sympathetic strings. With a render pool the voice stages
+    // run in parallel and the bridge is the sync point between them.
+    const bool sympathetic = sympatheticStrings_ && sympatheticStrings_->isEnabled();
+
+    const int chunkSize = std::min(COUPLING_CHUNK_SIZE, voiceBufferSize_);
+    job_.sampleRate = sampleRate;
+
+    for (int offset = 0; offset < numSamples; offset += chunkSize)
+    {
+        const int n = std::min(chunkSize, numSamples - offset);
+        float* out = output + offset;
+
+        const float* inputs[NUM_VOICES];
+        int numRendering = 0;
+
+        for (int v = 0; v < NUM_VOICES; ++v)
+        {
+            if (!voices_[v].isActive)
+                continue;
+            job_.voices[numRendering] = v;
+            inputs[numRendering] = bridgeInputs_[v];
+            ++numRendering;
+        }
+        job_.numVoices = numRendering;
+        job_.numSamples = n;
+        job_.sympathetic = sympathetic;
+
+        {
+            Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
+            dispatch(RenderStage::BridgeInput, numRendering);
+        }
+
+        {
+            Telemetry::Scope bodyScope(telemetry_, TelemetryStage::Body);
+            sharedBridge_->processBlock(inputs, numRendering, bridgeMotion_, n);
+
+            // The sympathetic bank rings on the bridge even between notes
+            dispatch(RenderStage::FromBridge, numRendering + (sympathetic ? 1 : 0));
+        }
+
+        std::fill(out, out + n, 0.0f);
+        for (int r = 0; r < numRendering; ++r)
+        {
+            const float* voiceOut = voiceOutputs_.getBuffer(job_.voices[r]);
+            for (int i = 0; i < n; ++i)
+                out[i] += voiceOut[i];
+        }
+
+        if (numRendering > 0)
+        {
+            float normalization = 1.5f / std::sqrt(static_cast<float>(numRendering));
+            for (int i = 0; i < n; ++i)
+                out[i] *= normalization;
+        }
+
+        if (sympathetic)
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] += sympatheticOut_[i] * 0.3f;
+        }
+    }
+}
+
+void AetherVoiceManager::dispatch(RenderStage stage, int numTasks)
+{
+    job_.stage = stage;
+
+    if (isParallel())
+    {
+        renderPool_->run(&AetherVoiceManager::renderTask, this, numTasks);
+        return;
+    }
+
+    for (int task = 0; task < numTasks; ++task)
+        renderTask(this, task, 0);
+}
+
+void AetherVoiceManager::renderTask(void* context, int task, int /*participant*/)
+{
+    // Each task touches only its own voice and buffers
+    auto& self = *static_cast<AetherVoiceManager*>(context);
+    const RenderJob& job = self.job_;
+    const int n = job.numSamples;
+
+    if (task == job.numVoices)
+    {
+        self.sympatheticStrings_->processBlock(self.bridgeMotion_, self.sympatheticOut_, n);
+        return;
+    }
+
+    const int v = job.voices[task];
+    AetherVoice& voice = self.voices_[v];
+
+    switch (job.stage)
+    {
+        case RenderStage::Voice:
+            voice.processBlock(self.voiceOutputs_.getBuffer(v), n, job.sampleRate);
+            break;
+
+        case RenderStage::BridgeInput:
+            voice.renderBridgeInput(self.bridgeInputs_[v], self.voiceGains_[v], n, job.sampleRate);
+            break;
+
+        case RenderStage::FromBridge:
+            voice.renderFromBridge(self.bridgeMotion_, self.voiceGains_[v],
+                                   self.voiceOutputs_.getBuffer(v), n);
+            break;
+    }
+}
+
 int AetherVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -1187,16 +1349,11 @@ void AetherVoiceManager::enableSharedBridge(bool enabled)
         if (!sharedBridge_)
         {
             sharedBridge_ = std::make_unique<SharedBridgeCoupling>();
-            sharedBridge_->prepare(48000.0, 6);
-            
-            for (auto& voice : voices_)
-                voice.sharedBridge = sharedBridge_.get();
+            sharedBridge_->prepare(sampleRate_, NUM_VOICES);
         }
     }
     else
     {
-        for (auto& voice : voices_)
-            voice.sharedBridge = nullptr;
         sharedBridge_.reset();
     }
 }
@@ -1205,8 +1362,6 @@ void AetherVoiceManager::enableSympatheticStrings(const SympatheticStringBank::S
 {
     if (!config.enabled)
     {
-        for (auto& voice : voices_)
-            voice.sympatheticStrings = nullptr;
         sympatheticStrings_.reset();
         return;
     }
@@ -1214,10 +1369,7 @@ void AetherVoiceManager::enableSympatheticStrings(const SympatheticStringBank::S
     if (!sympatheticStrings_)
         sympatheticStrings_ = std::make_unique<SympatheticStringBank>();
     
-    sympatheticStrings_->prepare(48000.0, config);
-    
-    for (auto& voice : voices_)
-        voice.sympatheticStrings = sympatheticStrings_.get();
+    sympatheticStrings_->prepare(sampleRate_, config);
 }
 
 //==============================================================================
@@ -1230,9 +1382,10 @@ RATDistortion::RATDistortion()
     asymmetry = 1.0f;
 }
 
-void RATDistortion::prepare(double sampleRate)
+void RATDistortion::prepare(double sampleRate, int maxBlockSize)
 {
     sr = sampleRate;
+    oversampler_.prepare(maxBlockSize);
     preFilter_.prepare(sampleRate);
     preFilter_.setType(TPTFilter::Type::lowpass);
     preFilter_.setCutoffFrequency(4000.0f);
@@ -1246,6 +1399,7 @@ void RATDistortion::reset()
 {
     preFilter_.reset();
     toneFilter_.reset();
+    oversampler_.reset();
 }
 
 void RATDistortion::setDiodeType(DiodeType type)
@@ -1285,7 +1439,7 @@ float RATDistortion::processSample(float input)
     else
     {
         float excess = absIn - threshold;
-        clipped = threshold + std::tanh(excess * asymmetry) * 0.3f;
+        clipped = threshold + fastTanh(excess * asymmetry) * 0.3f;
     }
     
     clipped *= sign;
@@ -1297,13 +1451,48 @@ float RATDistortion::processSample(float input)
     return toneFiltered * output;
 }
 
+void RATDistortion::processBlock(const float* input, float* output, int numSamples)
+{
+    // Tone depends only on the filter knob: one coefficient update per block
+    toneFilter_.setCutoffFrequency(200.0f + std::pow(filter, 0.3f) * 4800.0f);
+
+    for (int i = 0; i < numSamples; ++i)
+        output[i] = preFilter_.processSample(input[i]) * drive;
+
+    const float clipThreshold = threshold;
+    const float clipAsymmetry = asymmetry;
+    oversampler_.process(output, numSamples, [clipThreshold, clipAsymmetry](float* x, int n)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            float absIn = std::abs(x[i]);
+            float excess = std::max(0.0f, absIn - clipThreshold);
+            float clipped = std::min(absIn, clipThreshold) + fastTanh(excess * clipAsymmetry) * 0.3f;
+            x[i] = std::copysign(clipped, x[i]);
+        }
+    });
+
+    for (int i = 0; i < numSamples; ++i)
+        output[i] = toneFilter_.processSample(output[i]) * this->output;
+}
+
 //==============================================================================
 // Pedal Implementation
 //==============================================================================
 
-void Pedal::prepare(double sampleRate)
+void Pedal::prepare(double sampleRate, int maxBlockSize)
+{
+    rat.prepare(sampleRate, maxBlockSize);
+    oversampler.prepare(maxBlockSize);
+    clipper.reset();
+}
+
+void Pedal::setOversampling(int factor)
 {
-    rat.prepare(sampleRate);
+    if (factor != oversampler.getFactor())
+        clipper.reset();
+    oversampler.setFactor(factor);
+    rat.setOversampling(factor);
 }
 
 float Pedal::processSample(float input)
@@ -1318,7 +1507,7 @@ float Pedal::processSample(float input)
         case PedalType::Overdrive:
             {
                 float driveAmount = 1.0f + param1 * 4.0f;
-                wet = std::tanh(input * driveAmount) * 0.8f;
+                wet = fastTanh(input * driveAmount) * 0.8f;
             }
             break;
         case PedalType::Distortion:
@@ -1341,6 +1530,59 @@ float Pedal::processSample(float input)
     return input * (1.0f - mix) + wet * mix;
 }
 
+bool Pedal::isPassThrough() const
+{
+    // Compressor / Octaver / Phaser / Reverb have no kernels yet: dry == wet
+    return !enabled || (type != PedalType::Overdrive && type != PedalType::Distortion && type != PedalType::RAT);
+}
+
+void Pedal::processBlock(float* buffer, float* wet, int numSamples)
+{
+    if (isPassThrough())
+        return;
+
+    // Full mix writes straight into the buffer
+    float* target = (mix >= 1.0f) ? buffer : wet;
+
+    switch (type)
+    {
+        case PedalType::Overdrive:
+            {
+                const float driveAmount = 1.0f + param1 * 4.0f;
+                std::copy(buffer, buffer + numSamples, target);
+                oversampler.process(target, numSamples, [driveAmount](float* x, int n)
+                {
+                    processTanhBlock(x, x, n, driveAmount, 0.8f);
+                });
+            }
+            break;
+        case PedalType::Distortion:
+            {
+                // ADAA on top of oversampling: clean even at 1x
+                const float driveAmount = 1.0f + param1 * 9.0f;
+                std::copy(buffer, buffer + numSamples, target);
+                oversampler.process(target, numSamples, [this, driveAmount](float* x, int n)
+                {
+                    clipper.process(x, n, driveAmount);
+                });
+            }
+            break;
+        case PedalType::RAT:
+            rat.drive = 1.0f + param1 * 9.0f;
+            rat.filter = param2;
+            rat.processBlock(buffer, target, numSamples);
+            break;
+        default:
+            return;
+    }
+
+    if (target == wet)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            buffer[i] = buffer[i] * (1.0f - mix) + wet[i] * mix;
+    }
+}
+
 //==============================================================================
 // Pedalboard Implementation
 //==============================================================================
@@ -1350,7 +1592,13 @@ Pedalboard::Pedalboard() = default;
 void Pedalboard::prepare(double sampleRate, int samplesPerBlock)
 {
     for (auto& pedal : pedals_)
-        pedal.prepare(sampleRate);
+    {
+        pedal.prepare(sampleRate, std::max(samplesPerBlock, 1));
+        pedal.setOversampling(oversampling_);
+    }
+
+    scratch_.prepare(std::max(samplesPerBlock, 1), NUM_SCRATCH_BUFFERS);
+    rebuildChain();
 }
 
 void Pedalboard::reset() {}
@@ -1394,19 +1642,95 @@ float Pedalboard::processSample(float input)
     }
 }
 
+void Pedalboard::processBlock(float* buffer, int numSamples)
+{
+    if (chainLength_ == 0 || scratch_.getMaxBlockSize() == 0)
+        return;
+
+    scratch_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        float* block = buffer + offset;
+        float* wet = scratch_.getBuffer(SCRATCH_WET);
+
+        if (!parallelMode_)
+        {
+            for (int c = 0; c < chainLength_; ++c)
+                pedals_[chain_[c]].processBlock(block, wet, n);
+            return;
+        }
+
+        // Parallel: every enabled pedal sees the dry bus, sum normalized by sqrt(count)
+        float* dry = scratch_.getBuffer(SCRATCH_DRY);
+        float* sum = scratch_.getBuffer(SCRATCH_SUM);
+        std::copy(block, block + n, dry);
+        std::fill(sum, sum + n, 0.0f);
+
+        for (int c = 0; c < chainLength_; ++c)
+        {
+            std::copy(dry, dry + n, block);
+            pedals_[chain_[c]].processBlock(block, wet, n);
+            for (int i = 0; i < n; ++i)
+                sum[i] += block[i];
+        }
+
+        const float norm = 1.0f / std::sqrt(static_cast<float>(chainLength_));
+        for (int i = 0; i < n; ++i)
+            block[i] = sum[i] * norm;
+    });
+}
+
+void Pedalboard::rebuildChain()
+{
+    chainLength_ = 0;
+
+    if (parallelMode_)
+    {
+        // Enabled pass-through pedals still add a dry copy to the parallel sum
+        for (int index = 0; index < NUM_PEDALS; ++index)
+        {
+            if (pedals_[index].enabled)
+                chain_[chainLength_++] = index;
+        }
+        return;
+    }
+
+    for (int index : routingOrder_)
+    {
+        if (index >= 0 && index < NUM_PEDALS && !pedals_[index].isPassThrough())
+            chain_[chainLength_++] = index;
+    }
+}
+
 void Pedalboard::setPedal(int index, PedalType type, bool enable)
 {
-    if (index >= 0 && index < 8)
+    if (index >= 0 && index < NUM_PEDALS)
     {
         pedals_[index].type = type;
         pedals_[index].enabled = enable;
+        rebuildChain();
     }
 }
 
 void Pedalboard::setRouting(int index, int pedalIndex)
 {
-    if (index >= 0 && index < 8 && pedalIndex >= 0 && pedalIndex < 8)
+    if (index >= 0 && index < NUM_PEDALS && pedalIndex >= 0 && pedalIndex < NUM_PEDALS)
+    {
         routingOrder_[index] = pedalIndex;
+        rebuildChain();
+    }
+}
+
+void Pedalboard::setParallelMode(bool parallel)
+{
+    parallelMode_ = parallel;
+    rebuildChain();
+}
+
+void Pedalboard::setOversampling(int factor)
+{
+    oversampling_ = std::max(1, std::min(Oversampler::MAX_FACTOR, factor));
+    for (auto& pedal : pedals_)
+        pedal.setOversampling(oversampling_);
 }
 
 //==============================================================================
@@ -1415,6 +1739,8 @@ void Pedalboard::setRouting(int index, int pedalIndex)
 
 AetherPureDSP::AetherPureDSP()
 {
+    voiceManager_.setTelemetry(&telemetry_);
+    prepareScratch(DEFAULT_MAX_BLOCK_SIZE);
     voiceManager_.prepare(48000.0, 512);
     pedalboard_.prepare(48000.0, 512);
 }
@@ -1426,8 +1752,14 @@ bool AetherPureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
     
+    prepareScratch(blockSize);
+
+    // Shared sine / note tables: built by the first instance, reused by the rest
+    SharedTables::get();
+
     voiceManager_.prepare(sampleRate, blockSize);
     pedalboard_.prepare(sampleRate, blockSize);
+    telemetry_.prepare(sampleRate);
     
     return true;
 }
@@ -1439,24 +1771,46 @@ void AetherPureDSP::reset()
 
 void AetherPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    ScopedFlushDenormals noDenormals;
+    Telemetry::BlockScope telemetryBlock(telemetry_, numSamples);
+
     // Clear all outputs
     for (int ch = 0; ch < numChannels; ++ch)
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
 
-    // Process voices (mono output) using real-time safe stack buffer
-    // Assert for safety in debug builds - block size should never exceed MAX_BLOCK_SIZE
-    assert(numSamples <= MAX_BLOCK_SIZE && "Block size exceeds maximum buffer size");
+    // Process voices (mono output) in chunks of the prepared scratch size
+    float* mix = scratch_.getBuffer(SCRATCH_MIX);
+    scratch_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        voiceManager_.processBlock(mix, n, sampleRate_);
 
-    voiceManager_.processBlock(tempBuffer_, numSamples, sampleRate_);
+        // Effects bus: pedals run once on the voice sum, not per voice
+        {
+            Telemetry::Scope effectsScope(telemetry_, TelemetryStage::Effects);
+            pedalboard_.processBlock(mix, n);
+        }
 
-    // Copy to all channels
-    for (int ch = 0; ch < numChannels; ++ch)
+        // Copy to all channels
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int i = 0; i < n; ++i)
+                outputs[ch][offset + i] = mix[i] * params_.masterVolume;
+        }
+    });
+
+    if (Telemetry::ENABLED)
     {
-        for (int i = 0; i < numSamples; ++i)
-            outputs[ch][i] = tempBuffer_[i] * params_.masterVolume;
+        for (int ch = 0; ch < numChannels; ++ch)
+            telemetry_.countDenormals(outputs[ch], numSamples);
     }
 }
 
+void AetherPureDSP::prepareScratch(int maxBlockSize)
+{
+    scratch_.prepare(std::max(maxBlockSize, 1), NUM_SCRATCH_BUFFERS);
+    voiceManager_.setScratchBuffer(scratch_.getBuffer(SCRATCH_VOICE), scratch_.getMaxBlockSize());
+}
+
 void AetherPureDSP::handleEvent(const ScheduledEvent& event)
 {
     if (event.type == ScheduledEvent::NOTE_ON)
@@ -1467,6 +1821,15 @@ void AetherPureDSP::handleEvent(const ScheduledEvent& event)
     {
         voiceManager_.handleNoteOff(event.data.note.midiNote);
     }
+    else if (event.type == ScheduledEvent::CONTROL_CHANGE
+             && event.data.controlChange.controllerNumber == MIDI_CC_ALL_NOTES_OFF)
+    {
+        voiceManager_.allNotesOff();
+    }
+    else if (event.type == ScheduledEvent::RESET)
+    {
+        voiceManager_.reset();
+    }
 }
 
 float AetherPureDSP::getParameter(const char* paramId) const
@@ -1481,6 +1844,7 @@ float AetherPureDSP::getParameter(const char* paramId) const
     if (id == "sympatheticCoupling") return static_cast<float>(params_.sympatheticCoupling);
     if (id == "material") return static_cast<float>(params_.material);
     if (id == "bodyPreset") return static_cast<float>(params_.bodyPreset);
+    if (id == "pedalOversampling") return static_cast<float>(params_.pedalOversampling);
 
     return 0.0f;
 }
@@ -1500,6 +1864,7 @@ void AetherPureDSP::setParameter(const char* paramId, float value)
     else if (id == "sympatheticCoupling") params_.sympatheticCoupling = value;
     else if (id == "material") params_.material = value;
     else if (id == "bodyPreset") params_.bodyPreset = static_cast<int>(value);
+    else if (id == "pedalOversampling") params_.pedalOversampling = static_cast<int>(value);
 
     // Log parameter change (shared telemetry infrastructure)
     LOG_PARAMETER_CHANGE("NatureAether", paramId, oldValue, value);
@@ -1521,6 +1886,7 @@ bool AetherPureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const
     writeJsonParameter("damping", params_.damping, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("brightness", params_.brightness, jsonBuffer, offset, jsonBufferSize);
     writeJsonParameter("stiffness", params_.stiffness, jsonBuffer, offset, jsonBufferSize);
+    writeJsonParameter("pedalOversampling", params_.pedalOversampling, jsonBuffer, offset, jsonBufferSize);
 
     // Remove trailing comma and add closing brace
     if (offset > 1 && jsonBuffer[offset - 1] == ',')
@@ -1569,99 +1935,101 @@ bool AetherPureDSP::loadUPFSPreset(const char* jsonData)
     // In UPFS v1.0 for Aether, parameters are directly in "parameters" object
     // We need to map UPFS parameter names to Aether DSP parameter names
 
+    // One pass over the text; lookups below are table hits
+    const JsonNumberTable<> fields(jsonData);
     double value;
 
     // Map exciter parameters to DSP parameters
-    if (parseJsonParameter(jsonData, "exciter_noise_color", value))
+    if (fields.find("exciter_noise_color", value))
         params_.brightness = value;  // Maps to brightness
 
-    if (parseJsonParameter(jsonData, "exciter_gain", value))
+    if (fields.find("exciter_gain", value))
         params_.attackVelocity = value;
 
-    if (parseJsonParameter(jsonData, "exciter_attack", value))
+    if (fields.find("exciter_attack", value))
         params_.attackVelocity = value * 0.8;
 
-    if (parseJsonParameter(jsonData, "exciter_decay", value))
+    if (fields.find("exciter_decay", value))
         params_.damping = 0.9 + (value * 0.099);
 
-    if (parseJsonParameter(jsonData, "exciter_sustain", value))
+    if (fields.find("exciter_sustain", value))
         params_.bridgeCoupling = value;
 
-    if (parseJsonParameter(jsonData, "exciter_release", value))
+    if (fields.find("exciter_release", value))
         params_.damping = std::max(0.9, params_.damping * (1.0 - (value * 0.01)));
 
     // Map resonator parameters to DSP parameters
-    if (parseJsonParameter(jsonData, "resonator_brightness", value))
+    if (fields.find("resonator_brightness", value))
         params_.brightness = value;
 
-    if (parseJsonParameter(jsonData, "resonator_decay", value))
+    if (fields.find("resonator_decay", value))
         params_.damping = 0.9 + (value * 0.099);
 
-    if (parseJsonParameter(jsonData, "resonator_mode_count", value))
+    if (fields.find("resonator_mode_count", value))
         params_.stiffness = value / 128.0;  // Maps to stiffness
 
     // Map feedback parameters to DSP parameters
-    if (parseJsonParameter(jsonData, "feedback_amount", value))
+    if (fields.find("feedback_amount", value))
         params_.bridgeCoupling = value;
 
-    if (parseJsonParameter(jsonData, "feedback_saturation", value))
+    if (fields.find("feedback_saturation", value))
         params_.nonlinearity = value / 3.0;  // Scale 0-3 to 0-1
 
-    if (parseJsonParameter(jsonData, "feedback_mix", value))
+    if (fields.find("feedback_mix", value))
         params_.bridgeCoupling = value;
 
     // Map filter parameters to DSP parameters
-    if (parseJsonParameter(jsonData, "filter_cutoff", value))
+    if (fields.find("filter_cutoff", value))
         params_.brightness = value;
 
-    if (parseJsonParameter(jsonData, "filter_resonance", value))
+    if (fields.find("filter_resonance", value))
         params_.damping = 1.0 - (value * 0.1);  // Inverse mapping
 
     // Map amplitude envelope parameters to DSP parameters
-    if (parseJsonParameter(jsonData, "amp_attack", value))
+    if (fields.find("amp_attack", value))
         params_.attackVelocity = value;
 
-    if (parseJsonParameter(jsonData, "amp_decay", value))
+    if (fields.find("amp_decay", value))
     {
         double ampDamping = 0.9 + (value * 0.099);
         params_.damping = (params_.damping + ampDamping) / 2.0;
     }
 
-    if (parseJsonParameter(jsonData, "amp_sustain", value))
+    if (fields.find("amp_sustain", value))
         params_.bridgeCoupling = value;
 
-    if (parseJsonParameter(jsonData, "amp_release", value))
+    if (fields.find("amp_release", value))
         params_.damping = std::max(0.9, params_.damping * (1.0 - (value * 0.01)));
 
     // Direct parameter mappings (these override the calculated values)
-    if (parseJsonParameter(jsonData, "masterVolume", value))
+    if (fields.find("masterVolume", value))
         params_.masterVolume = value;
 
-    if (parseJsonParameter(jsonData, "damping", value))
+    if (fields.find("damping", value))
         params_.damping = value;
 
-    if (parseJsonParameter(jsonData, "brightness", value))
+    if (fields.find("brightness", value))
         params_.brightness = value;
 
-    if (parseJsonParameter(jsonData, "stiffness", value))
+    if (fields.find("stiffness", value))
         params_.stiffness = value;
 
-    if (parseJsonParameter(jsonData, "dispersion", value))
+    if (fields.find("dispersion", value))
         params_.dispersion = value;
 
-    if (parseJsonParameter(jsonData, "sympatheticCoupling", value))
+    if (fields.find("sympatheticCoupling", value))
         params_.sympatheticCoupling = value;
 
-    if (parseJsonParameter(jsonData, "material", value))
+    if (fields.find("material", value))
         params_.material = value;
 
-    if (parseJsonParameter(jsonData, "bodyPreset", value))
+    if (fields.find("bodyPreset", value))
         params_.bodyPreset = static_cast<int>(value);
 
-    if (parseJsonParameter(jsonData, "bridgeCoupling", value))
+    if (fields.find("bridgeCoupling", value))
         params_.bridgeCoupling = value;
 
-    if (parseJsonParameter(jsonData, "nonlinearity", value))
+    if (fields.find("nonlinearity", value))
         params_.nonlinearity = value;
 
     applyParameters();
@@ -1677,6 +2045,8 @@ bool AetherPureDSP::loadPreset(const char* jsonData)
     }
 
     // Legacy format support (original implementation)
+    // One pass over the text; lookups below are table hits
+    const JsonNumberTable<> fields(jsonData);
     double value;
     int paramsFound = 0;
 
@@ -1688,82 +2058,82 @@ bool AetherPureDSP::loadPreset(const char* jsonData)
     double baseNonlinearity = 0.1;
 
     // Excitation parameters (mapped to attackVelocity and bowPressure)
-    if (parseJsonParameter(jsonData, "exciter_gain", value)) {
+    if (fields.find("exciter_gain", value)) {
         params_.attackVelocity = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "exciter_attack", value)) {
+    if (fields.find("exciter_attack", value)) {
         params_.attackVelocity = value * 0.8;  // Scale to appropriate range
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "exciter_noise_color", value)) {
+    if (fields.find("exciter_noise_color", value)) {
         baseBrightness = value;  // Map noise color to brightness
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "exciter_decay", value)) {
+    if (fields.find("exciter_decay", value)) {
         // CRITICAL FIX: Combine with base damping instead of overwriting
         baseDamping = 0.9 + (value * 0.099);
         paramsFound++;
     }
 
     // Resonator parameters (mapped to damping, brightness, stiffness)
-    if (parseJsonParameter(jsonData, "resonator_brightness", value)) {
+    if (fields.find("resonator_brightness", value)) {
         baseBrightness = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "resonator_decay", value)) {
+    if (fields.find("resonator_decay", value)) {
         // CRITICAL FIX: Combine with base damping instead of overwriting
         baseDamping = 0.9 + (value * 0.099);
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "resonator_mode_count", value)) {
+    if (fields.find("resonator_mode_count", value)) {
         // Mode count affects stiffness (more modes = stiffer)
         baseStiffness = value / 128.0;  // Scale 0-64 to 0-0.5
         paramsFound++;
     }
 
     // Feedback parameters (mapped to nonlinearity and bridgeCoupling)
-    if (parseJsonParameter(jsonData, "feedback_amount", value)) {
+    if (fields.find("feedback_amount", value)) {
         baseBridgeCoupling = value;  // Feedback affects bridge coupling
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "feedback_saturation", value)) {
+    if (fields.find("feedback_saturation", value)) {
         // CRITICAL FIX: Scale 0-3 preset range to 0-1 DSP range
         baseNonlinearity = value / 3.0;  // Map preset saturation to DSP nonlinearity
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "feedback_mix", value)) {
+    if (fields.find("feedback_mix", value)) {
         baseBridgeCoupling = value;  // Mix affects coupling
         paramsFound++;
     }
 
     // Filter parameters (mapped to brightness and damping)
-    if (parseJsonParameter(jsonData, "filter_cutoff", value)) {
+    if (fields.find("filter_cutoff", value)) {
         baseBrightness = value;  // Cutoff affects brightness
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "filter_resonance", value)) {
+    if (fields.find("filter_resonance", value)) {
         // CRITICAL FIX: Inverse mapping to 0.9-0.999 range
         baseDamping = 1.0 - (value * 0.1);  // Map preset resonance to DSP damping (inverse)
         paramsFound++;
     }
 
     // Amplitude envelope parameters (mapped to attackVelocity)
-    if (parseJsonParameter(jsonData, "amp_attack", value)) {
+    if (fields.find("amp_attack", value)) {
         params_.attackVelocity = value;  // Attack affects velocity
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "amp_decay", value)) {
+    if (fields.find("amp_decay", value)) {
         // CRITICAL FIX: Combine with base damping instead of overwriting
         double ampDamping = 0.9 + (value * 0.099);
         baseDamping = (baseDamping + ampDamping) / 2.0;  // Average them
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "amp_sustain", value)) {
+    if (fields.find("amp_sustain", value)) {
         baseBridgeCoupling = value;  // Sustain affects coupling
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "amp_release", value)) {
+    if (fields.find("amp_release", value)) {
         // CRITICAL FIX: Don't multiply, instead reduce damping slightly based on release
         // Longer release = slightly more damping to prevent infinite sustain
         baseDamping = std::max(0.9, baseDamping * (1.0 - (value * 0.01)));
@@ -1778,38 +2148,42 @@ bool AetherPureDSP::loadPreset(const char* jsonData)
     params_.nonlinearity = baseNonlinearity;
 
     // Direct parameter mappings (names match) - these override the calculated values
-    if (parseJsonParameter(jsonData, "masterVolume", value)) {
+    if (fields.find("masterVolume", value)) {
         params_.masterVolume = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "damping", value)) {
+    if (fields.find("damping", value)) {
         params_.damping = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "brightness", value)) {
+    if (fields.find("brightness", value)) {
         params_.brightness = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "stiffness", value)) {
+    if (fields.find("stiffness", value)) {
         params_.stiffness = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "dispersion", value)) {
+    if (fields.find("dispersion", value)) {
         params_.dispersion = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "sympatheticCoupling", value)) {
+    if (fields.find("sympatheticCoupling", value)) {
         params_.sympatheticCoupling = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "material", value)) {
+    if (fields.find("material", value)) {
         params_.material = value;
         paramsFound++;
     }
-    if (parseJsonParameter(jsonData, "bodyPreset", value)) {
+    if (fields.find("bodyPreset", value)) {
         params_.bodyPreset = static_cast<int>(value);
         paramsFound++;
     }
+    if (fields.find("pedalOversampling", value)) {
+        params_.pedalOversampling = static_cast<int>(value);
+        paramsFound++;
+    }
 
     applyParameters();
     return true;
@@ -1841,6 +2215,7 @@ void AetherPureDSP::applyParameters()
 {
     // Apply loaded parameters to all voices via the voice manager
     voiceManager_.applyVoiceParameters(*this);
+    pedalboard_.setOversampling(params_.pedalOversampling);
 }
 
 void AetherVoiceManager::applyVoiceParameters(const AetherPureDSP& dsp)
@@ -1891,7 +2266,7 @@ void AetherVoiceManager::applyVoiceParameters(const AetherPureDSP& dsp)
 
 float AetherPureDSP::softClip(float x) const
 {
-    return std::tanh(x);
+    return fastTanh(x);
 }
 
 bool AetherPureDSP::writeJsonParameter(const char* name, double value, char* buffer, int& offset, int bufferSize) const
@@ -1904,65 +2279,6 @@ bool AetherPureDSP::writeJsonParameter(const char* name, double value, char* buf
     return true;
 }
 
-bool AetherPureDSP::parseJsonParameter(const char* json, const char* param, double& value) const
-{
-    // Handle nested JSON structure where parameters are inside "parameters": { ... }
-    const char* parametersStart = strstr(json, "\"parameters\":");
-    if (!parametersStart)
-    {
-        // Fall back to top-level search for backward compatibility
-        std::string search = "\"";
-        search += param;
-        search += "\":";
-
-        const char* pos = strstr(json, search.c_str());
-        if (!pos)
-            return false;
-
-        pos += search.length();
-        value = atof(pos);
-        return true;
-    }
-
-    // Find the opening brace after "parameters":
-    const char* braceStart = strchr(parametersStart, '{');
-    if (!braceStart)
-        return false;
-
-    // Search for the parameter within the parameters object
-    std::string search = "\"";
-    search += param;
-    search += "\":";
-
-    const char* pos = strstr(braceStart, search.c_str());
-    if (!pos)
-        return false;
-
-    // Move past the parameter name and colon
-    pos += search.length();
-
-    // Skip whitespace
-    while (*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\r')
-        pos++;
-
-    // Parse the value (handle both numbers and booleans)
-    if (strncmp(pos, "true", 4) == 0)
-    {
-        value = 1.0;
-        return true;
-    }
-    else if (strncmp(pos, "false", 5) == 0)
-    {
-        value = 0.0;
-        return true;
-    }
-    else
-    {
-        value = atof(pos);
-        return true;
-    }
-}
-
 //==============================================================================
 // Static Factory (No runtime registration for tvOS hardening)
 //==============================================================================
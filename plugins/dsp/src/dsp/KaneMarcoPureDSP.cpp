@@ -13,7 +13,8 @@
 */
 
 #include "dsp/NaturePureDSP.h"
-#include "../../../../include/dsp/LookupTables.h"
+#include "../../../../include/dsp/SharedTables.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
 #include "../../../../include/dsp/DSPLogging.h"
 #include "../../../../../libraries/upfs/PresetParser.h"
 #include <cstring>
@@ -28,17 +29,9 @@ namespace DSP {
 
 static inline double midiToFrequency(int midiNote, double pitchBendSemitones)
 {
-    // Use LookupTables for MIDI to frequency conversion
-    using namespace SchillingerEcosystem::DSP;
-    float freq = LookupTables::getInstance().midiToFreq(static_cast<float>(midiNote));
-    if (pitchBendSemitones != 0.0)
-    {
-        freq = LookupTables::getInstance().midiToFreqWithBend(
-            static_cast<float>(midiNote),
-            static_cast<float>(pitchBendSemitones)
-        );
-    }
-    return static_cast<double>(freq);
+    // Shared note table; a bend adds one std::exp2
+    const float note = static_cast<float>(midiNote + pitchBendSemitones);
+    return static_cast<double>(SharedTables::get().midiToFrequency(note));
 }
 
 static inline double lerp(double a, double b, double t)
@@ -62,6 +55,9 @@ Oscillator::Oscillator()
 
 void Oscillator::prepare(double sampleRate)
 {
+    // Build the shared tables here rather than on the first audio callback
+    WavetableBank::get();
+    SharedTables::get();
     reset();
 }
 
@@ -106,14 +102,16 @@ void Oscillator::setIsFMCarrier(bool isCarrier)
     isFMCcarrier = isCarrier;
 }
 
-float Oscillator::processSample()
+double Oscillator::applyWarp(double p, float warpAmount)
 {
-    // Apply phase warp: phase_warped = phase + (warp * sin(2π * phase))
-    // Use LookupTables for sine calculation
-    double warpedPhase = phase + (warp * SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(phase * 2.0 * M_PI)));
+    // Phase warp: phase_warped = phase + (warp * sin(2π * phase))
+    return p + (warpAmount * SineTable::get().lookupWrapped(static_cast<float>(p)));
+}
 
+float Oscillator::processSample()
+{
     // Generate waveform from warped phase
-    float output = generateWaveform(warpedPhase);
+    float output = generateWaveform(applyWarp(phase, warp));
 
     // Advance phase
     phase += phaseIncrement;
@@ -128,11 +126,8 @@ float Oscillator::processSampleWithFM(float modulationInput)
     // Phase modulation from FM input
     double modulatedPhase = phase + (fmDepth * modulationInput);
 
-    // Apply warp using LookupTables for sine calculation
-    double warpedPhase = modulatedPhase + (warp * SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(modulatedPhase * 2.0 * M_PI)));
-
-    // Generate waveform
-    float output = generateWaveform(warpedPhase);
+    // Generate waveform from warped, modulated phase
+    float output = generateWaveform(applyWarp(modulatedPhase, warp));
 
     // Advance phase
     phase += phaseIncrement;
@@ -142,31 +137,102 @@ float Oscillator::processSampleWithFM(float modulationInput)
     return output;
 }
 
+void Oscillator::processBlock(float* output, int numSamples)
+{
+    // Waveform, warp, pulse width and pitch are constant across the block
+    const Waveform shape = waveform;
+    const float warpAmount = warp;
+    const float pw = pulseWidth;
+    const double dt = phaseIncrement;
+    const int tableShape = wavetableShape(shape);
+    double p = phase;
+
+    if (tableShape >= 0)
+    {
+        const float* table = WavetableBank::get().table(static_cast<WavetableBank::Shape>(tableShape),
+                                                        WavetableBank::levelForIncrement(dt));
+        if (warpAmount == 0.0f)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = WavetableBank::lookup(table, p);
+                p += dt;
+                if (p >= 1.0)
+                    p -= 1.0;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = WavetableBank::lookup(table, wrapPhase(applyWarp(p, warpAmount)));
+                p += dt;
+                if (p >= 1.0)
+                    p -= 1.0;
+            }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = evaluate(shape, applyWarp(p, warpAmount), dt, pw);
+            p += dt;
+            if (p >= 1.0)
+                p -= 1.0;
+        }
+    }
+
+    phase = p;
+}
+
 float Oscillator::generateWaveform(double p) const
+{
+    return evaluate(waveform, p, phaseIncrement, pulseWidth);
+}
+
+double Oscillator::wrapPhase(double p)
 {
     p = std::fmod(p, 1.0);
     if (p < 0.0) p += 1.0;
+    return p;
+}
 
-    switch (waveform)
+int Oscillator::wavetableShape(Waveform shape)
+{
+    switch (shape)
+    {
+        case Waveform::SAW:      return WavetableBank::SAW;
+        case Waveform::SQUARE:   return WavetableBank::SQUARE;
+        case Waveform::TRIANGLE: return WavetableBank::TRIANGLE;
+        default:                 return -1;
+    }
+}
+
+float Oscillator::evaluate(Waveform shape, double p, double dt, float pw)
+{
+    p = wrapPhase(p);
+
+    switch (shape)
     {
         case Waveform::SAW:
-            return polyBlepSaw(p);
         case Waveform::SQUARE:
-            return polyBlepSquare(p);
         case Waveform::TRIANGLE:
-            return polyBlepTriangle(p);
+            return WavetableBank::lookup(
+                WavetableBank::get().table(static_cast<WavetableBank::Shape>(wavetableShape(shape)),
+                                           WavetableBank::levelForIncrement(dt)),
+                p);
         case Waveform::SINE:
-            // Use LookupTables for sine calculation
-            return SchillingerEcosystem::DSP::fastSineLookup(static_cast<float>(p * 2.0 * M_PI));
+            return SineTable::get().lookupWrapped(static_cast<float>(p));
         case Waveform::PULSE:
-            return polyBlepPulse(p, pulseWidth);
+            return polyBlepPulse(p, pw, dt);
         default:
             return 0.0f;
     }
 }
 
-// PolyBLEP anti-aliasing correction
-float Oscillator::polyBlep(double t, double dt) const
+// PolyBLEP anti-aliasing correction (variable-width pulse)
+float Oscillator::polyBlep(double t, double dt)
 {
     if (t < dt)
     {
@@ -181,30 +247,8 @@ float Oscillator::polyBlep(double t, double dt) const
     return 0.0f;
 }
 
-float Oscillator::polyBlepSaw(double p) const
-{
-    double dt = phaseIncrement;
-    float naive = static_cast<float>(2.0 * p - 1.0);
-    return naive - polyBlep(p, dt);
-}
-
-float Oscillator::polyBlepSquare(double p) const
-{
-    double dt = phaseIncrement;
-    float naive = (p < 0.5) ? 1.0f : -1.0f;
-    return naive + polyBlep(p, dt) - polyBlep(std::fmod(p + 0.5, 1.0), dt);
-}
-
-float Oscillator::polyBlepTriangle(double p) const
-{
-    double dt = phaseIncrement * 2.0;
-    float naive = static_cast<float>(2.0 * std::abs(2.0 * p - 1.0) - 1.0);
-    return naive;  // Simplified triangle PolyBLEP
-}
-
-float Oscillator::polyBlepPulse(double p, double pw) const
+float Oscillator::polyBlepPulse(double p, double pw, double dt)
 {
-    double dt = phaseIncrement;
     float naive = (p < pw) ? 1.0f : -1.0f;
 
     float blep1 = polyBlep(p, dt);
@@ -259,6 +303,27 @@ float SubOscillator::processSample()
     return output * level;
 }
 
+void SubOscillator::processBlock(float* output, int numSamples)
+{
+    if (!enabled)
+    {
+        std::fill(output, output + numSamples, 0.0f);
+        return;
+    }
+
+    double p = phase;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        // Square wave at -1 octave
+        output[i] = ((p < 0.5) ? 1.0f : -1.0f) * level;
+
+        p += phaseIncrement;
+        if (p >= 1.0)
+            p -= 1.0;
+    }
+    phase = p;
+}
+
 //==============================================================================
 // NOISE GENERATOR IMPLEMENTATION
 //==============================================================================
@@ -285,6 +350,14 @@ float NoiseGenerator::nextFloat()
     return distribution_(generator_) * 2.0f - 1.0f;
 }
 
+void NoiseGenerator::fill(float* output, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        output[i] = nextFloat();
+    }
+}
+
 //==============================================================================
 // SVF FILTER IMPLEMENTATION
 //==============================================================================
@@ -309,6 +382,7 @@ void SVFFilter::reset()
     type = FilterType::LOWPASS;
     cutoff = 1000.0f;
     resonance = 0.5f;
+    coefficients_ = computeCoefficients(cutoff, resonance, sampleRate_);
 }
 
 void SVFFilter::setType(FilterType t)
@@ -319,58 +393,98 @@ void SVFFilter::setType(FilterType t)
 void SVFFilter::setCutoff(float freqHz)
 {
     cutoff = std::max(20.0f, std::min(20000.0f, freqHz));
+    coefficients_ = computeCoefficients(cutoff, resonance, sampleRate_);
 }
 
 void SVFFilter::setResonance(float res)
 {
     resonance = std::max(0.0f, std::min(1.0f, res));
+    coefficients_ = computeCoefficients(cutoff, resonance, sampleRate_);
 }
 
-float SVFFilter::processSample(float input)
+void SVFFilter::setParameters(FilterType newType, float cutoffHz, float newResonance, const Coefficients& c)
+{
+    type = newType;
+    cutoff = cutoffHz;
+    resonance = newResonance;
+    coefficients_ = c;
+}
+
+SVFFilter::Coefficients SVFFilter::computeCoefficients(float cutoffHz, float res, double sampleRate)
 {
     // State Variable Filter (Zölzer style)
     // Based on "Designing Audio Effect Plugins in C++" by Will Pirkle
 
-    float fc = cutoff / static_cast<float>(sampleRate_);
+    float fc = cutoffHz / static_cast<float>(sampleRate);
     if (fc > 0.5f) fc = 0.5f;
 
-    float fs = fc;  // Normalized frequency
+    Coefficients c;
+    c.fs = fc;  // Normalized frequency
 
     // Damping factor (resonance)
-    float q = 1.0f - resonance;
-    if (q < 0.001f) q = 0.001f;
+    c.q = 1.0f - res;
+    if (c.q < 0.001f) c.q = 0.001f;
+
+    return c;
+}
 
+float SVFFilter::processSample(float input)
+{
     v0 = input;
+    return tick(getCoefficients(), type, input, v1, v2, v3);
+}
 
-    // Integrator 1
-    float v1_new = v1 + fs * v3;
-    v3 = fs * (v0 - v1 - q * v1);
+void SVFFilter::processBlock(float* buffer, int numSamples, float cutoffRatioStart, float cutoffRatioEnd)
+{
+    if (numSamples <= 0)
+        return;
+
+    Coefficients c = getCoefficients();
+    const float sr = static_cast<float>(sampleRate_);
+    const float fsStart = std::clamp(cutoff * cutoffRatioStart / sr, 0.0f, 0.5f);
+    const float fsEnd = std::clamp(cutoff * cutoffRatioEnd / sr, 0.0f, 0.5f);
+    const float fsStep = (fsEnd - fsStart) / static_cast<float>(numSamples);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        c.fs = fsStart + fsStep * static_cast<float>(i + 1);
+        buffer[i] = tick(c, type, buffer[i], v1, v2, v3);
+    }
+}
 
-    // Integrator 2
-    float v2_new = v2 + fs * v1;
-    v1 = v1_new;
-    v2 = v2_new;
+void SVFFilter::processBlock(float* buffer, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
 
-    // Outputs
-    float lowpass = v2;
-    float bandpass = v1;
-    float highpass = v0 - q * v1 - v2;
-    float notch = v0 - q * v1;
+    // Coefficients and output type are constant across the block
+    const Coefficients c = getCoefficients();
+    float s1 = v1, s2 = v2, s3 = v3;
 
-    // Select output based on type
     switch (type)
     {
-        case FilterType::LOWPASS:
-            return lowpass;
         case FilterType::HIGHPASS:
-            return highpass;
+            for (int i = 0; i < numSamples; ++i)
+                buffer[i] = tick(c, FilterType::HIGHPASS, buffer[i], s1, s2, s3);
+            break;
         case FilterType::BANDPASS:
-            return bandpass;
+            for (int i = 0; i < numSamples; ++i)
+                buffer[i] = tick(c, FilterType::BANDPASS, buffer[i], s1, s2, s3);
+            break;
         case FilterType::NOTCH:
-            return notch;
+            for (int i = 0; i < numSamples; ++i)
+                buffer[i] = tick(c, FilterType::NOTCH, buffer[i], s1, s2, s3);
+            break;
+        case FilterType::LOWPASS:
         default:
-            return lowpass;
+            for (int i = 0; i < numSamples; ++i)
+                buffer[i] = tick(c, FilterType::LOWPASS, buffer[i], s1, s2, s3);
+            break;
     }
+
+    v1 = s1;
+    v2 = s2;
+    v3 = s3;
 }
 
 //==============================================================================
@@ -386,6 +500,7 @@ Envelope::Envelope()
 void Envelope::prepare(double sampleRate)
 {
     sampleRate_ = sampleRate;
+    rates_ = computeRates(params, sampleRate_);
     reset();
 }
 
@@ -395,12 +510,29 @@ void Envelope::reset()
     currentLevel = 0.0f;
 }
 
+Envelope::Rates Envelope::computeRates(const Parameters& p, double sampleRate)
+{
+    const float increment = 1.0f / static_cast<float>(sampleRate);
+
+    Rates r;
+    r.attack = increment / p.attack;
+    r.decay = increment / p.decay;
+    r.release = increment / p.release;
+    return r;
+}
+
 void Envelope::setParameters(const Parameters& p)
+{
+    setParameters(p, computeRates(p, sampleRate_));
+}
+
+void Envelope::setParameters(const Parameters& p, const Rates& rates)
 {
     params.attack = p.attack;
     params.decay = p.decay;
     params.sustain = p.sustain;
     params.release = p.release;
+    rates_ = rates;
 }
 
 void Envelope::noteOn()
@@ -416,12 +548,10 @@ void Envelope::noteOff()
 
 float Envelope::processSample()
 {
-    float increment = 1.0f / static_cast<float>(sampleRate_);
-
     switch (state)
     {
         case State::ATTACK:
-            currentLevel += increment / params.attack;
+            currentLevel += rates_.attack;
             if (currentLevel >= 1.0f)
             {
                 currentLevel = 1.0f;
@@ -430,7 +560,7 @@ float Envelope::processSample()
             break;
 
         case State::DECAY:
-            currentLevel -= increment / params.decay;
+            currentLevel -= rates_.decay;
             if (currentLevel <= params.sustain)
             {
                 currentLevel = params.sustain;
@@ -443,7 +573,7 @@ float Envelope::processSample()
             break;
 
         case State::RELEASE:
-            currentLevel -= increment / params.release;
+            currentLevel -= rates_.release;
             if (currentLevel <= 0.0f)
             {
                 currentLevel = 0.0f;
@@ -459,6 +589,22 @@ float Envelope::processSample()
     return currentLevel;
 }
 
+void Envelope::processBlock(float* output, int numSamples)
+{
+    // Idle and sustain are flat: fill instead of stepping the state machine
+    if (state == State::IDLE || state == State::SUSTAIN)
+    {
+        currentLevel = (state == State::IDLE) ? 0.0f : params.sustain;
+        std::fill(output, output + numSamples, currentLevel);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        output[i] = processSample();
+    }
+}
+
 bool Envelope::isActive() const
 {
     return state != State::IDLE;
@@ -486,8 +632,8 @@ void LFO::prepare(double sampleRate)
 
 void LFO::reset()
 {
+    // Rate is a synth parameter; keep the increment set by setRate()
     phase = 0.0;
-    phaseIncrement = 0.0;
     output = 0.0f;
     lastSandHValue = 0.0f;
 }
@@ -530,6 +676,27 @@ float LFO::processSample()
     return scaledOutput;
 }
 
+float LFO::advance(int numSamples, float rateScale, float depthOffset)
+{
+    output = (waveform == LFOWaveform::SAMPLE_AND_HOLD) ? lastSandHValue : generateWaveform();
+
+    // Advance phase by the whole control period
+    phase += phaseIncrement * rateScale * numSamples;
+    if (phase >= 1.0)
+    {
+        phase -= std::floor(phase);
+        if (waveform == LFOWaveform::SAMPLE_AND_HOLD)
+            lastSandHValue = distribution_(generator_) * 2.0f - 1.0f;
+    }
+
+    // Apply depth and bipolar/unipolar
+    float scaledOutput = output * std::clamp(depth + depthOffset, 0.0f, 1.0f);
+    if (!bipolar)
+        scaledOutput = (scaledOutput + 1.0f) * 0.5f;  // Convert -1..1 to 0..1
+
+    return scaledOutput;
+}
+
 float LFO::generateWaveform()
 {
     double p = phase;
@@ -537,7 +704,7 @@ float LFO::generateWaveform()
     switch (waveform)
     {
         case LFOWaveform::SINE:
-            return static_cast<float>(std::sin(p * 2.0 * M_PI));
+            return SineTable::get().lookupWrapped(static_cast<float>(p));
 
         case LFOWaveform::TRIANGLE:
             return static_cast<float>(2.0 * std::abs(2.0 * p - 1.0) - 1.0);
@@ -650,8 +817,7 @@ float ModulationMatrix::applyCurve(float value, int curveType) const
 {
     if (curveType == 1)  // Exponential
     {
-        float sign = (value >= 0.0f) ? 1.0f : -1.0f;
-        return sign * std::pow(std::abs(value), 2.0f);
+        return value * std::abs(value);  // sign(v) * v^2
     }
 
     return value;  // Linear (default)
@@ -663,6 +829,57 @@ void ModulationMatrix::processModulationSources()
     lfo2.processSample();
 }
 
+void ModulationMatrix::beginBlock()
+{
+    // One atomic read per slot per block; the control ticks use the snapshot
+    routedSources_ = 0;
+    for (int i = 0; i < NUM_MOD_SLOTS; ++i)
+    {
+        slotAmounts_[i] = slots[i].amount.load(std::memory_order_relaxed);
+        if (slotAmounts_[i] != 0.0f)
+            routedSources_ |= 1u << static_cast<int>(slots[i].source);
+    }
+
+    if (routedSources_ == 0)
+        lastFrame_ = ModulationFrame{};
+}
+
+void ModulationMatrix::processControlBlock(int numSamples, ModulationFrame& frame)
+{
+    // Only routed sources are evaluated; LFO rate/depth destinations use
+    // the previous tick's frame
+    if (routedSources_ & (1u << static_cast<int>(ModSource::LFO1)))
+    {
+        sourceValues[static_cast<int>(ModSource::LFO1)] =
+            lfo1.advance(numSamples, std::exp2(2.0f * lastFrame_[ModDestination::LFO1_RATE]),
+                         lastFrame_[ModDestination::LFO1_DEPTH]);
+    }
+    if (routedSources_ & (1u << static_cast<int>(ModSource::LFO2)))
+    {
+        sourceValues[static_cast<int>(ModSource::LFO2)] =
+            lfo2.advance(numSamples, std::exp2(2.0f * lastFrame_[ModDestination::LFO2_RATE]),
+                         lastFrame_[ModDestination::LFO2_DEPTH]);
+    }
+
+    frame.values.fill(0.0f);
+    for (int i = 0; i < NUM_MOD_SLOTS; ++i)
+    {
+        if (slotAmounts_[i] == 0.0f)
+            continue;
+
+        const ModulationSlot& slot = slots[i];
+        float value = sourceValues[static_cast<int>(slot.source)];
+        if (!slot.bipolar)
+            value = (value + 1.0f) * 0.5f;
+        value = applyCurve(value, slot.curveType) * slotAmounts_[i] * slot.maxValue;
+
+        frame.values[static_cast<size_t>(slot.destination)] += value;
+        modulationAmounts[i].store(value, std::memory_order_relaxed);
+    }
+
+    lastFrame_ = frame;
+}
+
 //==============================================================================
 // MACRO SYSTEM IMPLEMENTATION
 //==============================================================================
@@ -791,6 +1008,8 @@ void Voice::noteOn(int note, float vel, double currentSampleRate)
 
 void Voice::noteOff(float vel)
 {
+    // Held note released; the voice stays active until both envelopes finish
+    active = false;
     filterEnv.noteOff();
     ampEnv.noteOff();
 }
@@ -862,6 +1081,166 @@ float Voice::renderSample()
     return filtered;
 }
 
+void Voice::renderBlock(float* output, int numSamples,
+                        const ModulationFrame* modStart, const ModulationFrame* modEnd)
+{
+    if (!isActive())
+    {
+        std::fill(output, output + numSamples, 0.0f);
+        return;
+    }
+
+    // Level ramps (start + step * (i + 1)); flat without modulation
+    float level1 = osc1Level, level2 = osc2Level, levelSub = subLevel, levelNoise = noiseLevel;
+    float step1 = 0.0f, step2 = 0.0f, stepSub = 0.0f, stepNoise = 0.0f;
+    float cutoffRatioStart = 1.0f, cutoffRatioEnd = 1.0f;
+
+    // Control-rate settings overridden for this call and restored after
+    const double savedIncrement1 = osc1.phaseIncrement, savedIncrement2 = osc2.phaseIncrement;
+    const float savedWarp1 = osc1.warp, savedWarp2 = osc2.warp;
+    const float savedPulseWidth1 = osc1.pulseWidth, savedPulseWidth2 = osc2.pulseWidth;
+    const float savedResonance = filter.resonance;
+    const SVFFilter::Coefficients savedCoefficients = filter.getCoefficients();
+    const Envelope::Parameters savedAmpEnv = ampEnv.params;
+    const Envelope::Rates savedAmpEnvRates = ampEnv.getRates();
+
+    if (modEnd != nullptr)
+    {
+        const ModulationFrame& from = modStart ? *modStart : *modEnd;
+        const ModulationFrame& to = *modEnd;
+        const float invSamples = 1.0f / static_cast<float>(numSamples);
+
+        auto ramp = [&](float base, ModDestination d, float& start, float& step)
+        {
+            start = std::max(0.0f, base + from[d]);
+            step = (std::max(0.0f, base + to[d]) - start) * invSamples;
+        };
+        ramp(osc1Level, ModDestination::OSC1_LEVEL, level1, step1);
+        ramp(osc2Level, ModDestination::OSC2_LEVEL, level2, step2);
+        ramp(subLevel, ModDestination::SUB_LEVEL, levelSub, stepSub);
+        ramp(noiseLevel, ModDestination::NOISE_LEVEL, levelNoise, stepNoise);
+
+        cutoffRatioStart = std::exp2(5.0f * from[ModDestination::FILTER_CUTOFF]);
+        cutoffRatioEnd = std::exp2(5.0f * to[ModDestination::FILTER_CUTOFF]);
+
+        osc1.phaseIncrement *= std::exp2(to[ModDestination::OSC1_FREQ]);
+        osc2.phaseIncrement *= std::exp2(to[ModDestination::OSC2_FREQ]);
+        osc1.warp = std::clamp(osc1.warp + to[ModDestination::OSC1_WARP], -1.0f, 1.0f);
+        osc2.warp = std::clamp(osc2.warp + to[ModDestination::OSC2_WARP], -1.0f, 1.0f);
+        osc1.pulseWidth = std::clamp(osc1.pulseWidth + to[ModDestination::OSC1_PULSE_WIDTH], 0.05f, 0.95f);
+        osc2.pulseWidth = std::clamp(osc2.pulseWidth + to[ModDestination::OSC2_PULSE_WIDTH], 0.05f, 0.95f);
+        filter.setResonance(filter.resonance + to[ModDestination::FILTER_RESONANCE]);
+
+        Envelope::Parameters modulatedAmpEnv = savedAmpEnv;
+        modulatedAmpEnv.attack *= std::exp2(2.0f * to[ModDestination::AMP_ENV_ATTACK]);
+        modulatedAmpEnv.decay *= std::exp2(2.0f * to[ModDestination::AMP_ENV_DECAY]);
+        modulatedAmpEnv.sustain = std::clamp(savedAmpEnv.sustain + to[ModDestination::AMP_ENV_SUSTAIN], 0.0f, 1.0f);
+        modulatedAmpEnv.release *= std::exp2(2.0f * to[ModDestination::AMP_ENV_RELEASE]);
+        ampEnv.setParameters(modulatedAmpEnv);
+    }
+
+    alignas(32) float osc2Buffer[RENDER_CHUNK_SIZE];
+    alignas(32) float stageBuffer[RENDER_CHUNK_SIZE];
+
+    for (int offset = 0; offset < numSamples; offset += RENDER_CHUNK_SIZE)
+    {
+        const int n = std::min(RENDER_CHUNK_SIZE, numSamples - offset);
+        float* mix = output + offset;
+
+        // Oscillators
+        if (fmEnabled)
+        {
+            // Modulator and carrier are interleaved per sample (same call
+            // order as renderSample()); with OSC1 as carrier, OSC2 is also
+            // read again as the second oscillator
+            for (int i = 0; i < n; ++i)
+            {
+                float osc1Out, osc2Out;
+                if (fmCarrierIndex == 0)
+                {
+                    const float modulation = osc2.processSample() * fmDepth;
+                    osc1Out = osc1.processSampleWithFM(modulation);
+                    osc2Out = osc2.processSample();
+                }
+                else
+                {
+                    const float modulation = osc1.processSample() * fmDepth;
+                    osc1Out = osc1.processSample();
+                    osc2Out = osc2.processSampleWithFM(modulation);
+                }
+                const float k = static_cast<float>(offset + i + 1);
+                mix[i] = (osc1Out * (level1 + step1 * k)) + (osc2Out * (level2 + step2 * k));
+            }
+        }
+        else
+        {
+            osc1.processBlock(mix, n);
+            osc2.processBlock(osc2Buffer, n);
+            for (int i = 0; i < n; ++i)
+            {
+                const float k = static_cast<float>(offset + i + 1);
+                mix[i] = (mix[i] * (level1 + step1 * k)) + (osc2Buffer[i] * (level2 + step2 * k));
+            }
+        }
+
+        // Sub-oscillator
+        if (subOsc.enabled)
+        {
+            subOsc.processBlock(stageBuffer, n);
+            for (int i = 0; i < n; ++i)
+            {
+                mix[i] += stageBuffer[i] * (levelSub + stepSub * static_cast<float>(offset + i + 1));
+            }
+        }
+
+        // Noise
+        if (levelNoise > 0.0f || stepNoise != 0.0f)
+        {
+            noiseGen.fill(stageBuffer, n);
+            for (int i = 0; i < n; ++i)
+            {
+                mix[i] += stageBuffer[i] * (levelNoise + stepNoise * static_cast<float>(offset + i + 1));
+            }
+        }
+
+        // Filter
+        if (modEnd != nullptr)
+        {
+            const float t0 = static_cast<float>(offset) / static_cast<float>(numSamples);
+            const float t1 = static_cast<float>(offset + n) / static_cast<float>(numSamples);
+            filter.processBlock(mix, n,
+                                cutoffRatioStart + (cutoffRatioEnd - cutoffRatioStart) * t0,
+                                cutoffRatioStart + (cutoffRatioEnd - cutoffRatioStart) * t1);
+        }
+        else
+        {
+            filter.processBlock(mix, n);
+        }
+
+        // Filter envelope (advanced in step with the amp envelope)
+        filterEnv.processBlock(stageBuffer, n);
+
+        // Amp envelope
+        ampEnv.processBlock(stageBuffer, n);
+        for (int i = 0; i < n; ++i)
+        {
+            mix[i] *= stageBuffer[i];
+        }
+    }
+
+    if (modEnd != nullptr)
+    {
+        osc1.phaseIncrement = savedIncrement1;
+        osc2.phaseIncrement = savedIncrement2;
+        osc1.warp = savedWarp1;
+        osc2.warp = savedWarp2;
+        osc1.pulseWidth = savedPulseWidth1;
+        osc2.pulseWidth = savedPulseWidth2;
+        filter.setParameters(filter.type, filter.cutoff, savedResonance, savedCoefficients);
+        ampEnv.setParameters(savedAmpEnv, savedAmpEnvRates);
+    }
+}
+
 //==============================================================================
 // VOICE MANAGER IMPLEMENTATION
 //==============================================================================
@@ -872,11 +1251,27 @@ VoiceManager::VoiceManager()
     , glideTime_(0.1f)
     , currentSampleRate_(48000.0)
 {
+    setScratchBuffer(nullptr, 0);
+}
+
+void VoiceManager::setScratchBuffer(float* buffer, int size)
+{
+    if (buffer != nullptr && size > 0)
+    {
+        voiceBuffer_ = buffer;
+        voiceBufferSize_ = size;
+    }
+    else
+    {
+        voiceBuffer_ = fallbackVoiceBuffer_;
+        voiceBufferSize_ = Voice::RENDER_CHUNK_SIZE;
+    }
 }
 
 void VoiceManager::prepare(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate_ = sampleRate;
+    voiceOutputs_.prepare(std::max(samplesPerBlock, 1), MAX_VOICES);
 
     for (auto& voice : voices_)
     {
@@ -909,6 +1304,9 @@ Voice* VoiceManager::findFreeVoice()
     }
 
     // Voice stealing: steal oldest voice
+    if (telemetry_)
+        telemetry_->addEvent(TelemetryEvent::VoiceSteal);
+
     int oldestVoice = 0;
     double oldestTime = voices_[0].startTime;
 
@@ -1008,22 +1406,315 @@ void VoiceManager::allNotesOff()
     }
 }
 
-void VoiceManager::processBlock(float* output, int numSamples, double sampleRate)
+void VoiceManager::processBlock(float* output, int numSamples, double sampleRate,
+                                const ModulationFrame* modStart, const ModulationFrame* modEnd)
 {
-    // Render all active voices
-    for (int i = 0; i < numSamples; ++i)
+    if (renderPool_ != nullptr && renderPool_->getNumWorkers() > 0 && voiceOutputs_.getMaxBlockSize() > 0)
+    {
+        processParallelBlock(output, numSamples, modStart, modEnd);
+        return;
+    }
+
+    std::fill(output, output + numSamples, 0.0f);
+
+    // Voice-major: each active voice renders its whole block into scratch
+    // and is summed in voice order
+    Voice* lanes[VOICE_LANES];
+    int laneCount = 0;
+
+    for (int offset = 0; offset < numSamples; offset += voiceBufferSize_)
     {
-        float mix = 0.0f;
+        const int n = std::min(voiceBufferSize_, numSamples - offset);
+        float* out = output + offset;
 
         for (auto& voice : voices_)
         {
-            if (voice.isActive())
+            if (!voice.isActive())
+                continue;
+
+            if (voiceLaneMode_ && !voice.fmEnabled && modEnd == nullptr)
+            {
+                lanes[laneCount++] = &voice;
+                if (laneCount == VOICE_LANES)
+                {
+                    renderVoiceLanes(lanes, out, n);
+                    laneCount = 0;
+                }
+                continue;
+            }
+
+            voice.renderBlock(voiceBuffer_, n, modStart, modEnd);
+            for (int i = 0; i < n; ++i)
+            {
+                out[i] += voiceBuffer_[i];
+            }
+        }
+
+        // Partial lane group
+        for (int lane = 0; lane < laneCount; ++lane)
+        {
+            lanes[lane]->renderBlock(voiceBuffer_, n);
+            for (int i = 0; i < n; ++i)
+            {
+                out[i] += voiceBuffer_[i];
+            }
+        }
+        laneCount = 0;
+    }
+}
+
+void VoiceManager::processParallelBlock(float* output, int numSamples,
+                                        const ModulationFrame* modStart, const ModulationFrame* modEnd)
+{
+    std::fill(output, output + numSamples, 0.0f);
+    renderModStart_ = modStart;
+    renderModEnd_ = modEnd;
+
+    voiceOutputs_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        int numVoices = 0;
+        for (int v = 0; v < MAX_VOICES; ++v)
+        {
+            if (voices_[static_cast<size_t>(v)].isActive())
+                renderVoices_[numVoices++] = v;
+        }
+        renderSamples_ = n;
+
+        renderPool_->run(&VoiceManager::renderTask, this, numVoices);
+
+        // Summed in voice order, as in the serial path
+        for (int r = 0; r < numVoices; ++r)
+        {
+            const float* voiceOut = voiceOutputs_.getBuffer(renderVoices_[r]);
+            for (int i = 0; i < n; ++i)
+            {
+                output[offset + i] += voiceOut[i];
+            }
+        }
+    });
+}
+
+void VoiceManager::renderTask(void* context, int task, int /*participant*/)
+{
+    auto& self = *static_cast<VoiceManager*>(context);
+    const int v = self.renderVoices_[task];
+    self.voices_[static_cast<size_t>(v)].renderBlock(self.voiceOutputs_.getBuffer(v), self.renderSamples_,
+                                                     self.renderModStart_, self.renderModEnd_);
+}
+
+//==============================================================================
+// Voice lanes: VOICE_LANES voices side by side, sample-major with one lane
+// per voice (frame i of lane l at [i * VOICE_LANES + l])
+//==============================================================================
+
+static constexpr int LANES = VoiceManager::VOICE_LANES;
+
+// Shape, warp and pulse width are global synth parameters, so every lane
+// shares lane 0's; same samples as Oscillator::processBlock() per voice
+static void renderOscillatorLanes(Oscillator* const* oscillators, float* output, int numSamples)
+{
+    const Oscillator& first = *oscillators[0];
+    const Waveform shape = first.waveform;
+    const float warp = first.warp;
+    const float pw = first.pulseWidth;
+    const int tableShape = Oscillator::wavetableShape(shape);
+
+    alignas(32) double phase[LANES];
+    alignas(32) double increment[LANES];
+    const float* table[LANES] = {};
+
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        phase[lane] = oscillators[lane]->phase;
+        increment[lane] = oscillators[lane]->phaseIncrement;
+        if (tableShape >= 0)
+        {
+            // Pitch is constant across the block: one mip level per lane
+            table[lane] = WavetableBank::get().table(static_cast<WavetableBank::Shape>(tableShape),
+                                                     WavetableBank::levelForIncrement(increment[lane]));
+        }
+    }
+
+    if (tableShape >= 0 && warp == 0.0f)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* frame = output + i * LANES;
+            for (int lane = 0; lane < LANES; ++lane)
+            {
+                frame[lane] = WavetableBank::lookup(table[lane], phase[lane]);
+                phase[lane] += increment[lane];
+                if (phase[lane] >= 1.0) phase[lane] -= 1.0;
+            }
+        }
+    }
+    else if (tableShape >= 0)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* frame = output + i * LANES;
+            for (int lane = 0; lane < LANES; ++lane)
+            {
+                // applyWarp() stays within (-1, 2), where this equals wrapPhase()
+                const double warped = Oscillator::applyWarp(phase[lane], warp);
+                frame[lane] = WavetableBank::lookup(table[lane], warped - std::floor(warped));
+                phase[lane] += increment[lane];
+                if (phase[lane] >= 1.0) phase[lane] -= 1.0;
+            }
+        }
+    }
+    else
+    {
+        // Sine and pulse: per-sample evaluation, as in the per-voice path
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* frame = output + i * LANES;
+            for (int lane = 0; lane < LANES; ++lane)
+            {
+                frame[lane] = Oscillator::evaluate(shape, Oscillator::applyWarp(phase[lane], warp),
+                                                   increment[lane], pw);
+                phase[lane] += increment[lane];
+                if (phase[lane] >= 1.0) phase[lane] -= 1.0;
+            }
+        }
+    }
+
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        oscillators[lane]->phase = phase[lane];
+    }
+}
+
+// The SVF recursion is serial per voice but independent across lanes, so
+// each step runs on all lanes at once
+template <FilterType Type>
+static void filterLanes(const float* fs, const float* q, float* buffer, int numSamples,
+                        float* v1, float* v2, float* v3)
+{
+    alignas(32) float s1[LANES], s2[LANES], s3[LANES];
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        s1[lane] = v1[lane];
+        s2[lane] = v2[lane];
+        s3[lane] = v3[lane];
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        float* frame = buffer + i * LANES;
+        for (int lane = 0; lane < LANES; ++lane)
+        {
+            const SVFFilter::Coefficients c{ fs[lane], q[lane] };
+            frame[lane] = SVFFilter::tick(c, Type, frame[lane], s1[lane], s2[lane], s3[lane]);
+        }
+    }
+
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        v1[lane] = s1[lane];
+        v2[lane] = s2[lane];
+        v3[lane] = s3[lane];
+    }
+}
+
+void VoiceManager::renderVoiceLanes(Voice* const* lanes, float* output, int numSamples)
+{
+    static_assert(VOICE_LANES == LANES);
+    const FilterType filterType = lanes[0]->filter.type;
+
+    // Gather per-lane state (SoA)
+    Oscillator* osc1[VOICE_LANES];
+    Oscillator* osc2[VOICE_LANES];
+    alignas(32) float level1[VOICE_LANES], level2[VOICE_LANES];
+    alignas(32) float fs[VOICE_LANES], q[VOICE_LANES];
+    alignas(32) float v1[VOICE_LANES], v2[VOICE_LANES], v3[VOICE_LANES];
+
+    for (int lane = 0; lane < VOICE_LANES; ++lane)
+    {
+        Voice& voice = *lanes[lane];
+        osc1[lane] = &voice.osc1;
+        osc2[lane] = &voice.osc2;
+        level1[lane] = voice.osc1Level;
+        level2[lane] = voice.osc2Level;
+        const SVFFilter::Coefficients c = voice.filter.getCoefficients();
+        fs[lane] = c.fs;
+        q[lane] = c.q;
+        voice.filter.getState(v1[lane], v2[lane], v3[lane]);
+    }
+
+    alignas(32) float mix[Voice::RENDER_CHUNK_SIZE * VOICE_LANES];
+    alignas(32) float osc2Out[Voice::RENDER_CHUNK_SIZE * VOICE_LANES];
+    alignas(32) float scratch[Voice::RENDER_CHUNK_SIZE];
+
+    for (int offset = 0; offset < numSamples; offset += Voice::RENDER_CHUNK_SIZE)
+    {
+        const int n = std::min(Voice::RENDER_CHUNK_SIZE, numSamples - offset);
+
+        // Oscillators, all lanes per sample
+        renderOscillatorLanes(osc1, mix, n);
+        renderOscillatorLanes(osc2, osc2Out, n);
+        for (int i = 0; i < n; ++i)
+        {
+            for (int lane = 0; lane < VOICE_LANES; ++lane)
+            {
+                const int k = i * VOICE_LANES + lane;
+                mix[k] = (mix[k] * level1[lane]) + (osc2Out[k] * level2[lane]);
+            }
+        }
+
+        // Sub-oscillator and noise: per-voice state, added in the per-voice order
+        for (int lane = 0; lane < VOICE_LANES; ++lane)
+        {
+            Voice& voice = *lanes[lane];
+            if (voice.subOsc.enabled)
+            {
+                voice.subOsc.processBlock(scratch, n);
+                for (int i = 0; i < n; ++i)
+                    mix[i * VOICE_LANES + lane] += scratch[i] * voice.subLevel;
+            }
+            if (voice.noiseLevel > 0.0f)
             {
-                mix += voice.renderSample();
+                voice.noiseGen.fill(scratch, n);
+                for (int i = 0; i < n; ++i)
+                    mix[i * VOICE_LANES + lane] += scratch[i] * voice.noiseLevel;
             }
         }
 
-        output[i] = mix;
+        // Filter
+        switch (filterType)
+        {
+            case FilterType::HIGHPASS: filterLanes<FilterType::HIGHPASS>(fs, q, mix, n, v1, v2, v3); break;
+            case FilterType::BANDPASS: filterLanes<FilterType::BANDPASS>(fs, q, mix, n, v1, v2, v3); break;
+            case FilterType::NOTCH:    filterLanes<FilterType::NOTCH>(fs, q, mix, n, v1, v2, v3); break;
+            case FilterType::LOWPASS:
+            default:                   filterLanes<FilterType::LOWPASS>(fs, q, mix, n, v1, v2, v3); break;
+        }
+
+        // Envelopes (filter envelope advanced in step with the amp envelope)
+        for (int lane = 0; lane < VOICE_LANES; ++lane)
+        {
+            Voice& voice = *lanes[lane];
+            voice.filterEnv.processBlock(scratch, n);
+            voice.ampEnv.processBlock(scratch, n);
+            for (int i = 0; i < n; ++i)
+                mix[i * VOICE_LANES + lane] *= scratch[i];
+        }
+
+        // Summed in voice order, as in the per-voice path
+        float* out = output + offset;
+        for (int i = 0; i < n; ++i)
+        {
+            float sum = out[i];
+            for (int lane = 0; lane < VOICE_LANES; ++lane)
+                sum += mix[i * VOICE_LANES + lane];
+            out[i] = sum;
+        }
+    }
+
+    // Scatter filter state back (oscillator phases are written by renderOscillatorLanes())
+    for (int lane = 0; lane < VOICE_LANES; ++lane)
+    {
+        lanes[lane]->filter.setState(v1[lane], v2[lane], v3[lane]);
     }
 }
 
@@ -1038,69 +1729,102 @@ int VoiceManager::getActiveVoiceCount() const
     return count;
 }
 
-void VoiceManager::updateVoiceParameters(const NaturePureDSP& synth)
+void VoiceManager::updateVoiceParameters(const NaturePureDSP& synth, uint32_t groups)
 {
-    for (auto& voice : voices_)
-    {
-        // Update oscillator levels
-        voice.osc1Level = synth.params_.osc1Level;
-        voice.osc2Level = synth.params_.osc2Level;
-        voice.subLevel = synth.params_.subLevel;
-        voice.noiseLevel = synth.params_.noiseLevel;
-
-        // Update FM synthesis parameters
-        voice.fmEnabled = synth.params_.fmEnabled != 0.0f;
-        voice.fmDepth = synth.params_.fmDepth;
-        voice.fmCarrierIndex = static_cast<int>(synth.params_.fmCarrierOsc);
+    if (groups == VOICE_GROUP_NONE)
+        return;
 
-        // Update filter envelope amount
-        voice.filterEnvelopeAmount = synth.params_.filterEnvAmount;
+    const auto& p = synth.params_;
+    VoiceParameterSnapshot& snap = snapshot_;
 
-        // Update oscillator waveforms
-        voice.osc1.setWaveform(static_cast<int>(synth.params_.osc1Shape));
-        voice.osc2.setWaveform(static_cast<int>(synth.params_.osc2Shape));
+    // Rebuild only the changed groups, computing coefficients once
+    if (groups & VOICE_GROUP_OSCILLATORS)
+    {
+        snap.osc1Shape = static_cast<int>(p.osc1Shape);
+        snap.osc2Shape = static_cast<int>(p.osc2Shape);
+        snap.osc1Warp = p.osc1Warp;
+        snap.osc2Warp = p.osc2Warp;
+        snap.osc1PulseWidth = p.osc1PulseWidth;
+        snap.osc2PulseWidth = p.osc2PulseWidth;
+        snap.osc1Level = p.osc1Level;
+        snap.osc2Level = p.osc2Level;
+        snap.subEnabled = p.subEnabled != 0.0f;
+        snap.subLevel = p.subLevel;
+        snap.noiseLevel = p.noiseLevel;
+        snap.fmEnabled = p.fmEnabled != 0.0f;
+        snap.fmCarrierIndex = static_cast<int>(p.fmCarrierOsc);
+        snap.fmDepth = p.fmDepth;
+    }
 
-        // Update oscillator warp
-        voice.osc1.setWarp(synth.params_.osc1Warp);
-        voice.osc2.setWarp(synth.params_.osc2Warp);
+    if (groups & VOICE_GROUP_FILTER)
+    {
+        snap.filterType = static_cast<FilterType>(static_cast<int>(p.filterType));
+        snap.filterCutoffHz = std::max(20.0f, std::min(20000.0f, p.filterCutoff * 20000.0f)); // Normalize to Hz
+        snap.filterResonance = std::max(0.0f, std::min(1.0f, p.filterResonance));
+        snap.filterCoefficients = SVFFilter::computeCoefficients(snap.filterCutoffHz, snap.filterResonance,
+                                                                 currentSampleRate_);
+        snap.filterEnvAmount = p.filterEnvAmount;
+    }
 
-        // Update oscillator pulse width
-        voice.osc1.setPulseWidth(synth.params_.osc1PulseWidth);
-        voice.osc2.setPulseWidth(synth.params_.osc2PulseWidth);
+    if (groups & VOICE_GROUP_FILTER_ENV)
+    {
+        snap.filterEnv.attack = p.filterEnvAttack;
+        snap.filterEnv.decay = p.filterEnvDecay;
+        snap.filterEnv.sustain = p.filterEnvSustain;
+        snap.filterEnv.release = p.filterEnvRelease;
+        snap.filterEnvRates = Envelope::computeRates(snap.filterEnv, currentSampleRate_);
+    }
 
-        // Update sub oscillator enable and level
-        voice.subOsc.setEnabled(synth.params_.subEnabled != 0.0f);
-        voice.subOsc.setLevel(synth.params_.subLevel);
-        voice.subLevel = synth.params_.subLevel;
+    if (groups & VOICE_GROUP_AMP_ENV)
+    {
+        snap.ampEnv.attack = p.ampEnvAttack;
+        snap.ampEnv.decay = p.ampEnvDecay;
+        snap.ampEnv.sustain = p.ampEnvSustain;
+        snap.ampEnv.release = p.ampEnvRelease;
+        snap.ampEnvRates = Envelope::computeRates(snap.ampEnv, currentSampleRate_);
+    }
 
-        // Update noise level
-        voice.noiseGen.setLevel(synth.params_.noiseLevel);
+    ++snap.generation;
 
-        // Update filter parameters
-        voice.filter.setType(static_cast<FilterType>(static_cast<int>(synth.params_.filterType)));
-        voice.filter.setCutoff(synth.params_.filterCutoff * 20000.0f); // Normalize to Hz
-        voice.filter.setResonance(synth.params_.filterResonance);
+    // Push the changed groups
+    for (auto& voice : voices_)
+    {
+        if (groups & VOICE_GROUP_OSCILLATORS)
+        {
+            voice.osc1Level = snap.osc1Level;
+            voice.osc2Level = snap.osc2Level;
+            voice.noiseLevel = snap.noiseLevel;
+
+            voice.fmEnabled = snap.fmEnabled;
+            voice.fmDepth = snap.fmDepth;
+            voice.fmCarrierIndex = snap.fmCarrierIndex;
+
+            voice.osc1.setWaveform(snap.osc1Shape);
+            voice.osc2.setWaveform(snap.osc2Shape);
+            voice.osc1.setWarp(snap.osc1Warp);
+            voice.osc2.setWarp(snap.osc2Warp);
+            voice.osc1.setPulseWidth(snap.osc1PulseWidth);
+            voice.osc2.setPulseWidth(snap.osc2PulseWidth);
+
+            voice.subOsc.setEnabled(snap.subEnabled);
+            voice.subOsc.setLevel(snap.subLevel);
+            voice.subLevel = snap.subLevel;
+
+            voice.noiseGen.setLevel(snap.noiseLevel);
+        }
 
-        // Update filter envelope
-        Envelope::Parameters filterEnvParams;
-        filterEnvParams.attack = synth.params_.filterEnvAttack;
-        filterEnvParams.decay = synth.params_.filterEnvDecay;
-        filterEnvParams.sustain = synth.params_.filterEnvSustain;
-        filterEnvParams.release = synth.params_.filterEnvRelease;
-        voice.filterEnv.setParameters(filterEnvParams);
+        if (groups & VOICE_GROUP_FILTER)
+        {
+            voice.filter.setParameters(snap.filterType, snap.filterCutoffHz, snap.filterResonance,
+                                       snap.filterCoefficients);
+            voice.filterEnvelopeAmount = snap.filterEnvAmount;
+        }
 
-        // Update amp envelope
-        Envelope::Parameters ampEnvParams;
-        ampEnvParams.attack = synth.params_.ampEnvAttack;
-        ampEnvParams.decay = synth.params_.ampEnvDecay;
-        ampEnvParams.sustain = synth.params_.ampEnvSustain;
-        ampEnvParams.release = synth.params_.ampEnvRelease;
-        voice.ampEnv.setParameters(ampEnvParams);
+        if (groups & VOICE_GROUP_FILTER_ENV)
+            voice.filterEnv.setParameters(snap.filterEnv, snap.filterEnvRates);
 
-        // Update LFOs (if modMatrix pointer is set)
-        // Note: The modMatrix pointer is currently null in Voice structure
-        // This needs to be initialized properly during voice creation
-        // For now, skip LFO updates to avoid crash
+        if (groups & VOICE_GROUP_AMP_ENV)
+            voice.ampEnv.setParameters(snap.ampEnv, snap.ampEnvRates);
     }
 }
 
@@ -1110,6 +1834,9 @@ void VoiceManager::updateVoiceParameters(const NaturePureDSP& synth)
 
 NaturePureDSP::NaturePureDSP()
 {
+    voiceManager_.setTelemetry(&telemetry_);
+    prepareScratch(DEFAULT_MAX_BLOCK_SIZE);
+
     // Initialize with default preset values to ensure silence is not due to zero parameters
     params_.osc1Level = 0.7f;
     params_.osc2Level = 0.6f;
@@ -1135,12 +1862,14 @@ bool NaturePureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    prepareScratch(blockSize);
     voiceManager_.prepare(sampleRate, blockSize);
     modMatrix_.prepare(sampleRate);
+    telemetry_.prepare(sampleRate);
 
     // CRITICAL: Apply current parameters to all voices after preparation
     // This ensures voices have proper oscillator levels and envelope settings
-    voiceManager_.updateVoiceParameters(*this);
+    applyParameters();
 
     return true;
 }
@@ -1150,33 +1879,97 @@ void NaturePureDSP::reset()
     voiceManager_.reset();
     modMatrix_.reset();
     pitchBend_ = 0.0;
+
+    // Voice reset restores oscillator / filter defaults; push the parameters back
+    applyParameters();
+}
+
+void NaturePureDSP::prepareScratch(int maxBlockSize)
+{
+    scratch_.prepare(std::max(maxBlockSize, 1), NUM_SCRATCH_BUFFERS);
+    voiceManager_.setScratchBuffer(scratch_.getBuffer(SCRATCH_VOICE), scratch_.getMaxBlockSize());
 }
 
 void NaturePureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    ScopedFlushDenormals noDenormals;
+    Telemetry::BlockScope telemetryBlock(telemetry_, numSamples);
+
+    // Presets published since the last block
+    applyPublishedParameters();
+
     // Clear output buffers
     for (int ch = 0; ch < numChannels; ++ch)
     {
         std::memset(outputs[ch], 0, sizeof(float) * numSamples);
     }
 
-    // Update modulation sources (LFOs, envelopes)
-    for (int i = 0; i < numSamples; ++i)
+    // Block-rate modulation sources
+    {
+        Telemetry::Scope modulationScope(telemetry_, TelemetryStage::Modulation);
+        modMatrix_.setSourceValue(ModSource::PITCH_WHEEL, static_cast<float>(pitchBend_));
+        for (int m = 0; m < 8; ++m)
+        {
+            modMatrix_.setSourceValue(static_cast<ModSource>(static_cast<int>(ModSource::MACRO_1) + m),
+                                      macros_.getMacroValue(m));
+        }
+        modMatrix_.beginBlock();
+    }
+
+    // Blocks larger than the prepared size are rendered in chunks
+    scratch_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        renderChunk(outputs, numChannels, offset, n);
+    });
+
+    if (Telemetry::ENABLED)
     {
-        modMatrix_.processModulationSources();
+        for (int ch = 0; ch < numChannels; ++ch)
+            telemetry_.countDenormals(outputs[ch], numSamples);
     }
+}
+
+void NaturePureDSP::renderChunk(float** outputs, int numChannels, int offset, int numSamples)
+{
+    float* mix = scratch_.getBuffer(SCRATCH_MIX);
 
     // Render all active voices
-    float tempBuffer[512];
-    voiceManager_.processBlock(tempBuffer, numSamples, sampleRate_);
+    if (!modMatrix_.hasRoutings())
+    {
+        modFrame_ = ModulationFrame{};
+        Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
+        voiceManager_.processBlock(mix, numSamples, sampleRate_);
+    }
+    else
+    {
+        // Evaluate the matrix once per control period; voices ramp from the
+        // previous frame to the new one across it
+        const int controlRate = modMatrix_.getControlRate();
+        for (int start = 0; start < numSamples; start += controlRate)
+        {
+            const int n = std::min(controlRate, numSamples - start);
+            ModulationFrame next;
+            {
+                Telemetry::Scope modulationScope(telemetry_, TelemetryStage::Modulation);
+                modMatrix_.processControlBlock(n, next);
+            }
+            {
+                Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
+                voiceManager_.processBlock(mix + start, n, sampleRate_, &modFrame_, &next);
+            }
+            modFrame_ = next;
+        }
+    }
 
     // Process stereo output
+    float* left = outputs[0] + offset;
+    float* right = (numChannels > 1) ? outputs[1] + offset : nullptr;
     for (int i = 0; i < numSamples; ++i)
     {
-        float sample = tempBuffer[i] * params_.masterVolume;
-        processStereoSample(outputs[0][i], outputs[1][i]);
-        outputs[0][i] = sample;
-        outputs[1][i] = sample;
+        float sample = mix[i] * params_.masterVolume;
+        left[i] = sample;
+        if (right)
+            right[i] = sample;
     }
 }
 
@@ -1196,6 +1989,15 @@ void NaturePureDSP::handleEvent(const ScheduledEvent& event)
             pitchBend_ = event.data.pitchBend.bendValue;
             break;
 
+        case ScheduledEvent::CONTROL_CHANGE:
+            if (event.data.controlChange.controllerNumber == MIDI_CC_ALL_NOTES_OFF)
+                voiceManager_.allNotesOff();
+            break;
+
+        case ScheduledEvent::RESET:
+            voiceManager_.reset();
+            break;
+
         default:
             break;
     }
@@ -1203,124 +2005,262 @@ void NaturePureDSP::handleEvent(const ScheduledEvent& event)
 
 float NaturePureDSP::getParameter(const char* paramId) const
 {
-    // OSC1
-    if (std::strcmp(paramId, "osc1_shape") == 0) return params_.osc1Shape;
-    if (std::strcmp(paramId, "osc1_warp") == 0) return params_.osc1Warp;
-    if (std::strcmp(paramId, "osc1_pulse_width") == 0) return params_.osc1PulseWidth;
-    if (std::strcmp(paramId, "osc1_detune") == 0) return params_.osc1Detune;
-    if (std::strcmp(paramId, "osc1_level") == 0) return params_.osc1Level;
-
-    // OSC2
-    if (std::strcmp(paramId, "osc2_shape") == 0) return params_.osc2Shape;
-    if (std::strcmp(paramId, "osc2_warp") == 0) return params_.osc2Warp;
-    if (std::strcmp(paramId, "osc2_pulse_width") == 0) return params_.osc2PulseWidth;
-    if (std::strcmp(paramId, "osc2_detune") == 0) return params_.osc2Detune;
-    if (std::strcmp(paramId, "osc2_level") == 0) return params_.osc2Level;
+    return getParameter(getParameterIndex(paramId));
+}
 
-    // Sub
-    if (std::strcmp(paramId, "sub_enabled") == 0) return params_.subEnabled;
-    if (std::strcmp(paramId, "sub_level") == 0) return params_.subLevel;
+void NaturePureDSP::setParameter(const char* paramId, float value)
+{
+    setParameter(getParameterIndex(paramId), value);
+}
 
-    // FM
-    if (std::strcmp(paramId, "fm_enabled") == 0) return params_.fmEnabled;
-    if (std::strcmp(paramId, "fm_depth") == 0) return params_.fmDepth;
+float NaturePureDSP::getParameter(int index) const
+{
+    switch (index)
+    {
+        case PARAM_OSC1_SHAPE: return params_.osc1Shape;
+        case PARAM_OSC1_WARP: return params_.osc1Warp;
+        case PARAM_OSC1_PULSE_WIDTH: return params_.osc1PulseWidth;
+        case PARAM_OSC1_DETUNE: return params_.osc1Detune;
+        case PARAM_OSC1_LEVEL: return params_.osc1Level;
+        case PARAM_OSC2_SHAPE: return params_.osc2Shape;
+        case PARAM_OSC2_WARP: return params_.osc2Warp;
+        case PARAM_OSC2_PULSE_WIDTH: return params_.osc2PulseWidth;
+        case PARAM_OSC2_DETUNE: return params_.osc2Detune;
+        case PARAM_OSC2_LEVEL: return params_.osc2Level;
+        case PARAM_SUB_ENABLED: return params_.subEnabled;
+        case PARAM_SUB_LEVEL: return params_.subLevel;
+        case PARAM_FM_ENABLED: return params_.fmEnabled;
+        case PARAM_FM_DEPTH: return params_.fmDepth;
+        case PARAM_FILTER_TYPE: return params_.filterType;
+        case PARAM_FILTER_CUTOFF: return params_.filterCutoff;
+        case PARAM_FILTER_RESONANCE: return params_.filterResonance;
+        case PARAM_FILTER_ENV_ATTACK: return params_.filterEnvAttack;
+        case PARAM_FILTER_ENV_DECAY: return params_.filterEnvDecay;
+        case PARAM_FILTER_ENV_SUSTAIN: return params_.filterEnvSustain;
+        case PARAM_FILTER_ENV_RELEASE: return params_.filterEnvRelease;
+        case PARAM_FILTER_ENV_AMOUNT: return params_.filterEnvAmount;
+        case PARAM_AMP_ENV_ATTACK: return params_.ampEnvAttack;
+        case PARAM_AMP_ENV_DECAY: return params_.ampEnvDecay;
+        case PARAM_AMP_ENV_SUSTAIN: return params_.ampEnvSustain;
+        case PARAM_AMP_ENV_RELEASE: return params_.ampEnvRelease;
+        case PARAM_LFO1_RATE: return params_.lfo1Rate;
+        case PARAM_LFO1_DEPTH: return params_.lfo1Depth;
+        case PARAM_LFO2_RATE: return params_.lfo2Rate;
+        case PARAM_LFO2_DEPTH: return params_.lfo2Depth;
+        case PARAM_MASTER_VOLUME: return params_.masterVolume;
+        case PARAM_POLY_MODE: return params_.polyMode;
+        case PARAM_LFO1_WAVEFORM: return params_.lfo1Waveform;
+        case PARAM_LFO1_BIPOLAR: return params_.lfo1Bipolar;
+        case PARAM_LFO2_WAVEFORM: return params_.lfo2Waveform;
+        case PARAM_LFO2_BIPOLAR: return params_.lfo2Bipolar;
+        case PARAM_MASTER_TUNE: return params_.masterTune;
+        default: return 0.0f;
+    }
+}
 
-    // Filter
-    if (std::strcmp(paramId, "filter_type") == 0) return params_.filterType;
-    if (std::strcmp(paramId, "filter_cutoff") == 0) return params_.filterCutoff;
-    if (std::strcmp(paramId, "filter_resonance") == 0) return params_.filterResonance;
+void NaturePureDSP::setParameter(int index, float value)
+{
+    if (index < 0 || index >= NUM_PARAMETERS)
+        return;
 
-    // Envelopes
-    if (std::strcmp(paramId, "filter_env_attack") == 0) return params_.filterEnvAttack;
-    if (std::strcmp(paramId, "filter_env_decay") == 0) return params_.filterEnvDecay;
-    if (std::strcmp(paramId, "filter_env_sustain") == 0) return params_.filterEnvSustain;
-    if (std::strcmp(paramId, "filter_env_release") == 0) return params_.filterEnvRelease;
-    if (std::strcmp(paramId, "filter_env_amount") == 0) return params_.filterEnvAmount;
+    // Get old value for logging (before change)
+    float oldValue = getParameter(index);
+    if (!storeParameter(index, value))
+        return;
 
-    if (std::strcmp(paramId, "amp_env_attack") == 0) return params_.ampEnvAttack;
-    if (std::strcmp(paramId, "amp_env_decay") == 0) return params_.ampEnvDecay;
-    if (std::strcmp(paramId, "amp_env_sustain") == 0) return params_.ampEnvSustain;
-    if (std::strcmp(paramId, "amp_env_release") == 0) return params_.ampEnvRelease;
+    // Log parameter change (shared telemetry infrastructure)
+    LOG_PARAMETER_CHANGE("Nature", PARAMETERS.idAt(index), oldValue, value);
 
-    // LFOs
-    if (std::strcmp(paramId, "lfo1_rate") == 0) return params_.lfo1Rate;
-    if (std::strcmp(paramId, "lfo1_depth") == 0) return params_.lfo1Depth;
+    // Recompute only what depends on this parameter
+    ++parameterGenerations_[static_cast<size_t>(index)];
+    dirtyGroups_ |= groupsForParameter(index);
+    applyDirtyParameters();
+}
 
-    if (std::strcmp(paramId, "lfo2_rate") == 0) return params_.lfo2Rate;
-    if (std::strcmp(paramId, "lfo2_depth") == 0) return params_.lfo2Depth;
+bool NaturePureDSP::storeParameter(int index, float value)
+{
+    if (index < 0 || index >= NUM_PARAMETERS || value == getParameter(index))
+        return false;
 
-    // Global
-    if (std::strcmp(paramId, "master_volume") == 0) return params_.masterVolume;
-    if (std::strcmp(paramId, "poly_mode") == 0) return params_.polyMode;
+    switch (index)
+    {
+        case PARAM_OSC1_SHAPE: params_.osc1Shape = value; break;
+        case PARAM_OSC1_WARP: params_.osc1Warp = value; break;
+        case PARAM_OSC1_PULSE_WIDTH: params_.osc1PulseWidth = value; break;
+        case PARAM_OSC1_DETUNE: params_.osc1Detune = value; break;
+        case PARAM_OSC1_LEVEL: params_.osc1Level = value; break;
+        case PARAM_OSC2_SHAPE: params_.osc2Shape = value; break;
+        case PARAM_OSC2_WARP: params_.osc2Warp = value; break;
+        case PARAM_OSC2_PULSE_WIDTH: params_.osc2PulseWidth = value; break;
+        case PARAM_OSC2_DETUNE: params_.osc2Detune = value; break;
+        case PARAM_OSC2_LEVEL: params_.osc2Level = value; break;
+        case PARAM_SUB_ENABLED: params_.subEnabled = value; break;
+        case PARAM_SUB_LEVEL: params_.subLevel = value; break;
+        case PARAM_FM_ENABLED: params_.fmEnabled = value; break;
+        case PARAM_FM_DEPTH: params_.fmDepth = value; break;
+        case PARAM_FILTER_TYPE: params_.filterType = value; break;
+        case PARAM_FILTER_CUTOFF: params_.filterCutoff = value; break;
+        case PARAM_FILTER_RESONANCE: params_.filterResonance = value; break;
+        case PARAM_FILTER_ENV_ATTACK: params_.filterEnvAttack = value; break;
+        case PARAM_FILTER_ENV_DECAY: params_.filterEnvDecay = value; break;
+        case PARAM_FILTER_ENV_SUSTAIN: params_.filterEnvSustain = value; break;
+        case PARAM_FILTER_ENV_RELEASE: params_.filterEnvRelease = value; break;
+        case PARAM_FILTER_ENV_AMOUNT: params_.filterEnvAmount = value; break;
+        case PARAM_AMP_ENV_ATTACK: params_.ampEnvAttack = value; break;
+        case PARAM_AMP_ENV_DECAY: params_.ampEnvDecay = value; break;
+        case PARAM_AMP_ENV_SUSTAIN: params_.ampEnvSustain = value; break;
+        case PARAM_AMP_ENV_RELEASE: params_.ampEnvRelease = value; break;
+        case PARAM_LFO1_RATE: params_.lfo1Rate = value; break;
+        case PARAM_LFO1_DEPTH: params_.lfo1Depth = value; break;
+        case PARAM_LFO2_RATE: params_.lfo2Rate = value; break;
+        case PARAM_LFO2_DEPTH: params_.lfo2Depth = value; break;
+        case PARAM_MASTER_VOLUME: params_.masterVolume = value; break;
+        case PARAM_POLY_MODE: params_.polyMode = value; break;
+        case PARAM_LFO1_WAVEFORM: params_.lfo1Waveform = value; break;
+        case PARAM_LFO1_BIPOLAR: params_.lfo1Bipolar = value; break;
+        case PARAM_LFO2_WAVEFORM: params_.lfo2Waveform = value; break;
+        case PARAM_LFO2_BIPOLAR: params_.lfo2Bipolar = value; break;
+        case PARAM_MASTER_TUNE: params_.masterTune = value; break;
+        default: break;
+    }
 
-    return 0.0f;
+    return true;
 }
 
-void NaturePureDSP::setParameter(const char* paramId, float value)
+void NaturePureDSP::applyPreset(const Preset& preset)
 {
-    // Get old value for logging (before change)
-    float oldValue = getParameter(paramId);
-
-    // OSC1
-    if (std::strcmp(paramId, "osc1_shape") == 0) params_.osc1Shape = value;
-    if (std::strcmp(paramId, "osc1_warp") == 0) params_.osc1Warp = value;
-    if (std::strcmp(paramId, "osc1_pulse_width") == 0) params_.osc1PulseWidth = value;
-    if (std::strcmp(paramId, "osc1_detune") == 0) params_.osc1Detune = value;
-    if (std::strcmp(paramId, "osc1_level") == 0) params_.osc1Level = value;
-
-    // OSC2
-    if (std::strcmp(paramId, "osc2_shape") == 0) params_.osc2Shape = value;
-    if (std::strcmp(paramId, "osc2_warp") == 0) params_.osc2Warp = value;
-    if (std::strcmp(paramId, "osc2_pulse_width") == 0) params_.osc2PulseWidth = value;
-    if (std::strcmp(paramId, "osc2_detune") == 0) params_.osc2Detune = value;
-    if (std::strcmp(paramId, "osc2_level") == 0) params_.osc2Level = value;
-
-    // Sub
-    if (std::strcmp(paramId, "sub_enabled") == 0) params_.subEnabled = value;
-    if (std::strcmp(paramId, "sub_level") == 0) params_.subLevel = value;
-
-    // FM
-    if (std::strcmp(paramId, "fm_enabled") == 0) params_.fmEnabled = value;
-    if (std::strcmp(paramId, "fm_depth") == 0) params_.fmDepth = value;
-
-    // Filter
-    if (std::strcmp(paramId, "filter_type") == 0) params_.filterType = value;
-    if (std::strcmp(paramId, "filter_cutoff") == 0) params_.filterCutoff = value;
-    if (std::strcmp(paramId, "filter_resonance") == 0) params_.filterResonance = value;
-
-    // Envelopes
-    if (std::strcmp(paramId, "filter_env_attack") == 0) params_.filterEnvAttack = value;
-    if (std::strcmp(paramId, "filter_env_decay") == 0) params_.filterEnvDecay = value;
-    if (std::strcmp(paramId, "filter_env_sustain") == 0) params_.filterEnvSustain = value;
-    if (std::strcmp(paramId, "filter_env_release") == 0) params_.filterEnvRelease = value;
-    if (std::strcmp(paramId, "filter_env_amount") == 0) params_.filterEnvAmount = value;
+    // Store everything, then push the union of the touched groups once
+    for (int i = 0; i < preset.size(); ++i)
+    {
+        const int index = preset[i].index;
+        if (storeParameter(index, preset[i].value))
+        {
+            ++parameterGenerations_[static_cast<size_t>(index)];
+            dirtyGroups_ |= groupsForParameter(index);
+        }
+    }
+    applyDirtyParameters();
+}
 
-    if (std::strcmp(paramId, "amp_env_attack") == 0) params_.ampEnvAttack = value;
-    if (std::strcmp(paramId, "amp_env_decay") == 0) params_.ampEnvDecay = value;
-    if (std::strcmp(paramId, "amp_env_sustain") == 0) params_.ampEnvSustain = value;
-    if (std::strcmp(paramId, "amp_env_release") == 0) params_.ampEnvRelease = value;
+void NaturePureDSP::publishPreset(const Preset& preset)
+{
+    for (int i = 0; i < preset.size(); ++i)
+    {
+        publishedParameters_.publish(preset[i].index, preset[i].value);
+    }
+}
 
-    // LFOs
-    if (std::strcmp(paramId, "lfo1_rate") == 0) params_.lfo1Rate = value;
-    if (std::strcmp(paramId, "lfo1_depth") == 0) params_.lfo1Depth = value;
+void NaturePureDSP::applyPublishedParameters()
+{
+    // Same batching as applyPreset(): store everything, push the groups once
+    bool changed = false;
+    publishedParameters_.drain([&](int index, float value)
+    {
+        if (storeParameter(index, value))
+        {
+            ++parameterGenerations_[static_cast<size_t>(index)];
+            dirtyGroups_ |= groupsForParameter(index);
+            changed = true;
+        }
+    });
 
-    if (std::strcmp(paramId, "lfo2_rate") == 0) params_.lfo2Rate = value;
-    if (std::strcmp(paramId, "lfo2_depth") == 0) params_.lfo2Depth = value;
+    if (changed)
+        applyDirtyParameters();
+}
 
-    // Global
-    if (std::strcmp(paramId, "master_volume") == 0) params_.masterVolume = value;
-    if (std::strcmp(paramId, "poly_mode") == 0) params_.polyMode = value;
+bool NaturePureDSP::loadBinaryPreset(const void* data, size_t size)
+{
+    Preset preset;
+    if (!preset.readBinary(data, size, PARAMETERS.layoutHash()))
+        return false;
 
-    // Log parameter change (shared telemetry infrastructure)
-    LOG_PARAMETER_CHANGE("Nature", paramId, oldValue, value);
+    publishPreset(preset);
+    return true;
+}
 
-    applyParameters();
+uint32_t NaturePureDSP::groupsForParameter(int index)
+{
+    switch (index)
+    {
+        case PARAM_OSC1_SHAPE:
+        case PARAM_OSC1_WARP:
+        case PARAM_OSC1_PULSE_WIDTH:
+        case PARAM_OSC1_DETUNE:
+        case PARAM_OSC1_LEVEL:
+        case PARAM_OSC2_SHAPE:
+        case PARAM_OSC2_WARP:
+        case PARAM_OSC2_PULSE_WIDTH:
+        case PARAM_OSC2_DETUNE:
+        case PARAM_OSC2_LEVEL:
+        case PARAM_SUB_ENABLED:
+        case PARAM_SUB_LEVEL:
+        case PARAM_FM_ENABLED:
+        case PARAM_FM_DEPTH:
+            return VOICE_GROUP_OSCILLATORS;
+
+        case PARAM_FILTER_TYPE:
+        case PARAM_FILTER_CUTOFF:
+        case PARAM_FILTER_RESONANCE:
+        case PARAM_FILTER_ENV_AMOUNT:
+            return VOICE_GROUP_FILTER;
+
+        case PARAM_FILTER_ENV_ATTACK:
+        case PARAM_FILTER_ENV_DECAY:
+        case PARAM_FILTER_ENV_SUSTAIN:
+        case PARAM_FILTER_ENV_RELEASE:
+            return VOICE_GROUP_FILTER_ENV;
+
+        case PARAM_AMP_ENV_ATTACK:
+        case PARAM_AMP_ENV_DECAY:
+        case PARAM_AMP_ENV_SUSTAIN:
+        case PARAM_AMP_ENV_RELEASE:
+            return VOICE_GROUP_AMP_ENV;
+
+        case PARAM_LFO1_RATE:
+        case PARAM_LFO1_DEPTH:
+        case PARAM_LFO2_RATE:
+        case PARAM_LFO2_DEPTH:
+        case PARAM_LFO1_WAVEFORM:
+        case PARAM_LFO1_BIPOLAR:
+        case PARAM_LFO2_WAVEFORM:
+        case PARAM_LFO2_BIPOLAR:
+            return VOICE_GROUP_LFO;
+
+        // Read directly at render time or note-on
+        case PARAM_MASTER_VOLUME:
+        case PARAM_POLY_MODE:
+        case PARAM_MASTER_TUNE:
+        default:
+            return VOICE_GROUP_NONE;
+    }
 }
 
 void NaturePureDSP::applyParameters()
 {
-    // Update all voices with current synth parameters
-    voiceManager_.updateVoiceParameters(*this);
+    dirtyGroups_ = VOICE_GROUP_ALL;
+    applyDirtyParameters();
+}
+
+void NaturePureDSP::applyDirtyParameters()
+{
+    const uint32_t groups = dirtyGroups_;
+    dirtyGroups_ = VOICE_GROUP_NONE;
+
+    // Update voices with the changed synth parameter groups
+    voiceManager_.updateVoiceParameters(*this, groups);
+
+    if ((groups & VOICE_GROUP_LFO) == 0)
+        return;
+
+    // LFOs feed the modulation matrix
+    modMatrix_.lfo1.setRate(params_.lfo1Rate, sampleRate_);
+    modMatrix_.lfo1.setDepth(params_.lfo1Depth);
+    modMatrix_.lfo1.setWaveform(static_cast<LFOWaveform>(std::clamp(static_cast<int>(params_.lfo1Waveform), 0, 4)));
+    modMatrix_.lfo1.setBipolar(params_.lfo1Bipolar > 0.5f);
+    modMatrix_.lfo2.setRate(params_.lfo2Rate, sampleRate_);
+    modMatrix_.lfo2.setDepth(params_.lfo2Depth);
+    modMatrix_.lfo2.setWaveform(static_cast<LFOWaveform>(std::clamp(static_cast<int>(params_.lfo2Waveform), 0, 4)));
+    modMatrix_.lfo2.setBipolar(params_.lfo2Bipolar > 0.5f);
 }
 
 int NaturePureDSP::getActiveVoiceCount() const
@@ -1563,49 +2503,10 @@ bool NaturePureDSP::loadUPFSPreset(const UPFS::Preset& preset)
 
 bool NaturePureDSP::loadLegacyPreset(const char* jsonData)
 {
-    // Simplified JSON parsing for legacy format
-    double value;
-
-    if (parseJsonParameter(jsonData, "osc1_shape", value))
-        params_.osc1Shape = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc1_warp", value))
-        params_.osc1Warp = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc1_level", value))
-        params_.osc1Level = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_shape", value))
-        params_.osc2Shape = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_warp", value))
-        params_.osc2Warp = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "osc2_level", value))
-        params_.osc2Level = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "filter_cutoff", value))
-        params_.filterCutoff = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "filter_resonance", value))
-        params_.filterResonance = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "amp_env_attack", value))
-        params_.ampEnvAttack = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "amp_env_decay", value))
-        params_.ampEnvDecay = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "amp_env_sustain", value))
-        params_.ampEnvSustain = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "amp_env_release", value))
-        params_.ampEnvRelease = static_cast<float>(value);
-
-    if (parseJsonParameter(jsonData, "master_volume", value))
-        params_.masterVolume = static_cast<float>(value);
-
-    applyParameters();
+    // One pass over the text, keyed by the parameter registry
+    Preset preset;
+    compilePreset(jsonData, preset);
+    applyPreset(preset);
     return true;
 }
 
@@ -1619,22 +2520,6 @@ bool NaturePureDSP::writeJsonParameter(const char* name, double value, char* buf
     return true;
 }
 
-bool NaturePureDSP::parseJsonParameter(const char* json, const char* param, double& value) const
-{
-    // Very simple JSON parsing (sufficient for test cases)
-    char searchPattern[256];
-    snprintf(searchPattern, sizeof(searchPattern), "\"%s\":", param);
-
-    const char* found = std::strstr(json, searchPattern);
-    if (!found)
-        return false;
-
-    found += std::strlen(searchPattern);
-    value = std::atof(found);
-
-    return true;
-}
-
 //==============================================================================
 // Static Factory (No runtime registration for tvOS hardening)
 //==============================================================================
@@ -13,6 +13,8 @@
 
 #include "dsp/StringPureDSP.h"
 #include "../../../../include/dsp/DSPLogging.h"
+#include "../../../../include/dsp/SharedTables.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
 #include <cstring>
 #include <random>
 #include <algorithm>
@@ -37,11 +39,10 @@ AetherStringWaveguideString::~AetherStringWaveguideString()
 void AetherStringWaveguideString::prepare(double sampleRate, int maxDelaySamples)
 {
     this->sampleRate = sampleRate;
-    delayLine.resize(maxDelaySamples);
-    std::fill(delayLine.begin(), delayLine.end(), 0.0f);
+    delayLine.prepare(maxDelaySamples);
 
-    writeIndex = 0;
     delayLength = calculateDelayLength(params.frequency);
+    delayLine.setDelay(static_cast<float>(delayLength));
 
     stiffnessState = 0.0f;
     dampingState = 0.0f;
@@ -49,8 +50,7 @@ void AetherStringWaveguideString::prepare(double sampleRate, int maxDelaySamples
 
 void AetherStringWaveguideString::reset()
 {
-    std::fill(delayLine.begin(), delayLine.end(), 0.0f);
-    writeIndex = 0;
+    delayLine.reset();
     stiffnessState = 0.0f;
     dampingState = 0.0f;
     lastBridgeEnergy = 0.0f;
@@ -61,36 +61,25 @@ void AetherStringWaveguideString::excite(const float* exciterSignal, int numSamp
     // Fill the ENTIRE delay line with exciter signal to avoid initial silence
     // This simulates exciting the whole string at once (like a bow or wide pluck)
     // We loop the exciter signal to fill the entire delay line
-    for (size_t i = 0; i < delayLine.size(); ++i)
-    {
-        int exciterIdx = i % numSamples;
-        delayLine[i] = exciterSignal[exciterIdx] * velocity;
-    }
-
-    // Reset write pointer to beginning (excitation fills whole buffer)
-    writeIndex = 0;
+    // (also resets the write pointer to the beginning)
+    delayLine.fill(exciterSignal, numSamples, velocity);
 }
 
 float AetherStringWaveguideString::processSample()
 {
-    // Read from delay line
-    int readIndex = (writeIndex - delayLength + static_cast<int>(delayLine.size()))
-                     % static_cast<int>(delayLine.size());
-
-    float output = delayLine[readIndex];
-
-    // Apply stiffness filter (allpass for inharmonicity)
-    float stiffened = processStiffnessFilter(output);
-
-    // Apply damping filter (lowpass for brightness)
-    float damped = processDampingFilter(stiffened);
+    // Read from delay line, filter, write back
+    delayLine.processSample([this](float output)
+    {
+        // Apply stiffness filter (allpass for inharmonicity)
+        float stiffened = processStiffnessFilter(output);
 
-    // Write back to delay line
-    delayLine[writeIndex] = damped;
-    writeIndex = (writeIndex + 1) % delayLine.size();
+        // Apply damping filter (lowpass for brightness)
+        float damped = processDampingFilter(stiffened);
 
-    // Calculate bridge energy (output) - scale for better signal level
-    lastBridgeEnergy = damped * params.bridgeCoupling * 5.0f;
+        // Calculate bridge energy (output) - scale for better signal level
+        lastBridgeEnergy = damped * params.bridgeCoupling * 5.0f;
+        return damped;
+    });
 
     return lastBridgeEnergy;
 }
@@ -99,14 +88,13 @@ void AetherStringWaveguideString::setParameters(const Parameters& p)
 {
     params = p;
     delayLength = calculateDelayLength(p.frequency);
+    delayLine.setDelay(static_cast<float>(delayLength));
 }
 
 void AetherStringWaveguideString::injectReflection(float reflection)
 {
     // Add reflected energy to the most recently written sample in delay line
-    int lastWriteIndex = (writeIndex - 1 + static_cast<int>(delayLine.size()))
-                         % static_cast<int>(delayLine.size());
-    delayLine[lastWriteIndex] += reflection;
+    delayLine.addToNewest(reflection);
 }
 
 float AetherStringWaveguideString::processStiffnessFilter(float input)
@@ -144,7 +132,7 @@ float AetherStringWaveguideString::processDampingFilter(float input)
     // Higher brightness = less filtering (more high frequencies)
     float alpha = 1.0f - (brightness * 0.1f);
     float output = alpha * dampingState + (1.0f - alpha) * input;
-    dampingState = output;
+    dampingState = flushDenormal(output);
 
     // Apply gentle damping per-sample (much less aggressive)
     // damping parameter: 0.996 means very slight decay per sample
@@ -162,57 +150,17 @@ float AetherStringWaveguideString::processDampingFilter(float input)
 
 int AetherStringWaveguideString::calculateDelayLength(float frequency)
 {
-    if (frequency <= 0.0f) return static_cast<int>(delayLine.size() / 2);
+    if (frequency <= 0.0f) return delayLine.getMaximumDelay() / 2;
 
     double period = sampleRate / frequency;
     int length = static_cast<int>(period);
 
     // Clamp to valid range
-    length = std::max(10, std::min(length, static_cast<int>(delayLine.size()) - 10));
+    length = std::max(10, std::min(length, delayLine.getMaximumDelay() - 10));
 
     return length;
 }
 
-//==============================================================================
-// Bridge Coupling Implementation
-//==============================================================================
-
-AetherStringBridgeCoupling::AetherStringBridgeCoupling()
-{
-}
-
-void AetherStringBridgeCoupling::prepare(double sampleRate)
-{
-    this->sampleRate = sampleRate;
-}
-
-void AetherStringBridgeCoupling::reset()
-{
-    bridgeEnergy = 0.0f;
-}
-
-float AetherStringBridgeCoupling::processString(float stringOutput)
-{
-    // Apply nonlinear saturation to prevent explosion
-    float input = stringOutput * couplingCoefficient * (1.0f + nonlinearity);
-    bridgeEnergy = std::tanh(input);
-
-    // Reflected energy
-    float reflected = stringOutput - bridgeEnergy;
-
-    return reflected;
-}
-
-void AetherStringBridgeCoupling::setCouplingCoefficient(float coeff)
-{
-    couplingCoefficient = std::max(0.0f, std::min(1.0f, coeff));
-}
-
-void AetherStringBridgeCoupling::setNonlinearity(float nonlin)
-{
-    nonlinearity = std::max(0.0f, std::min(1.0f, nonlin));
-}
-
 //==============================================================================
 // Modal Filter Implementation
 //==============================================================================
@@ -272,28 +220,17 @@ AetherStringModalBodyResonator::AetherStringModalBodyResonator()
 void AetherStringModalBodyResonator::prepare(double sampleRate)
 {
     this->sampleRate = sampleRate;
-    for (auto& mode : modes)
-    {
-        mode.prepare(sampleRate);
-    }
+    modes.prepare(sampleRate);
 }
 
 void AetherStringModalBodyResonator::reset()
 {
-    for (auto& mode : modes)
-    {
-        mode.reset();
-    }
+    modes.reset();
 }
 
 float AetherStringModalBodyResonator::processSample(float bridgeEnergy)
 {
-    float output = 0.0f;
-    for (auto& mode : modes)
-    {
-        output += mode.processSample(bridgeEnergy);
-    }
-    return output * resonanceAmount;
+    return modes.processSample(bridgeEnergy) * resonanceAmount;
 }
 
 void AetherStringModalBodyResonator::setResonance(float amount)
@@ -341,7 +278,7 @@ void AetherStringModalBodyResonator::loadGuitarBodyPreset()
 
 float AetherStringModalBodyResonator::getModeFrequency(int index) const
 {
-    if (index >= 0 && index < static_cast<int>(modes.size()))
+    if (index >= 0 && index < modes.size())
         return modes[index].frequency;
     return 0.0f;
 }
@@ -565,7 +502,7 @@ void AetherStringVoice::noteOn(int note, float vel, double currentSampleRate)
 
     // Set string frequency
     AetherStringWaveguideString::Parameters params = string.getParameters();
-    params.frequency = static_cast<float>(440.0 * std::pow(2.0, (note - 69) / 12.0));
+    params.frequency = SharedTables::get().midiToFrequency(static_cast<float>(note));
     string.setParameters(params);
 
     // Generate pluck excitation (with higher amplitude for testing)
@@ -666,6 +603,7 @@ void AetherStringVoiceManager::prepare(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate_ = sampleRate;
     maxDelaySamples_ = static_cast<int>(sampleRate * 2.0); // 2 seconds max delay
+    voiceOutputs_.prepare(std::max(samplesPerBlock, 1), NUM_VOICES);
 
     for (auto& voice : voices_)
     {
@@ -747,6 +685,12 @@ void AetherStringVoiceManager::allNotesOff()
 
 void AetherStringVoiceManager::processBlock(float* output, int numSamples)
 {
+    if (renderPool_ != nullptr && renderPool_->getNumWorkers() > 0 && voiceOutputs_.getMaxBlockSize() > 0)
+    {
+        processParallelBlock(output, numSamples);
+        return;
+    }
+
     std::fill(output, output + numSamples, 0.0f);
 
     for (auto& voice : voices_)
@@ -761,6 +705,49 @@ void AetherStringVoiceManager::processBlock(float* output, int numSamples)
     }
 }
 
+void AetherStringVoiceManager::processParallelBlock(float* output, int numSamples)
+{
+    std::fill(output, output + numSamples, 0.0f);
+
+    voiceOutputs_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        int numVoices = 0;
+        for (int v = 0; v < NUM_VOICES; ++v)
+        {
+            if (voices_[v].active)
+            {
+                renderVoices_[numVoices++] = v;
+            }
+        }
+        renderSamples_ = n;
+
+        renderPool_->run(&AetherStringVoiceManager::renderTask, this, numVoices);
+
+        // Summed in voice order, as in the serial path
+        for (int r = 0; r < numVoices; ++r)
+        {
+            const float* voiceOut = voiceOutputs_.getBuffer(renderVoices_[r]);
+            for (int i = 0; i < n; ++i)
+            {
+                output[offset + i] += voiceOut[i];
+            }
+        }
+    });
+}
+
+void AetherStringVoiceManager::renderTask(void* context, int task, int /*participant*/)
+{
+    auto& self = *static_cast<AetherStringVoiceManager*>(context);
+    const int v = self.renderVoices_[task];
+    AetherStringVoice& voice = self.voices_[v];
+    float* voiceOut = self.voiceOutputs_.getBuffer(v);
+
+    for (int i = 0; i < self.renderSamples_; ++i)
+    {
+        voiceOut[i] = voice.renderSample();
+    }
+}
+
 int AetherStringVoiceManager::getActiveVoiceCount() const
 {
     int count = 0;
@@ -802,6 +789,7 @@ void AetherStringVoiceManager::loadGuitarBodyPreset()
 StringPureDSP::StringPureDSP()
 {
     // Load guitar body preset (will be applied in prepare)
+    scratch_.prepare(DEFAULT_MAX_BLOCK_SIZE, NUM_SCRATCH_BUFFERS);
 }
 
 StringPureDSP::~StringPureDSP()
@@ -813,6 +801,11 @@ bool StringPureDSP::prepare(double sampleRate, int blockSize)
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    scratch_.prepare(std::max(blockSize, 1), NUM_SCRATCH_BUFFERS);
+
+    // Shared sine / note tables: built by the first instance, reused by the rest
+    SharedTables::get();
+
     int maxDelaySamples = static_cast<int>(sampleRate * 2.0);
     voiceManager_.prepare(sampleRate, blockSize);
 
@@ -830,22 +823,29 @@ void StringPureDSP::reset()
 
 void StringPureDSP::process(float** outputs, int numChannels, int numSamples)
 {
+    ScopedFlushDenormals noDenormals;
+
     // Clear output buffers
     for (int ch = 0; ch < numChannels; ++ch)
     {
         std::fill(outputs[ch], outputs[ch] + numSamples, 0.0f);
     }
 
-    // Render mono using real-time safe stack buffer
-    // Assert for safety in debug builds - block size should never exceed MAX_BLOCK_SIZE
-    assert(numSamples <= MAX_BLOCK_SIZE && "Block size exceeds maximum buffer size");
-
-    voiceManager_.processBlock(tempBuffer_, numSamples);
+    // Render mono in chunks of the prepared scratch size
+    float* mix = scratch_.getBuffer(SCRATCH_MIX);
+    scratch_.forEachChunk(numSamples, [&](int offset, int n)
+    {
+        voiceManager_.processBlock(mix, n);
+        writeOutput(mix, outputs, numChannels, offset, n);
+    });
+}
 
+void StringPureDSP::writeOutput(const float* mix, float** outputs, int numChannels, int offset, int numSamples)
+{
     // Apply master volume and copy to outputs with NaN safety
     for (int i = 0; i < numSamples; ++i)
     {
-        float sample = tempBuffer_[i] * params_.masterVolume;
+        float sample = mix[i] * params_.masterVolume;
 
         // Check for NaN/Inf in final output
         if (std::isnan(sample) || std::isinf(sample))
@@ -858,7 +858,7 @@ void StringPureDSP::process(float** outputs, int numChannels, int numSamples)
 
         for (int ch = 0; ch < numChannels; ++ch)
         {
-            outputs[ch][i] = sample;
+            outputs[ch][offset + i] = sample;
         }
     }
 }
@@ -879,6 +879,15 @@ void StringPureDSP::handleEvent(const ScheduledEvent& event)
             pitchBend_ = event.data.pitchBend.bendValue * params_.pitchBendRange;
             break;
 
+        case ScheduledEvent::CONTROL_CHANGE:
+            if (event.data.controlChange.controllerNumber == MIDI_CC_ALL_NOTES_OFF)
+                voiceManager_.allNotesOff();
+            break;
+
+        case ScheduledEvent::RESET:
+            voiceManager_.reset();
+            break;
+
         default:
             break;
     }
@@ -991,22 +1000,24 @@ bool StringPureDSP::loadPreset(const char* jsonData)
 
 bool StringPureDSP::loadUPFSPreset(const char* jsonData)
 {
+    // One pass over the text; lookups below are table hits
+    const JsonNumberTable<> fields(jsonData);
     double value;
 
     // UPFS v1.0 format parameters
-    if (parseJsonParameter(jsonData, "string_damping", value))
+    if (fields.find("string_damping", value))
         params_.stringDamping = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_stiffness", value))
+    if (fields.find("string_stiffness", value))
         params_.stringStiffness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_brightness", value))
+    if (fields.find("string_brightness", value))
         params_.stringBrightness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "bridge_coupling", value))
+    if (fields.find("bridge_coupling", value))
         params_.bridgeCoupling = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "body_resonance", value))
+    if (fields.find("body_resonance", value))
         params_.bodyResonance = static_cast<float>(value);
 
     // Master volume (optional in UPFS, default if not present)
-    if (parseJsonParameter(jsonData, "master_volume", value))
+    if (fields.find("master_volume", value))
         params_.masterVolume = static_cast<float>(value);
     else
         params_.masterVolume = 0.85f; // Default value
@@ -1018,20 +1029,22 @@ bool StringPureDSP::loadUPFSPreset(const char* jsonData)
 
 bool StringPureDSP::loadLegacyPreset(const char* jsonData)
 {
+    // One pass over the text; lookups below are table hits
+    const JsonNumberTable<> fields(jsonData);
     double value;
 
     // Legacy format parameters
-    if (parseJsonParameter(jsonData, "master_volume", value))
+    if (fields.find("master_volume", value))
         params_.masterVolume = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_damping", value))
+    if (fields.find("string_damping", value))
         params_.stringDamping = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_stiffness", value))
+    if (fields.find("string_stiffness", value))
         params_.stringStiffness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "string_brightness", value))
+    if (fields.find("string_brightness", value))
         params_.stringBrightness = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "bridge_coupling", value))
+    if (fields.find("bridge_coupling", value))
         params_.bridgeCoupling = static_cast<float>(value);
-    if (parseJsonParameter(jsonData, "body_resonance", value))
+    if (fields.find("body_resonance", value))
         params_.bodyResonance = static_cast<float>(value);
 
     applyParameters();
@@ -1063,7 +1076,7 @@ void StringPureDSP::processStereoSample(float& left, float& right)
 
 float StringPureDSP::calculateFrequency(int midiNote, float bend) const
 {
-    return static_cast<float>(440.0 * std::pow(2.0, (midiNote - 69 + bend) / 12.0));
+    return SharedTables::get().midiToFrequency(static_cast<float>(midiNote) + bend);
 }
 
 void StringPureDSP::generatePluckExcitation(float* output, int numSamples)
@@ -1105,22 +1118,6 @@ bool StringPureDSP::writeJsonParameter(const char* name, double value,
     return true;
 }
 
-bool StringPureDSP::parseJsonParameter(const char* json, const char* param,
-                                                       double& value) const
-{
-    const char* search = json;
-    char pattern[100];
-    std::snprintf(pattern, sizeof(pattern), "\"%s\":", param);
-
-    const char* found = std::strstr(search, pattern);
-    if (!found) return false;
-
-    found += std::strlen(pattern);
-    value = std::atof(found);
-
-    return true;
-}
-
 //==============================================================================
 // Static Factory (No runtime registration for tvOS hardening)
 //==============================================================================
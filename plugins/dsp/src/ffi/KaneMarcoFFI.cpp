@@ -16,9 +16,14 @@
 #include <juce_core/juce_core.h>
 #include "../include/ffi/NatureFFI.h"
 #include "../include/dsp/NatureDSP.h"
+#include "dsp/KaneMarcoPureDSP.h"
+#include "../../../../include/dsp/ParameterExchange.h"
+#include "../../../../include/dsp/ScheduledEventQueue.h"
+#include <algorithm>
 #include <string>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 //==============================================================================
 // Instance Management
@@ -32,7 +37,37 @@ struct NatureDSPInstance
     std::unique_ptr<NatureDSP> synth;
     std::string lastError;
 
-    NatureDSPInstance() : synth(std::make_unique<NatureDSP>()) {}
+    // Parameters in nature_get_parameter_id() order, resolved once so the
+    // index-based calls never touch strings
+    std::vector<juce::RangedAudioParameter*> parameterCache;
+
+    // Engine index of each parameterCache entry (-1: not an engine parameter)
+    std::vector<int> engineParameterIndex;
+
+    // Real-time render path (nature_render*): the pure engine, bypassing the
+    // JUCE processor, plus planar scratch sized in nature_initialize()
+    static constexpr int MAX_RENDER_CHANNELS = 8;
+    static constexpr int INTERLEAVED_CHANNELS = 2;
+    std::unique_ptr<DSP::NaturePureDSP> engine;
+    std::vector<float> renderScratch;
+    int maxBlockSize = 0;
+
+    // Parameter sets from the control thread, drained by nature_render*
+    DSP::ParameterExchange<DSP::NaturePureDSP::NUM_PARAMETERS> pendingParameters;
+
+    NatureDSPInstance()
+        : synth(std::make_unique<NatureDSP>()),
+          engine(std::make_unique<DSP::NaturePureDSP>())
+    {
+        for (auto* param : synth->parameters.getParameters())
+        {
+            auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(param);
+            parameterCache.push_back(ranged);
+            engineParameterIndex.push_back(ranged != nullptr
+                ? DSP::NaturePureDSP::getParameterIndex(ranged->getParameterID().toRawUTF8())
+                : -1);
+        }
+    }
 };
 
 //==============================================================================
@@ -69,6 +104,11 @@ bool nature_initialize(NatureDSPInstance* instance, double sampleRate, int sampl
     try
     {
         instance->synth->prepareToPlay(sampleRate, samplesPerBlock);
+
+        instance->maxBlockSize = std::max(1, samplesPerBlock);
+        instance->renderScratch.assign(
+            static_cast<size_t>(instance->maxBlockSize) * NatureDSPInstance::INTERLEAVED_CHANNELS, 0.0f);
+        instance->engine->prepare(sampleRate, instance->maxBlockSize);
         return true;
     }
     catch (const std::exception& e)
@@ -184,6 +224,158 @@ void nature_process_midi_buffer(NatureDSPInstance* instance,
     }
 }
 
+//==============================================================================
+// Real-Time Render Functions
+//==============================================================================
+
+namespace
+{
+
+void dispatchMidi(DSP::NaturePureDSP& engine, const NatureMidiEvent& midi)
+{
+    DSP::ScheduledEvent event;
+    if (DSP::toScheduledEvent(midi.data, std::min<int>(midi.size, sizeof(midi.data)), 0, event))
+    {
+        engine.handleEvent(event);
+    }
+}
+
+/**
+ * Render numSamples starting at blockStart, splitting at every event that
+ * lands inside; nextEvent is left on the first event of a later block
+ */
+void renderSegmented(DSP::NaturePureDSP& engine,
+                     float* const* outputs,
+                     int numChannels,
+                     int blockStart,
+                     int numSamples,
+                     const NatureMidiEvent* events,
+                     int numEvents,
+                     int& nextEvent)
+{
+    float* segment[NatureDSPInstance::MAX_RENDER_CHANNELS];
+    int position = 0;
+
+    while (position < numSamples)
+    {
+        int end = numSamples;
+        while (nextEvent < numEvents)
+        {
+            const int offset = events[nextEvent].sampleOffset - blockStart;
+            if (offset > position)
+            {
+                end = std::min(offset, numSamples);
+                break;
+            }
+            dispatchMidi(engine, events[nextEvent]);
+            ++nextEvent;
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            segment[ch] = outputs[ch] + position;
+        }
+        engine.process(segment, numChannels, end - position);
+        position = end;
+    }
+}
+
+bool canRender(const NatureDSPInstance* instance, int numSamples, const NatureMidiEvent* events, int numEvents)
+{
+    return instance != nullptr && instance->engine != nullptr && instance->maxBlockSize > 0
+        && numSamples > 0 && numEvents >= 0 && (events != nullptr || numEvents == 0);
+}
+
+// Audio thread: apply parameter sets published since the last block
+void applyPendingParameters(NatureDSPInstance& instance)
+{
+    instance.pendingParameters.drain([&](int index, float value)
+    {
+        instance.engine->setParameter(index, value);
+    });
+}
+
+} // namespace
+
+bool nature_render(NatureDSPInstance* instance,
+                       float* const* outputs,
+                       int numChannels,
+                       int numSamples,
+                       const NatureMidiEvent* events,
+                       int numEvents)
+{
+    if (!canRender(instance, numSamples, events, numEvents))
+    {
+        return false;
+    }
+
+    if (outputs == nullptr || numChannels < 1 || numChannels > NatureDSPInstance::MAX_RENDER_CHANNELS)
+    {
+        return false;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        if (outputs[ch] == nullptr)
+        {
+            return false;
+        }
+    }
+
+    applyPendingParameters(*instance);
+
+    int nextEvent = 0;
+    renderSegmented(*instance->engine, outputs, numChannels, 0, numSamples, events, numEvents, nextEvent);
+
+    // Events past the end of the block
+    for (; nextEvent < numEvents; ++nextEvent)
+    {
+        dispatchMidi(*instance->engine, events[nextEvent]);
+    }
+    return true;
+}
+
+bool nature_render_interleaved(NatureDSPInstance* instance,
+                                   float* output,
+                                   int numSamples,
+                                   const NatureMidiEvent* events,
+                                   int numEvents)
+{
+    if (!canRender(instance, numSamples, events, numEvents) || output == nullptr)
+    {
+        return false;
+    }
+
+    applyPendingParameters(*instance);
+
+    const int maxBlockSize = instance->maxBlockSize;
+    float* planar[NatureDSPInstance::INTERLEAVED_CHANNELS] = {
+        instance->renderScratch.data(),
+        instance->renderScratch.data() + maxBlockSize
+    };
+
+    int nextEvent = 0;
+    for (int offset = 0; offset < numSamples; offset += maxBlockSize)
+    {
+        const int n = std::min(maxBlockSize, numSamples - offset);
+        renderSegmented(*instance->engine, planar, NatureDSPInstance::INTERLEAVED_CHANNELS,
+                        offset, n, events, numEvents, nextEvent);
+
+        float* out = output + static_cast<size_t>(offset) * 2;
+        for (int i = 0; i < n; ++i)
+        {
+            out[i * 2] = planar[0][i];
+            out[i * 2 + 1] = planar[1][i];
+        }
+    }
+
+    for (; nextEvent < numEvents; ++nextEvent)
+    {
+        dispatchMidi(*instance->engine, events[nextEvent]);
+    }
+    return true;
+}
+
 //==============================================================================
 // Parameter Control Functions
 //==============================================================================
@@ -288,6 +480,7 @@ bool nature_set_parameter_value(NatureDSPInstance* instance,
     {
         juce::String paramId(parameterId);
         instance->synth->setParameterValue(paramId, value);
+        instance->pendingParameters.publish(DSP::NaturePureDSP::getParameterIndex(parameterId), value);
         return true;
     }
     catch (const std::exception& e)
@@ -297,6 +490,57 @@ bool nature_set_parameter_value(NatureDSPInstance* instance,
     }
 }
 
+int nature_get_parameter_index(NatureDSPInstance* instance, const char* parameterId)
+{
+    if (instance == nullptr || parameterId == nullptr)
+    {
+        return -1;
+    }
+
+    // Resolve once at setup time; use the index for automation
+    for (size_t i = 0; i < instance->parameterCache.size(); ++i)
+    {
+        auto* param = instance->parameterCache[i];
+        if (param != nullptr && param->getParameterID() == parameterId)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+float nature_get_parameter_value_at(NatureDSPInstance* instance, int index)
+{
+    if (instance == nullptr || index < 0
+        || index >= static_cast<int>(instance->parameterCache.size()))
+    {
+        return 0.0f;
+    }
+
+    auto* param = instance->parameterCache[static_cast<size_t>(index)];
+    return param != nullptr ? param->convertFrom0to1(param->getValue()) : 0.0f;
+}
+
+bool nature_set_parameter_value_at(NatureDSPInstance* instance, int index, float value)
+{
+    if (instance == nullptr || index < 0
+        || index >= static_cast<int>(instance->parameterCache.size()))
+    {
+        return false;
+    }
+
+    auto* param = instance->parameterCache[static_cast<size_t>(index)];
+    if (param == nullptr)
+    {
+        return false;
+    }
+
+    param->setValueNotifyingHost(param->convertTo0to1(value));
+    instance->pendingParameters.publish(instance->engineParameterIndex[static_cast<size_t>(index)], value);
+    return true;
+}
+
 bool nature_get_parameter_name(NatureDSPInstance* instance,
                                   const char* parameterId,
                                   char* nameBuffer,
@@ -606,6 +850,12 @@ bool nature_load_preset(NatureDSPInstance* instance, const char* jsonData)
     {
         std::string jsonStr(jsonData);
         instance->synth->setPresetState(jsonStr);
+
+        // Compile here (legacy and UPFS alike: the "parameters" object wins)
+        // and stage it; the render thread applies it at its next block
+        DSP::NaturePureDSP::Preset preset;
+        DSP::NaturePureDSP::compilePreset(jsonData, preset);
+        instance->engine->publishPreset(preset);
         return true;
     }
     catch (const std::exception& e)
@@ -900,3 +1150,59 @@ int nature_get_latency(NatureDSPInstance* instance)
         return 0;
     }
 }
+
+//==============================================================================
+// Real-time Telemetry
+//==============================================================================
+
+static_assert(NATURE_TELEMETRY_STAGE_BODY == static_cast<int>(DSP::TelemetryStage::Body)
+              && NATURE_TELEMETRY_STAGE_VOICES == static_cast<int>(DSP::TelemetryStage::Voices),
+              "NatureTelemetryStage must mirror DSP::TelemetryStage");
+static_assert(NATURE_TELEMETRY_EVENT_UNDERRUN == static_cast<int>(DSP::TelemetryEvent::Underrun),
+              "NatureTelemetryEvent must mirror DSP::TelemetryEvent");
+
+bool nature_get_stage_telemetry(NatureDSPInstance* instance,
+                                NatureTelemetryStage stage,
+                                NatureStageTelemetry* outStats)
+{
+    if (instance == nullptr || instance->engine == nullptr || outStats == nullptr
+        || stage < NATURE_TELEMETRY_STAGE_BLOCK || stage > NATURE_TELEMETRY_STAGE_BODY)
+    {
+        return false;
+    }
+
+    const DSP::TelemetryStageStats stats =
+        instance->engine->getStageTelemetry(static_cast<DSP::TelemetryStage>(stage));
+    outStats->blocks = stats.blocks;
+    outStats->averageTicks = stats.averageTicks;
+    outStats->maxTicks = stats.maxTicks;
+    outStats->p99Ticks = stats.p99Ticks;
+    outStats->averageLoad = stats.averageLoad;
+    outStats->p99Load = stats.p99Load;
+    outStats->maxLoad = stats.maxLoad;
+    return true;
+}
+
+uint64_t nature_get_telemetry_event_count(NatureDSPInstance* instance, NatureTelemetryEvent event)
+{
+    if (instance == nullptr || instance->engine == nullptr
+        || event < NATURE_TELEMETRY_EVENT_VOICE_STEAL || event > NATURE_TELEMETRY_EVENT_UNDERRUN)
+    {
+        return 0;
+    }
+
+    return instance->engine->getTelemetryEventCount(static_cast<DSP::TelemetryEvent>(event));
+}
+
+double nature_get_telemetry_ticks_per_second(void)
+{
+    return DSP::Telemetry::getTicksPerSecond();
+}
+
+void nature_reset_telemetry(NatureDSPInstance* instance)
+{
+    if (instance != nullptr && instance->engine != nullptr)
+    {
+        instance->engine->resetTelemetry();
+    }
+}
@@ -48,41 +48,61 @@ AetherGiantProcessor::AetherGiantProcessor()
                            .withOutput("Output", juce::AudioChannelSet::stereo(), true))
 {
     // Create initial instrument
-    currentInstrument = createInstrument(instrumentType);
+    currentInstrument = activeInstrument = createInstrument(instrumentType).release();
 
-    // Scan presets folder
+    // Index presets in the background
+    setPresets(presetIndex.getSnapshot());
+    presetIndex.onChanged = [this] { presetIndexChanged(); };
     scanPresetsFolder();
+
+    startTimerHz(RECLAIM_TIMER_HZ);
 }
 
 AetherGiantProcessor::~AetherGiantProcessor()
 {
+    stopTimer();
+
+    // Audio has stopped; the handoff deletes any pending / retired instances
+    delete fadingInstrument;
+    delete activeInstrument;
 }
 
 //==============================================================================
 void AetherGiantProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ScopedLock lock(dspLock);
+    // Audio is stopped here: adopt a pending instrument without a crossfade
+    delete fadingInstrument;
+    fadingInstrument = nullptr;
+    crossfadeRemaining = 0;
+
+    if (auto* next = instrumentHandoff.claim(0))
+    {
+        delete activeInstrument;
+        activeInstrument = next;
+    }
 
-    if (currentInstrument)
+    if (activeInstrument)
     {
-        currentInstrument->prepare(sampleRate, samplesPerBlock);
+        activeInstrument->prepare(sampleRate, samplesPerBlock);
     }
+
+    crossfadeBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
+    crossfadeLength = std::max(1, static_cast<int>(sampleRate * CROSSFADE_SECONDS));
 }
 
 void AetherGiantProcessor::releaseResources()
 {
-    juce::ScopedLock lock(dspLock);
-
-    if (currentInstrument)
+    if (activeInstrument)
     {
-        currentInstrument->reset();
+        activeInstrument->reset();
     }
 }
 
 void AetherGiantProcessor::processBlock(juce::AudioBuffer<float>& buffer,
                                          juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedLock lock(dspLock);
+    // No locks: instrument switches arrive through instrumentHandoff
+    adoptPendingInstrument();
 
     // Get playhead info
     if (auto* playHead = getPlayHead())
@@ -91,25 +111,23 @@ void AetherGiantProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     // Clear output
     buffer.clear();
 
-    if (!currentInstrument)
+    if (!activeInstrument)
         return;
 
     // Process MIDI to events
-    std::vector<DSP::ScheduledEvent> events;
-    processMIDI(midiMessages, events);
-
-    // Handle events
-    for (const auto& event : events)
-    {
-        currentInstrument->handleEvent(event);
-    }
+    processMIDI(midiMessages);
 
-    // Process audio
+    // Process audio, applying each event on its sample
     float* outputs[] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
     int numChannels = buffer.getNumChannels();
     int numSamples = buffer.getNumSamples();
 
-    currentInstrument->process(outputs, numChannels, numSamples);
+    DSP::processWithEvents(*activeInstrument, outputs, numChannels, numSamples,
+                           pendingEvents.data(), pendingEvents.size());
+    pendingEvents.clear();
+
+    if (crossfadeRemaining > 0)
+        renderCrossfade(buffer);
 }
 
 juce::AudioProcessorEditor* AetherGiantProcessor::createEditor()
@@ -122,7 +140,7 @@ juce::AudioProcessorEditor* AetherGiantProcessor::createEditor()
 // Programs (Presets)
 int AetherGiantProcessor::getNumPrograms()
 {
-    return presetNames.size();
+    return static_cast<int>(getPresets()->entries.size());
 }
 
 int AetherGiantProcessor::getCurrentProgram()
@@ -132,17 +150,16 @@ int AetherGiantProcessor::getCurrentProgram()
 
 void AetherGiantProcessor::setCurrentProgram(int index)
 {
-    if (index >= 0 && index < presetNames.size())
-    {
+    pendingProgramName.clear();
+    if (loadPresetContent(index))
         currentProgramIndex = index;
-        loadPresetFromFile(getPresetsFolder().getChildFile(presetNames[index]));
-    }
 }
 
 const juce::String AetherGiantProcessor::getProgramName(int index)
 {
-    if (index >= 0 && index < presetNames.size())
-        return presetNames[index];
+    const auto snapshot = getPresets();
+    if (index >= 0 && index < static_cast<int>(snapshot->entries.size()))
+        return snapshot->entries[static_cast<size_t>(index)].fileName;
     return {};
 }
 
@@ -277,9 +294,9 @@ void AetherGiantProcessor::getStateInformation(juce::MemoryBlock& destData)
     state.setAttribute("mpeEnabled", mpeEnabled);
 
     // Save current preset name if loaded
-    if (currentProgramIndex >= 0 && currentProgramIndex < presetNames.size())
+    if (currentProgramIndex >= 0 && currentProgramIndex < getNumPrograms())
     {
-        state.setAttribute("currentPreset", presetNames[currentProgramIndex]);
+        state.setAttribute("currentPreset", getProgramName(currentProgramIndex));
     }
 
     // Copy to memory block
@@ -314,11 +331,14 @@ void AetherGiantProcessor::setStateInformation(const void* data, int sizeInBytes
 
     // Load preset if specified
     juce::String presetName = state->getStringAttribute("currentPreset", "");
+    pendingProgramName.clear();
     if (!presetName.isEmpty())
     {
-        int presetIndex = presetNames.indexOf(presetName);
+        int presetIndex = presetsMatchInstrument() ? getPresets()->indexOf(presetName) : -1;
         if (presetIndex >= 0)
             setCurrentProgram(presetIndex);
+        else
+            pendingProgramName = presetName;  // Index not ready yet
     }
 }
 
@@ -338,7 +358,7 @@ bool AetherGiantProcessor::loadPresetFromFile(const juce::File& presetFile)
     if (loaded)
     {
         // Update program index
-        currentProgramIndex = presetNames.indexOf(presetFile.getFileName());
+        currentProgramIndex = getPresets()->indexOf(presetFile.getFileName());
     }
 
     return loaded;
@@ -357,6 +377,7 @@ bool AetherGiantProcessor::savePresetToFile(const juce::File& presetFile)
     {
         // Write to file
         presetFile.replaceWithData(buffer.data(), std::strlen(buffer.data()));
+        presetIndex.refresh();
     }
 
     return saved;
@@ -364,8 +385,23 @@ bool AetherGiantProcessor::savePresetToFile(const juce::File& presetFile)
 
 void AetherGiantProcessor::refreshPresetList()
 {
-    scanPresetsFolder();
-    updateHostDisplay();
+    // The host display updates when the rescan lands
+    presetIndex.refresh();
+}
+
+//==============================================================================
+// Parallel Rendering
+void AetherGiantProcessor::enableParallelRendering(int numWorkers)
+{
+    DSP::VoiceRenderPool::Config config;
+    config.numWorkers = numWorkers;
+
+    // Instruments hold the pool from creation and render serially while it
+    // has no workers, so only the workers change here
+    if (numWorkers > 0)
+        renderPool.start(config);
+    else
+        renderPool.stop();
 }
 
 //==============================================================================
@@ -419,7 +455,11 @@ std::unique_ptr<DSP::InstrumentDSP> AetherGiantProcessor::createInstrument(Giant
     switch (type)
     {
         case GiantInstrumentType::GiantStrings:
-            return std::make_unique<DSP::StringPureDSP>();
+        {
+            auto strings = std::make_unique<DSP::StringPureDSP>();
+            strings->setRenderPool(&renderPool);  // Serial until workers are started
+            return strings;
+        }
 
         case GiantInstrumentType::GiantDrums:
             return std::make_unique<DSP::AetherGiantDrumsPureDSP>();
@@ -446,114 +486,104 @@ void AetherGiantProcessor::switchInstrument(GiantInstrumentType newType)
     double sampleRate = getSampleRate();
     int blockSize = getBlockSize();
 
-    // Create new instrument
+    // Create and prepare the new instrument on this thread
     auto newInstrument = createInstrument(newType);
-
-    // Prepare new instrument
     newInstrument->prepare(sampleRate, blockSize);
 
-    // Swap
-    {
-        juce::ScopedLock lock(dspLock);
-        currentInstrument = std::move(newInstrument);
-        instrumentType = newType;
-    }
+    // Publish; the audio thread picks it up at the start of its next block.
+    // A previous switch the audio thread has not claimed yet is dropped here.
+    currentInstrument = newInstrument.get();
+    instrumentType = newType;
+    instrumentHandoff.publish(std::move(newInstrument));
 
     // Rescan presets for new instrument
     scanPresetsFolder();
 }
 
-void AetherGiantProcessor::processMIDI(juce::MidiBuffer& midiMessages,
-                                       std::vector<DSP::ScheduledEvent>& events)
+void AetherGiantProcessor::adoptPendingInstrument()
 {
-    double sampleRate = getSampleRate();
-
-    for (const auto& metadata : midiMessages)
+    // A finished crossfade leaves the outgoing instrument to retire
+    if (fadingInstrument != nullptr && crossfadeRemaining == 0
+        && instrumentHandoff.retire(fadingInstrument))
     {
-        const auto* msg = metadata.getMessage();
-        double timestamp = msg->getTimeStamp();
+        fadingInstrument = nullptr;
+    }
 
-        DSP::ScheduledEvent event;
+    // Reserve a retire slot for the instrument being replaced, plus one for
+    // an outgoing instrument whose crossfade gets cut short
+    auto* next = instrumentHandoff.claim(fadingInstrument != nullptr ? 2 : 1);
+    if (next == nullptr)
+        return;
 
-        // Convert MIDI message to scheduled event
-        if (msg->isNoteOn())
-        {
-            event.type = DSP::ScheduledEventType::NoteOn;
-            event.noteNumber = msg->getNoteNumber();
-            event.velocity = msg->getVelocity() / 127.0f;
+    if (fadingInstrument != nullptr)
+        instrumentHandoff.retire(fadingInstrument);
 
-            // Add MPE data if enabled
-            if (mpeEnabled)
-            {
-                // MPE data will be extracted from subsequent messages
-                // and applied to the voice
-            }
+    fadingInstrument = activeInstrument;
+    activeInstrument = next;
+    crossfadeRemaining = fadingInstrument != nullptr ? crossfadeLength : 0;
+}
 
-            event.timestamp = timestamp;
-            events.push_back(event);
-        }
-        else if (msg->isNoteOff())
-        {
-            event.type = DSP::ScheduledEventType::NoteOff;
-            event.noteNumber = msg->getNoteNumber();
-            event.velocity = 0.0f;
-            event.timestamp = timestamp;
-            events.push_back(event);
-        }
-        else if (msg->isAllNotesOff())
-        {
-            event.type = DSP::ScheduledEventType::AllNotesOff;
-            event.timestamp = timestamp;
-            events.push_back(event);
-        }
-        else if (msg->isPitchBend())
+void AetherGiantProcessor::renderCrossfade(juce::AudioBuffer<float>& buffer)
+{
+    const int numChannels = std::min({ buffer.getNumChannels(), crossfadeBuffer.getNumChannels(), 2 });
+    const int fadeSamples = std::min(buffer.getNumSamples(), crossfadeRemaining);
+    const int chunkSize = crossfadeBuffer.getNumSamples();
+
+    if (numChannels == 0 || chunkSize == 0)
+    {
+        crossfadeRemaining = 0;
+        return;
+    }
+
+    const float step = 1.0f / static_cast<float>(crossfadeLength);
+
+    // Render the outgoing instrument only over the remaining fade and mix
+    // it under the new one with a linear ramp
+    for (int offset = 0; offset < fadeSamples; offset += chunkSize)
+    {
+        const int n = std::min(chunkSize, fadeSamples - offset);
+        float* fadeOutputs[2] = { crossfadeBuffer.getWritePointer(0),
+                                  numChannels > 1 ? crossfadeBuffer.getWritePointer(1) : nullptr };
+        crossfadeBuffer.clear(0, n);
+        fadingInstrument->process(fadeOutputs, numChannels, n);
+
+        for (int ch = 0; ch < numChannels; ++ch)
         {
-            // Pitch bend can be used for MPE or regular pitch bend
-            if (mpeEnabled)
-            {
-                // MPE pitch bend is per-note, will be applied to active voices
-            }
-            else
+            float* out = buffer.getWritePointer(ch, offset);
+            const float* old = crossfadeBuffer.getReadPointer(ch);
+            float newGain = 1.0f - static_cast<float>(crossfadeRemaining) * step;
+
+            for (int i = 0; i < n; ++i)
             {
-                // Global pitch bend
-                // Apply to all active notes (future implementation)
+                out[i] = out[i] * newGain + old[i] * (1.0f - newGain);
+                newGain += step;
             }
         }
-        else if (msg->isChannelPressure())
-        {
-            // Channel pressure (mono-aftertouch)
-            // Can be used for MPE or regular aftertouch
-        }
-        else if (msg->isControllerOfType(0x74))  // Timbre (CC 74)
-        {
-            // MPE timbre expression
-        }
+
+        crossfadeRemaining -= n;
     }
 }
 
-void AetherGiantProcessor::midiMessageToEvent(const juce::MidiMessage& msg,
-                                               DSP::ScheduledEvent& event,
-                                               double sampleRate)
+void AetherGiantProcessor::timerCallback()
 {
-    // Convert specific MIDI messages to scheduled events
-    if (msg->isNoteOn())
-    {
-        event.type = DSP::ScheduledEventType::NoteOn;
-        event.noteNumber = msg->getNoteNumber();
-        event.velocity = msg->getVelocity() / 127.0f;
-        event.timestamp = msg->getTimeStamp();
-    }
-    else if (msg->isNoteOff())
-    {
-        event.type = DSP::ScheduledEventType::NoteOff;
-        event.noteNumber = msg->getNoteNumber();
-        event.velocity = 0.0f;
-        event.timestamp = msg->getTimeStamp();
-    }
-    else if (msg->isAllNotesOff())
+    instrumentHandoff.collect();
+}
+
+void AetherGiantProcessor::processMIDI(const juce::MidiBuffer& midiMessages)
+{
+    pendingEvents.clear();
+
+    // MPE zones are not split out yet: per-channel pitch bend and pressure
+    // arrive as ordinary events
+    for (const auto metadata : midiMessages)
     {
-        event.type = DSP::ScheduledEventType::AllNotesOff;
-        event.timestamp = msg->getTimeStamp();
+        DSP::ScheduledEvent event;
+        if (!DSP::toScheduledEvent(metadata.data, metadata.numBytes,
+                                   static_cast<uint32_t>(metadata.samplePosition), event))
+            continue;
+
+        // Queue full: apply the queued events now, in order, then queue this one
+        pendingEvents.pushOrFlush(event, *activeInstrument);
     }
 }
 
@@ -588,28 +618,77 @@ juce::File AetherGiantProcessor::getPresetsFolder() const
     }
 }
 
+juce::File AetherGiantProcessor::getPresetManifestFile() const
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+        .getChildFile("AetherGiant/cache")
+        .getChildFile(getPresetsFolder().getFileName() + ".presetindex");
+}
+
 void AetherGiantProcessor::scanPresetsFolder()
 {
-    presetsFolder = getPresetsFolder();
-    presetNames.clear();
+    // Returns at once; presetIndexChanged() runs when the scan lands
+    presetIndex.setFolder(getPresetsFolder(),
+                          juce::String(static_cast<int>(instrumentType)),
+                          getPresetManifestFile());
+}
 
-    if (!presetsFolder.exists())
-        return;
+void AetherGiantProcessor::presetIndexChanged()
+{
+    const juce::String currentName = getProgramName(currentProgramIndex);
+    setPresets(presetIndex.getSnapshot());
+    const auto snapshot = getPresets();
 
-    // Find all JSON files in presets folder
-    juce::Array<juce::File> presetFiles;
-    presetsFolder.findChildFiles(presetFiles, false, "*.json");
+    if (pendingProgramName.isNotEmpty() && presetsMatchInstrument())
+    {
+        const int index = snapshot->indexOf(pendingProgramName);
+        if (index >= 0)
+        {
+            pendingProgramName.clear();
+            setCurrentProgram(index);
+        }
+    }
+    else
+    {
+        // Keep pointing at the same preset if the list shifted
+        currentProgramIndex = std::max(0, snapshot->indexOf(currentName));
+    }
 
-    // Sort alphabetically
-    presetFiles.sort();
+    updateHostDisplay();
+}
 
-    // Extract file names
-    for (const auto& file : presetFiles)
+std::shared_ptr<const PresetIndex::Snapshot> AetherGiantProcessor::getPresets() const
+{
+    const juce::ScopedLock scopedLock(presetsLock);
+    return presets;
+}
+
+void AetherGiantProcessor::setPresets(std::shared_ptr<const PresetIndex::Snapshot> next)
+{
+    // The old snapshot is released outside the lock
     {
-        presetNames.add(file.getFileName());
+        const juce::ScopedLock scopedLock(presetsLock);
+        std::swap(presets, next);
     }
 }
 
+bool AetherGiantProcessor::presetsMatchInstrument() const
+{
+    return getPresets()->instrument == juce::String(static_cast<int>(instrumentType));
+}
+
+bool AetherGiantProcessor::loadPresetContent(int index)
+{
+    // One snapshot for the bounds check and the read
+    const auto snapshot = getPresets();
+    if (index < 0 || index >= static_cast<int>(snapshot->entries.size()) || currentInstrument == nullptr)
+        return false;
+
+    // Preloaded by the index: no file access here
+    const auto& entry = snapshot->entries[static_cast<size_t>(index)];
+    return currentInstrument->loadPreset(entry.content.toRawUTF8());
+}
+
 //==============================================================================
 // This creates new instances of the plugin
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -64,21 +64,16 @@ void NaturePluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     buffer.clear();
 
     // Process MIDI to events
-    std::vector<DSP::ScheduledEvent> events;
-    processMIDI(midiMessages, events);
+    processMIDI(midiMessages);
 
-    // Handle events
-    for (const auto& event : events)
-    {
-        dsp_.handleEvent(event);
-    }
-
-    // Process audio
+    // Process audio, applying each event on its sample
     float* outputs[] = { buffer.getWritePointer(0), buffer.getWritePointer(1) };
     int numChannels = buffer.getNumChannels();
     int numSamples = buffer.getNumSamples();
 
-    dsp_.process(outputs, numChannels, numSamples);
+    DSP::processWithEvents(dsp_, outputs, numChannels, numSamples,
+                           pendingEvents.data(), pendingEvents.size());
+    pendingEvents.clear();
 }
 
 juce::AudioProcessorEditor* NaturePluginProcessor::createEditor()
@@ -229,50 +224,19 @@ bool NaturePluginProcessor::isOutputChannelStereoPair(int index) const
 // Private Methods
 //==============================================================================
 
-void NaturePluginProcessor::processMIDI(juce::MidiBuffer& midiMessages,
-                                          std::vector<DSP::ScheduledEvent>& events)
+void NaturePluginProcessor::processMIDI(const juce::MidiBuffer& midiMessages)
 {
-    for (const auto& metadata : midiMessages)
-    {
-        const auto& msg = metadata.getMessage();
-        double timestamp = msg.getTimeStamp();
+    pendingEvents.clear();
 
+    for (const auto metadata : midiMessages)
+    {
         DSP::ScheduledEvent event;
-        event.time = timestamp;
-        event.sampleOffset = 0;
+        if (!DSP::toScheduledEvent(metadata.data, metadata.numBytes,
+                                   static_cast<uint32_t>(metadata.samplePosition), event))
+            continue;
 
-        // Convert MIDI message to scheduled event
-        if (msg.isNoteOn())
-        {
-            event.type = DSP::ScheduledEvent::NOTE_ON;
-            event.data.note.midiNote = msg.getNoteNumber();
-            event.data.note.velocity = msg.getVelocity() / 127.0f;
-            events.push_back(event);
-        }
-        else if (msg.isNoteOff())
-        {
-            event.type = DSP::ScheduledEvent::NOTE_OFF;
-            event.data.note.midiNote = msg.getNoteNumber();
-            event.data.note.velocity = 0.0f;
-            events.push_back(event);
-        }
-        else if (msg.isAllNotesOff() || msg.isResetAllControllers())
-        {
-            event.type = DSP::ScheduledEvent::RESET;
-            events.push_back(event);
-        }
-        else if (msg.isPitchWheel())
-        {
-            event.type = DSP::ScheduledEvent::PITCH_BEND;
-            event.data.pitchBend.bendValue = msg.getPitchWheelValue() / 8192.0f - 1.0f;
-            events.push_back(event);
-        }
-        else if (msg.isChannelPressure())
-        {
-            event.type = DSP::ScheduledEvent::CHANNEL_PRESSURE;
-            event.data.channelPressure.pressure = msg.getChannelPressureValue() / 127.0f;
-            events.push_back(event);
-        }
+        // Queue full: apply the queued events now, in order, then queue this one
+        pendingEvents.pushOrFlush(event, dsp_);
     }
 }
 
@@ -0,0 +1,309 @@
+/*
+  ==============================================================================
+
+   PresetIndex.cpp
+   Implementation of the background preset index
+
+  ==============================================================================
+*/
+
+#include "plugin/PresetIndex.h"
+#include <juce_data_structures/juce_data_structures.h>
+#include <algorithm>
+#include <map>
+
+namespace
+{
+    constexpr int MANIFEST_VERSION = 1;
+
+    const juce::Identifier manifestType("PresetManifest");
+    const juce::Identifier presetType("Preset");
+    const juce::Identifier versionId("version");
+    const juce::Identifier instrumentId("instrument");
+    const juce::Identifier fileNameId("fileName");
+    const juce::Identifier modificationTimeId("mtime");
+    const juce::Identifier sizeId("size");
+    const juce::Identifier contentId("content");
+
+    // Snapshots indexed by this process, keyed by folder path
+    struct ProcessCache
+    {
+        juce::CriticalSection lock;
+        std::map<juce::String, std::shared_ptr<const PresetIndexSnapshot>> snapshots;
+    };
+
+    ProcessCache& processCache()
+    {
+        static ProcessCache cache;
+        return cache;
+    }
+
+    bool sameSnapshot(const PresetIndexSnapshot& a, const PresetIndexSnapshot& b)
+    {
+        if (a.instrument != b.instrument || a.entries.size() != b.entries.size())
+            return false;
+
+        for (size_t i = 0; i < a.entries.size(); ++i)
+        {
+            if (a.entries[i].fileName != b.entries[i].fileName
+                || a.entries[i].modificationTime != b.entries[i].modificationTime
+                || a.entries[i].size != b.entries[i].size)
+                return false;
+        }
+        return true;
+    }
+}
+
+//==============================================================================
+// PresetIndexSnapshot
+//==============================================================================
+
+int PresetIndexSnapshot::indexOf(const juce::String& fileName) const
+{
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (entries[i].fileName == fileName)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//==============================================================================
+// PresetIndex
+//==============================================================================
+
+PresetIndex::PresetIndex()
+    : juce::Thread("Preset Index"),
+      snapshot(std::make_shared<const Snapshot>())
+{
+    startThread(juce::Thread::Priority::background);
+}
+
+PresetIndex::~PresetIndex()
+{
+    cancelPendingUpdate();
+    signalThreadShouldExit();
+    notify();
+    stopThread(5000);
+}
+
+void PresetIndex::setFolder(const juce::File& folder, const juce::String& instrument,
+                            const juce::File& manifestFile)
+{
+    std::shared_ptr<const Snapshot> cached;
+    {
+        const juce::ScopedLock cacheLock(processCache().lock);
+        auto it = processCache().snapshots.find(folder.getFullPathName());
+        if (it != processCache().snapshots.end() && it->second->instrument == instrument)
+            cached = it->second;
+    }
+
+    {
+        const juce::ScopedLock scopedLock(lock);
+        request = { folder, instrument, manifestFile };
+        requestPending = true;
+    }
+
+    // Another instance indexed this folder: usable right away, still revalidated
+    if (cached != nullptr)
+        publish(cached);
+
+    notify();
+}
+
+void PresetIndex::refresh()
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+        if (request.folder == juce::File())
+            return;
+        requestPending = true;
+    }
+    notify();
+}
+
+std::shared_ptr<const PresetIndex::Snapshot> PresetIndex::getSnapshot() const
+{
+    const juce::ScopedLock scopedLock(lock);
+    return snapshot;
+}
+
+void PresetIndex::publish(std::shared_ptr<const Snapshot> next)
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+        if (snapshot != nullptr && sameSnapshot(*snapshot, *next))
+        {
+            snapshot = std::move(next);
+            return;  // Same presets: nothing for the host to redisplay
+        }
+        snapshot = std::move(next);
+    }
+    triggerAsyncUpdate();
+}
+
+void PresetIndex::handleAsyncUpdate()
+{
+    if (onChanged)
+        onChanged();
+}
+
+void PresetIndex::run()
+{
+    while (!threadShouldExit())
+    {
+        Request current;
+        std::shared_ptr<const Snapshot> previous;
+        {
+            const juce::ScopedLock scopedLock(lock);
+            if (requestPending)
+            {
+                current = request;
+                previous = snapshot;
+                requestPending = false;
+            }
+        }
+
+        if (current.folder == juce::File())
+        {
+            wait(-1);
+            continue;
+        }
+
+        // Entries of another instrument can't be reused
+        if (previous != nullptr && previous->instrument != current.instrument)
+            previous = nullptr;
+
+        // First scan of this folder in this session: start from the manifest
+        if (previous == nullptr || previous->entries.empty())
+            previous = readManifest(current.manifestFile, current.instrument);
+
+        auto next = scan(current, previous);
+        if (next == nullptr)
+            continue;  // Stopping
+
+        {
+            const juce::ScopedLock cacheLock(processCache().lock);
+            processCache().snapshots[current.folder.getFullPathName()] = next;
+        }
+
+        if (previous == nullptr || !sameSnapshot(*previous, *next))
+            writeManifest(current.manifestFile, *next);
+
+        // Drop the result if the folder changed while scanning
+        {
+            const juce::ScopedLock scopedLock(lock);
+            if (request.folder != current.folder || request.instrument != current.instrument)
+                continue;
+        }
+        publish(std::move(next));
+    }
+}
+
+std::shared_ptr<const PresetIndex::Snapshot> PresetIndex::scan(const Request& current,
+                                                               const std::shared_ptr<const Snapshot>& previous)
+{
+    auto next = std::make_shared<Snapshot>();
+    next->instrument = current.instrument;
+
+    if (!current.folder.isDirectory())
+        return next;
+
+    juce::Array<juce::File> files;
+    current.folder.findChildFiles(files, juce::File::findFiles, false, "*.json");
+    files.sort();
+    next->entries.reserve(static_cast<size_t>(files.size()));
+
+    for (const auto& file : files)
+    {
+        if (threadShouldExit())
+            return nullptr;
+
+        Snapshot::Entry entry;
+        entry.fileName = file.getFileName();
+        entry.modificationTime = file.getLastModificationTime().toMilliseconds();
+        entry.size = file.getSize();
+
+        // Unchanged since it was last indexed: reuse the loaded text
+        const int cachedIndex = previous != nullptr ? previous->indexOf(entry.fileName) : -1;
+        if (cachedIndex >= 0)
+        {
+            const auto& cached = previous->entries[static_cast<size_t>(cachedIndex)];
+            if (cached.modificationTime == entry.modificationTime && cached.size == entry.size)
+            {
+                entry.content = cached.content;
+                next->entries.push_back(std::move(entry));
+                continue;
+            }
+        }
+
+        entry.content = file.loadFileAsString();
+        next->entries.push_back(std::move(entry));
+    }
+
+    return next;
+}
+
+std::shared_ptr<const PresetIndex::Snapshot> PresetIndex::readManifest(const juce::File& manifestFile,
+                                                                       const juce::String& instrument)
+{
+    if (!manifestFile.existsAsFile())
+        return nullptr;
+
+    juce::FileInputStream stream(manifestFile);
+    if (!stream.openedOk())
+        return nullptr;
+
+    auto tree = juce::ValueTree::readFromStream(stream);
+    if (!tree.hasType(manifestType)
+        || static_cast<int>(tree.getProperty(versionId)) != MANIFEST_VERSION
+        || tree.getProperty(instrumentId).toString() != instrument)
+        return nullptr;
+
+    auto manifest = std::make_shared<Snapshot>();
+    manifest->instrument = instrument;
+    manifest->entries.reserve(static_cast<size_t>(tree.getNumChildren()));
+
+    for (const auto& child : tree)
+    {
+        Snapshot::Entry entry;
+        entry.fileName = child.getProperty(fileNameId).toString();
+        entry.modificationTime = static_cast<juce::int64>(child.getProperty(modificationTimeId));
+        entry.size = static_cast<juce::int64>(child.getProperty(sizeId));
+        entry.content = child.getProperty(contentId).toString();
+        manifest->entries.push_back(std::move(entry));
+    }
+
+    return manifest;
+}
+
+void PresetIndex::writeManifest(const juce::File& manifestFile, const Snapshot& manifest)
+{
+    if (manifestFile == juce::File())
+        return;
+
+    juce::ValueTree tree(manifestType);
+    tree.setProperty(versionId, MANIFEST_VERSION, nullptr);
+    tree.setProperty(instrumentId, manifest.instrument, nullptr);
+
+    for (const auto& entry : manifest.entries)
+    {
+        juce::ValueTree child(presetType);
+        child.setProperty(fileNameId, entry.fileName, nullptr);
+        child.setProperty(modificationTimeId, entry.modificationTime, nullptr);
+        child.setProperty(sizeId, entry.size, nullptr);
+        child.setProperty(contentId, entry.content, nullptr);
+        tree.appendChild(child, nullptr);
+    }
+
+    // Write beside the manifest and swap in, so a reader never sees half a file
+    manifestFile.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(manifestFile);
+    {
+        juce::FileOutputStream stream(temp.getFile());
+        if (!stream.openedOk())
+            return;
+        tree.writeToStream(stream);
+    }
+    temp.overwriteTargetFileWithTemporary();
+}
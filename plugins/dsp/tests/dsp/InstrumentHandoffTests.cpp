@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    InstrumentHandoffTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the engine instance handoff (InstrumentHandoff.h)
+    - publish -> claim -> retire -> collect lifecycle
+    - An unclaimed pending instance is replaced and deleted
+    - claim() refuses while too few retire slots are free
+    - The destructor deletes the pending and retired instances
+    - Concurrent publish / claim never leaks or double-deletes
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../include/dsp/InstrumentHandoff.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace {
+
+std::atomic<int> liveInstances{0};
+
+struct TrackedEngine
+{
+    explicit TrackedEngine(int id) : id(id) { liveInstances.fetch_add(1); }
+    ~TrackedEngine() { liveInstances.fetch_sub(1); }
+
+    int id;
+};
+
+using Handoff = DSP::InstrumentHandoff<TrackedEngine, 2>;
+
+} // namespace
+
+//==============================================================================
+// Test Fixture
+class InstrumentHandoffTests : public ::testing::Test
+{
+protected:
+    void SetUp() override { liveInstances.store(0); }
+    void TearDown() override { EXPECT_EQ(liveInstances.load(), 0) << "Every instance must be deleted exactly once"; }
+};
+
+//==============================================================================
+// TEST: Lifecycle
+//==============================================================================
+
+TEST_F(InstrumentHandoffTests, Claim_ReturnsNullWithoutPending)
+{
+    Handoff handoff;
+    EXPECT_FALSE(handoff.hasPending());
+    EXPECT_EQ(handoff.claim(1), nullptr);
+}
+
+TEST_F(InstrumentHandoffTests, Lifecycle_PublishClaimRetireCollect)
+{
+    Handoff handoff;
+    handoff.publish(std::make_unique<TrackedEngine>(1));
+    EXPECT_TRUE(handoff.hasPending());
+
+    std::unique_ptr<TrackedEngine> active(handoff.claim(1));
+    ASSERT_NE(active, nullptr);
+    EXPECT_EQ(active->id, 1);
+    EXPECT_FALSE(handoff.hasPending());
+
+    // Swap to a second engine; the first is retired, not deleted
+    handoff.publish(std::make_unique<TrackedEngine>(2));
+    TrackedEngine* next = handoff.claim(1);
+    ASSERT_NE(next, nullptr);
+    EXPECT_TRUE(handoff.retire(active.release()));
+    active.reset(next);
+    EXPECT_EQ(liveInstances.load(), 2);
+
+    EXPECT_EQ(handoff.collect(), 1);
+    EXPECT_EQ(liveInstances.load(), 1);
+    EXPECT_EQ(handoff.collect(), 0);
+}
+
+TEST_F(InstrumentHandoffTests, Publish_ReplacesAndDeletesUnclaimedInstance)
+{
+    Handoff handoff;
+    handoff.publish(std::make_unique<TrackedEngine>(1));
+    handoff.publish(std::make_unique<TrackedEngine>(2));
+    EXPECT_EQ(liveInstances.load(), 1);
+
+    std::unique_ptr<TrackedEngine> active(handoff.claim(0));
+    ASSERT_NE(active, nullptr);
+    EXPECT_EQ(active->id, 2);
+}
+
+TEST_F(InstrumentHandoffTests, Retire_NullIsANoOp)
+{
+    Handoff handoff;
+    EXPECT_TRUE(handoff.retire(nullptr));
+    EXPECT_EQ(handoff.collect(), 0);
+}
+
+//==============================================================================
+// TEST: Retire Slots
+//==============================================================================
+
+TEST_F(InstrumentHandoffTests, Claim_RefusesWhileRetireSlotsAreFull)
+{
+    Handoff handoff;
+    ASSERT_TRUE(handoff.retire(new TrackedEngine(1)));
+
+    handoff.publish(std::make_unique<TrackedEngine>(2));
+    EXPECT_EQ(handoff.claim(2), nullptr) << "One slot free, two requested";
+    EXPECT_TRUE(handoff.hasPending()) << "A refused claim leaves the instance pending";
+
+    ASSERT_TRUE(handoff.retire(new TrackedEngine(3)));
+    EXPECT_EQ(handoff.claim(1), nullptr);
+
+    // Every slot taken: retire() refuses and the caller still owns the instance
+    std::unique_ptr<TrackedEngine> extra = std::make_unique<TrackedEngine>(4);
+    EXPECT_FALSE(handoff.retire(extra.get()));
+}
+
+TEST_F(InstrumentHandoffTests, Claim_SucceedsAfterCollect)
+{
+    Handoff handoff;
+    ASSERT_TRUE(handoff.retire(new TrackedEngine(1)));
+    ASSERT_TRUE(handoff.retire(new TrackedEngine(2)));
+    handoff.publish(std::make_unique<TrackedEngine>(3));
+    EXPECT_EQ(handoff.claim(1), nullptr);
+
+    EXPECT_EQ(handoff.collect(), 2);
+    std::unique_ptr<TrackedEngine> active(handoff.claim(2));
+    ASSERT_NE(active, nullptr);
+    EXPECT_EQ(active->id, 3);
+}
+
+//==============================================================================
+// TEST: Destruction
+//==============================================================================
+
+TEST_F(InstrumentHandoffTests, Destructor_DeletesPendingAndRetired)
+{
+    {
+        Handoff handoff;
+        ASSERT_TRUE(handoff.retire(new TrackedEngine(1)));
+        handoff.publish(std::make_unique<TrackedEngine>(2));
+        EXPECT_EQ(liveInstances.load(), 2);
+    }
+    EXPECT_EQ(liveInstances.load(), 0);
+}
+
+//==============================================================================
+// TEST: Concurrency
+//==============================================================================
+
+TEST_F(InstrumentHandoffTests, Concurrent_PublishAndClaimDeleteEveryInstance)
+{
+    constexpr int NUM_PUBLISHES = 20000;
+
+    DSP::InstrumentHandoff<TrackedEngine, 8> handoff;
+    std::atomic<bool> done{false};
+    TrackedEngine* active = nullptr;
+    int swaps = 0;
+
+    // Audio thread: adopt whatever is pending, retire the previous instance
+    std::thread audio([&]
+    {
+        while (!done.load(std::memory_order_acquire) || handoff.hasPending())
+        {
+            if (TrackedEngine* next = handoff.claim(1))
+            {
+                EXPECT_TRUE(handoff.retire(active));
+                active = next;
+                ++swaps;
+            }
+        }
+    });
+
+    for (int i = 0; i < NUM_PUBLISHES; ++i)
+    {
+        handoff.publish(std::make_unique<TrackedEngine>(i));
+        handoff.collect();
+    }
+    done.store(true, std::memory_order_release);
+    audio.join();
+
+    EXPECT_GT(swaps, 0);
+    handoff.collect();
+    EXPECT_EQ(liveInstances.load(), 1) << "Only the active instance survives collect()";
+    delete active;
+}
@@ -0,0 +1,182 @@
+/*
+  ==============================================================================
+
+    MidiFileTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the nature-render Standard MIDI File reader (tools/render)
+    - Tick -> seconds with the default tempo, tempo changes and SMPTE
+    - Running status, multi-track merge order
+    - Rejection of malformed headers, divisions and tracks
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../tools/render/MidiFile.h"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+void append(Bytes& out, std::initializer_list<uint8_t> bytes)
+{
+    out.insert(out.end(), bytes);
+}
+
+void appendBigEndian(Bytes& out, uint32_t value, int numBytes)
+{
+    for (int i = numBytes - 1; i >= 0; --i)
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+Bytes track(const Bytes& events)
+{
+    Bytes out = { 'M', 'T', 'r', 'k' };
+    appendBigEndian(out, static_cast<uint32_t>(events.size()), 4);
+    out.insert(out.end(), events.begin(), events.end());
+    return out;
+}
+
+Bytes midiFile(uint16_t format, uint16_t division, const std::vector<Bytes>& tracks)
+{
+    Bytes out = { 'M', 'T', 'h', 'd', 0, 0, 0, 6 };
+    appendBigEndian(out, format, 2);
+    appendBigEndian(out, static_cast<uint32_t>(tracks.size()), 2);
+    appendBigEndian(out, division, 2);
+    for (const auto& t : tracks)
+        out.insert(out.end(), t.begin(), t.end());
+    return out;
+}
+
+// Note on at tick 0, note off (running status, velocity 0) at tick 480
+Bytes oneNoteTrack()
+{
+    Bytes events;
+    append(events, { 0x00, 0x90, 60, 100 });
+    append(events, { 0x83, 0x60, 60, 0 });      // delta 480
+    append(events, { 0x00, 0xFF, 0x2F, 0x00 });  // end of track
+    return track(events);
+}
+
+bool parse(const Bytes& bytes, DSP::Render::MidiFile& file, std::string& error)
+{
+    return file.parse(bytes.data(), bytes.size(), error);
+}
+
+} // namespace
+
+//==============================================================================
+// TEST: Timing
+//==============================================================================
+
+TEST(MidiFileTests, Parse_DefaultTempoIs120Bpm)
+{
+    DSP::Render::MidiFile file;
+    std::string error;
+    ASSERT_TRUE(parse(midiFile(0, 480, { oneNoteTrack() }), file, error)) << error;
+
+    ASSERT_EQ(file.events.size(), 2u);
+    EXPECT_DOUBLE_EQ(file.events[0].seconds, 0.0);
+    EXPECT_EQ(file.events[0].data[0], 0x90);
+    EXPECT_EQ(file.events[1].data[0], 0x90) << "Running status keeps the status byte";
+    EXPECT_EQ(file.events[1].data[2], 0);
+    EXPECT_DOUBLE_EQ(file.events[1].seconds, 0.5);
+    EXPECT_DOUBLE_EQ(file.lengthSeconds, 0.5);
+}
+
+TEST(MidiFileTests, Parse_AppliesTempoChanges)
+{
+    Bytes events;
+    append(events, { 0x00, 0xFF, 0x51, 0x03, 0x0F, 0x42, 0x40 });  // 1,000,000 us per quarter (60 BPM)
+    append(events, { 0x00, 0x90, 60, 100 });
+    append(events, { 0x83, 0x60, 0x80, 60, 0 });                   // delta 480
+    append(events, { 0x00, 0xFF, 0x2F, 0x00 });
+
+    DSP::Render::MidiFile file;
+    std::string error;
+    ASSERT_TRUE(parse(midiFile(0, 480, { track(events) }), file, error)) << error;
+
+    ASSERT_EQ(file.events.size(), 2u);
+    EXPECT_DOUBLE_EQ(file.events[1].seconds, 1.0);
+    EXPECT_EQ(file.events[1].data[0], 0x80);
+}
+
+TEST(MidiFileTests, Parse_SmpteDivision)
+{
+    // 25 fps, 40 ticks per frame: 1000 ticks per second
+    const uint16_t division = static_cast<uint16_t>((static_cast<uint8_t>(-25) << 8) | 40);
+
+    DSP::Render::MidiFile file;
+    std::string error;
+    ASSERT_TRUE(parse(midiFile(0, division, { oneNoteTrack() }), file, error)) << error;
+
+    ASSERT_EQ(file.events.size(), 2u);
+    EXPECT_DOUBLE_EQ(file.events[1].seconds, 0.48);
+}
+
+TEST(MidiFileTests, Parse_MergesTracksInTimeOrder)
+{
+    Bytes late;
+    append(late, { 0x83, 0x60, 0x91, 64, 90 });  // tick 480, channel 2
+    append(late, { 0x00, 0xFF, 0x2F, 0x00 });
+
+    DSP::Render::MidiFile file;
+    std::string error;
+    ASSERT_TRUE(parse(midiFile(1, 480, { track(late), oneNoteTrack() }), file, error)) << error;
+
+    ASSERT_EQ(file.events.size(), 3u);
+    EXPECT_EQ(file.events[0].data[1], 60);
+    EXPECT_EQ(file.events[1].data[0], 0x91) << "Simultaneous events keep file order";
+    EXPECT_EQ(file.events[2].data[1], 60);
+}
+
+//==============================================================================
+// TEST: Rejection
+//==============================================================================
+
+TEST(MidiFileTests, Parse_RejectsZeroSmpteTicksPerFrame)
+{
+    const uint16_t division = static_cast<uint16_t>(static_cast<uint8_t>(-30) << 8);
+
+    DSP::Render::MidiFile file;
+    std::string error;
+    EXPECT_FALSE(parse(midiFile(0, division, { oneNoteTrack() }), file, error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(file.events.empty());
+}
+
+TEST(MidiFileTests, Parse_RejectsBadHeaders)
+{
+    DSP::Render::MidiFile file;
+    std::string error;
+
+    Bytes notMidi = midiFile(0, 480, { oneNoteTrack() });
+    notMidi[0] = 'X';
+    EXPECT_FALSE(parse(notMidi, file, error));
+
+    EXPECT_FALSE(parse(midiFile(2, 480, { oneNoteTrack() }), file, error));
+    EXPECT_FALSE(parse(midiFile(0, 0, { oneNoteTrack() }), file, error));
+
+    const Bytes tooShort = { 'M', 'T', 'h', 'd', 0, 0 };
+    EXPECT_FALSE(parse(tooShort, file, error));
+}
+
+TEST(MidiFileTests, Parse_RejectsTruncatedTracks)
+{
+    DSP::Render::MidiFile file;
+    std::string error;
+
+    Bytes truncated = midiFile(0, 480, { oneNoteTrack() });
+    truncated.resize(truncated.size() - 3);
+    EXPECT_FALSE(parse(truncated, file, error));
+
+    Bytes noStatus;
+    append(noStatus, { 0x00, 60, 100 });  // data byte with no running status
+    EXPECT_FALSE(parse(midiFile(0, 480, { track(noStatus) }), file, error));
+}
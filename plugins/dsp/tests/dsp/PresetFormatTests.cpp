@@ -0,0 +1,257 @@
+/*
+  ==============================================================================
+
+    PresetFormatTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for compiled presets (PresetFormat.h)
+    - One-pass JSON scanner and number table
+    - JSON compile against a ParameterRegistry
+    - Binary round-trip and rejection of damaged or foreign data
+    - Kane Marco: binary and UPFS presets are staged for the next block
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../include/dsp/PresetFormat.h"
+#include "../../include/dsp/KaneMarcoPureDSP.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr DSP::ParameterRegistry<3> TEST_REGISTRY{{{ "gain", "cutoff", "mix" }}};
+constexpr DSP::ParameterRegistry<3> REORDERED_REGISTRY{{{ "cutoff", "gain", "mix" }}};
+
+using TestPreset = DSP::PresetBlock<3>;
+
+std::vector<uint8_t> encode(const TestPreset& preset, uint32_t layoutHash)
+{
+    std::vector<uint8_t> bytes(preset.binarySize());
+    EXPECT_EQ(preset.writeBinary(bytes.data(), bytes.size(), layoutHash), bytes.size());
+    return bytes;
+}
+
+TestPreset makePreset()
+{
+    TestPreset preset;
+    preset.set(0, 0.25f);
+    preset.set(2, 0.75f);
+    return preset;
+}
+
+} // namespace
+
+//==============================================================================
+// TEST: JSON Scanner
+//==============================================================================
+
+TEST(PresetFormatTests, Scanner_ReportsNumbersAndBooleansInOrder)
+{
+    const char* json = R"({"name":"a, b","gain" : -1.5e-1,"on":true,"off":false,"none":null,)"
+                       R"("list":[1,2],"parameters":{"cutoff":440,"nested":{"q":0.7}}})";
+
+    struct Member { std::string key; double value; bool inParameters; };
+    std::vector<Member> members;
+    EXPECT_TRUE(DSP::JsonNumberScanner::scan(json, [&](const char* key, int length, double value, bool inParameters) {
+        members.push_back({ std::string(key, static_cast<size_t>(length)), value, inParameters });
+    }));
+
+    // Strings, null and array elements (no key) are skipped
+    ASSERT_EQ(members.size(), 5u);
+    EXPECT_EQ(members[0].key, "gain");
+    EXPECT_DOUBLE_EQ(members[0].value, -0.15);
+    EXPECT_EQ(members[1].key, "on");
+    EXPECT_DOUBLE_EQ(members[1].value, 1.0);
+    EXPECT_EQ(members[2].key, "off");
+    EXPECT_FALSE(members[2].inParameters);
+    EXPECT_EQ(members[3].key, "cutoff");
+    EXPECT_TRUE(members[3].inParameters);
+    EXPECT_EQ(members[4].key, "q");
+    EXPECT_TRUE(members[4].inParameters) << "Nested objects inherit the parameters scope";
+}
+
+TEST(PresetFormatTests, Scanner_RejectsMalformedInput)
+{
+    auto ignore = [](const char*, int, double, bool) {};
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(nullptr, ignore));
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(R"({"gain": 1)", ignore));
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(R"({"gain": 1}})", ignore));
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(R"({"name": "unterminated})", ignore));
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(R"({"gain": oops})", ignore));
+
+    std::string deep(DSP::JsonNumberScanner::MAX_DEPTH + 1, '[');
+    deep.append(DSP::JsonNumberScanner::MAX_DEPTH + 1, ']');
+    EXPECT_FALSE(DSP::JsonNumberScanner::scan(deep.c_str(), ignore));
+}
+
+TEST(PresetFormatTests, NumberTable_ParametersObjectHidesTopLevelKeys)
+{
+    const char* json = R"({"gain": 0.1, "mix": 0.2, "parameters": {"gain": 0.9}})";
+    DSP::JsonNumberTable<8> table(json);
+    ASSERT_TRUE(table.isValid());
+
+    double value = 0.0;
+    ASSERT_TRUE(table.find("gain", value));
+    EXPECT_DOUBLE_EQ(value, 0.9);
+    EXPECT_FALSE(table.find("mix", value));
+
+    DSP::JsonNumberTable<8> flat(R"({"gain": 0.1, "mix": 0.2})");
+    ASSERT_TRUE(flat.find("mix", value));
+    EXPECT_DOUBLE_EQ(value, 0.2);
+}
+
+//==============================================================================
+// TEST: JSON Compile
+//==============================================================================
+
+TEST(PresetFormatTests, CompileJson_ParametersObjectWinsOverTopLevel)
+{
+    const char* json = R"({ "gain": 0.1, "name": "x", "parameters": { "gain": 0.9, "cutoff": 2000, "unknown": 1 } })";
+
+    TestPreset preset;
+    EXPECT_EQ(preset.compileJson(json, TEST_REGISTRY), 2);
+
+    ASSERT_EQ(preset.size(), 2);
+    EXPECT_EQ(preset[0].index, 0);
+    EXPECT_FLOAT_EQ(preset[0].value, 0.9f);
+    EXPECT_EQ(preset[1].index, 1);
+    EXPECT_FLOAT_EQ(preset[1].value, 2000.0f);
+}
+
+//==============================================================================
+// TEST: Binary Round-Trip
+//==============================================================================
+
+TEST(PresetFormatTests, Binary_RoundTripsEveryEntry)
+{
+    const TestPreset original = makePreset();
+    const auto bytes = encode(original, TEST_REGISTRY.layoutHash());
+    ASSERT_EQ(bytes.size(), TestPreset::HEADER_SIZE + 2 * TestPreset::ENTRY_SIZE);
+    EXPECT_EQ(std::memcmp(bytes.data(), "NPRB", 4), 0);
+
+    TestPreset decoded;
+    ASSERT_TRUE(decoded.readBinary(bytes.data(), bytes.size(), TEST_REGISTRY.layoutHash()));
+    ASSERT_EQ(decoded.size(), original.size());
+    for (int i = 0; i < original.size(); ++i)
+    {
+        EXPECT_EQ(decoded[i].index, original[i].index);
+        EXPECT_EQ(decoded[i].value, original[i].value);
+    }
+}
+
+TEST(PresetFormatTests, Binary_WriteRefusesSmallBuffer)
+{
+    const TestPreset preset = makePreset();
+    std::vector<uint8_t> bytes(preset.binarySize() - 1);
+    EXPECT_EQ(preset.writeBinary(bytes.data(), bytes.size(), TEST_REGISTRY.layoutHash()), 0u);
+}
+
+//==============================================================================
+// TEST: Binary Rejection
+//==============================================================================
+
+TEST(PresetFormatTests, Binary_RejectsTruncatedInput)
+{
+    const auto bytes = encode(makePreset(), TEST_REGISTRY.layoutHash());
+
+    TestPreset decoded;
+    EXPECT_FALSE(decoded.readBinary(bytes.data(), TestPreset::HEADER_SIZE - 1, TEST_REGISTRY.layoutHash()));
+    EXPECT_FALSE(decoded.readBinary(bytes.data(), bytes.size() - 1, TEST_REGISTRY.layoutHash()));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(PresetFormatTests, Binary_RejectsBadMagic)
+{
+    auto bytes = encode(makePreset(), TEST_REGISTRY.layoutHash());
+    bytes[0] = 'X';
+
+    TestPreset decoded;
+    EXPECT_FALSE(decoded.readBinary(bytes.data(), bytes.size(), TEST_REGISTRY.layoutHash()));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(PresetFormatTests, Binary_RejectsOtherRegistryLayout)
+{
+    ASSERT_NE(TEST_REGISTRY.layoutHash(), REORDERED_REGISTRY.layoutHash());
+    const auto bytes = encode(makePreset(), TEST_REGISTRY.layoutHash());
+
+    TestPreset decoded;
+    EXPECT_FALSE(decoded.readBinary(bytes.data(), bytes.size(), REORDERED_REGISTRY.layoutHash()));
+}
+
+TEST(PresetFormatTests, Binary_RejectsOutOfRangeIndex)
+{
+    auto bytes = encode(makePreset(), TEST_REGISTRY.layoutHash());
+    const uint16_t badIndex = 3;
+    std::memcpy(bytes.data() + TestPreset::HEADER_SIZE, &badIndex, sizeof(badIndex));
+
+    TestPreset decoded;
+    EXPECT_FALSE(decoded.readBinary(bytes.data(), bytes.size(), TEST_REGISTRY.layoutHash()));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(PresetFormatTests, Binary_RejectsNull)
+{
+    TestPreset decoded;
+    EXPECT_FALSE(decoded.readBinary(nullptr, 64, TEST_REGISTRY.layoutHash()));
+}
+
+//==============================================================================
+// TEST: Kane Marco Binary Presets
+//==============================================================================
+
+TEST(PresetFormatTests, KaneMarco_BinaryPresetAppliesAtNextBlock)
+{
+    DSP::NaturePureDSP dsp;
+    dsp.prepare(48000.0, 256);
+
+    const int volume = DSP::NaturePureDSP::getParameterIndex("master_volume");
+    ASSERT_GE(volume, 0);
+    const float before = dsp.getParameter(volume);
+
+    DSP::NaturePureDSP::Preset preset;
+    preset.set(volume, 0.125f);
+    std::vector<uint8_t> bytes(preset.binarySize());
+    preset.writeBinary(bytes.data(), bytes.size(), DSP::NaturePureDSP::PARAMETERS.layoutHash());
+
+    ASSERT_TRUE(dsp.loadBinaryPreset(bytes.data(), bytes.size()));
+    EXPECT_FLOAT_EQ(dsp.getParameter(volume), before) << "Preset must not apply off the audio thread";
+
+    float left[256];
+    float right[256];
+    float* outputs[] = { left, right };
+    dsp.process(outputs, 2, 256);
+    EXPECT_FLOAT_EQ(dsp.getParameter(volume), 0.125f);
+}
+
+TEST(PresetFormatTests, KaneMarco_RejectsForeignBinaryPreset)
+{
+    DSP::NaturePureDSP dsp;
+    const auto bytes = encode(makePreset(), TEST_REGISTRY.layoutHash());
+    EXPECT_FALSE(dsp.loadBinaryPreset(bytes.data(), bytes.size()));
+}
+
+TEST(PresetFormatTests, KaneMarco_UpfsPresetStagesLfoShapeAndTune)
+{
+    DSP::NaturePureDSP dsp;
+    dsp.prepare(48000.0, 256);
+
+    const char* json = R"({ "version": "1.0.0", "format": "UPFS", "name": "x",)"
+                       R"( "parameters": { "lfo1_waveform": 3, "lfo2_bipolar": 1, "master_tune": -2 } })";
+    DSP::NaturePureDSP::Preset preset;
+    EXPECT_EQ(DSP::NaturePureDSP::compilePreset(json, preset), 3);
+    dsp.publishPreset(preset);
+
+    float left[256];
+    float right[256];
+    float* outputs[] = { left, right };
+    dsp.process(outputs, 2, 256);
+    EXPECT_FLOAT_EQ(dsp.getParameter("lfo1_waveform"), 3.0f);
+    EXPECT_FLOAT_EQ(dsp.getParameter("lfo2_bipolar"), 1.0f);
+    EXPECT_FLOAT_EQ(dsp.getParameter("master_tune"), -2.0f);
+}
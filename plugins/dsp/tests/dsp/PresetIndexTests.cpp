@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    PresetIndexTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the background preset index (plugin/PresetIndex.h)
+    - Folder scan: *.json only, sorted, text preloaded
+    - Incremental rescan picks up changed and new files
+    - The manifest seeds a fresh index
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include "../../include/plugin/PresetIndex.h"
+#include <memory>
+
+//==============================================================================
+// Test Fixture
+class PresetIndexTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        root = juce::File::createTempFile("presetindex");
+        folder = root.getChildFile("presets");
+        folder.createDirectory();
+        manifest = root.getChildFile("cache").getChildFile("manifest.bin");
+    }
+
+    void TearDown() override
+    {
+        root.deleteRecursively();
+    }
+
+    void writePreset(const juce::String& name, const juce::String& text)
+    {
+        ASSERT_TRUE(folder.getChildFile(name).replaceWithText(text));
+    }
+
+    /** Poll until the index publishes a snapshot with count entries */
+    static std::shared_ptr<const PresetIndex::Snapshot> waitForEntries(const PresetIndex& index, size_t count)
+    {
+        for (int attempt = 0; attempt < 500; ++attempt)
+        {
+            auto snapshot = index.getSnapshot();
+            if (snapshot->entries.size() == count)
+                return snapshot;
+            juce::Thread::sleep(10);
+        }
+        return index.getSnapshot();
+    }
+
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::File root;
+    juce::File folder;
+    juce::File manifest;
+};
+
+//==============================================================================
+// TEST: Scanning
+//==============================================================================
+
+TEST_F(PresetIndexTests, Scan_ListsJsonSortedWithContent)
+{
+    writePreset("b_second.json", "{ \"name\": \"B\" }");
+    writePreset("a_first.json", "{ \"name\": \"A\" }");
+    writePreset("notes.txt", "not a preset");
+
+    PresetIndex index;
+    index.setFolder(folder, "1", manifest);
+
+    const auto snapshot = waitForEntries(index, 2);
+    ASSERT_EQ(snapshot->entries.size(), 2u);
+    EXPECT_EQ(snapshot->instrument, juce::String("1"));
+    EXPECT_EQ(snapshot->entries[0].fileName, juce::String("a_first.json"));
+    EXPECT_EQ(snapshot->entries[1].fileName, juce::String("b_second.json"));
+    EXPECT_EQ(snapshot->entries[0].content, juce::String("{ \"name\": \"A\" }"));
+    EXPECT_EQ(snapshot->indexOf("b_second.json"), 1);
+    EXPECT_EQ(snapshot->indexOf("notes.txt"), -1);
+}
+
+TEST_F(PresetIndexTests, Refresh_PicksUpNewAndChangedFiles)
+{
+    writePreset("a.json", "{ \"v\": 1 }");
+
+    PresetIndex index;
+    index.setFolder(folder, "1", manifest);
+    ASSERT_EQ(waitForEntries(index, 1)->entries.size(), 1u);
+
+    // Size changes, so the entry is re-read rather than reused
+    writePreset("a.json", "{ \"v\": 22 }");
+    writePreset("b.json", "{ \"v\": 3 }");
+    index.refresh();
+
+    const auto snapshot = waitForEntries(index, 2);
+    ASSERT_EQ(snapshot->entries.size(), 2u);
+    EXPECT_EQ(snapshot->entries[0].content, juce::String("{ \"v\": 22 }"));
+}
+
+TEST_F(PresetIndexTests, Manifest_IsWrittenAndSeedsAFreshIndex)
+{
+    writePreset("a.json", "{ \"v\": 1 }");
+    {
+        PresetIndex index;
+        index.setFolder(folder, "1", manifest);
+        ASSERT_EQ(waitForEntries(index, 1)->entries.size(), 1u);
+    }
+    EXPECT_TRUE(manifest.existsAsFile());
+
+    PresetIndex index;
+    index.setFolder(folder, "1", manifest);
+    const auto snapshot = waitForEntries(index, 1);
+    ASSERT_EQ(snapshot->entries.size(), 1u);
+    EXPECT_EQ(snapshot->entries[0].content, juce::String("{ \"v\": 1 }"));
+}
+
+TEST_F(PresetIndexTests, Snapshot_IsEmptyBeforeAnyFolder)
+{
+    PresetIndex index;
+    const auto snapshot = index.getSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_TRUE(snapshot->entries.empty());
+}
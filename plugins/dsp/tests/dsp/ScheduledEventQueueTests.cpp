@@ -0,0 +1,195 @@
+/*
+  ==============================================================================
+
+    ScheduledEventQueueTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the shared MIDI event pipeline (ScheduledEventQueue.h)
+    - Sample-offset ordering, stable for equal offsets
+    - Overflow: push() refuses, pushOrFlush() applies queued events in order
+    - Raw MIDI conversion (all sound off resets, all notes off releases)
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../include/dsp/ScheduledEventQueue.h"
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+DSP::ScheduledEvent noteEvent(DSP::ScheduledEvent::Type type, int note, uint32_t offset)
+{
+    DSP::ScheduledEvent event{};
+    event.type = type;
+    event.sampleOffset = offset;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = type == DSP::ScheduledEvent::NOTE_ON ? 1.0f : 0.0f;
+    return event;
+}
+
+// Records handleEvent() calls in order
+struct EventRecorder
+{
+    std::vector<DSP::ScheduledEvent> events;
+
+    void handleEvent(const DSP::ScheduledEvent& event) { events.push_back(event); }
+};
+
+} // namespace
+
+//==============================================================================
+// TEST: Ordering
+//==============================================================================
+
+TEST(ScheduledEventQueueTests, Push_SortsBySampleOffset)
+{
+    DSP::ScheduledEventQueue<8> queue;
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 60, 30));
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 61, 10));
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 62, 20));
+
+    ASSERT_EQ(queue.size(), 3);
+    EXPECT_EQ(queue[0].sampleOffset, 10u);
+    EXPECT_EQ(queue[1].sampleOffset, 20u);
+    EXPECT_EQ(queue[2].sampleOffset, 30u);
+}
+
+TEST(ScheduledEventQueueTests, Push_KeepsArrivalOrderForEqualOffsets)
+{
+    DSP::ScheduledEventQueue<8> queue;
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 60, 5));
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_OFF, 60, 5));
+    queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 61, 0));
+
+    ASSERT_EQ(queue.size(), 3);
+    EXPECT_EQ(queue[0].data.note.midiNote, 61);
+    EXPECT_EQ(queue[1].type, DSP::ScheduledEvent::NOTE_ON);
+    EXPECT_EQ(queue[2].type, DSP::ScheduledEvent::NOTE_OFF);
+}
+
+//==============================================================================
+// TEST: Overflow
+//==============================================================================
+
+TEST(ScheduledEventQueueTests, Push_RefusesWhenFull)
+{
+    DSP::ScheduledEventQueue<2> queue;
+    EXPECT_TRUE(queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 60, 0)));
+    EXPECT_TRUE(queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 61, 1)));
+    EXPECT_TRUE(queue.full());
+    EXPECT_FALSE(queue.push(noteEvent(DSP::ScheduledEvent::NOTE_ON, 62, 2)));
+    EXPECT_EQ(queue.size(), 2);
+}
+
+TEST(ScheduledEventQueueTests, PushOrFlush_AppliesQueuedEventsInOrderBeforeTheNewOne)
+{
+    DSP::ScheduledEventQueue<2> queue;
+    EventRecorder target;
+
+    EXPECT_TRUE(queue.pushOrFlush(noteEvent(DSP::ScheduledEvent::NOTE_ON, 60, 0), target));
+    EXPECT_TRUE(queue.pushOrFlush(noteEvent(DSP::ScheduledEvent::NOTE_ON, 61, 4), target));
+    EXPECT_TRUE(target.events.empty());
+    EXPECT_EQ(queue.overflowCount(), 0u);
+
+    // The note-off for 60 must not overtake its note-on
+    EXPECT_FALSE(queue.pushOrFlush(noteEvent(DSP::ScheduledEvent::NOTE_OFF, 60, 8), target));
+
+    ASSERT_EQ(target.events.size(), 2u);
+    EXPECT_EQ(target.events[0].data.note.midiNote, 60);
+    EXPECT_EQ(target.events[0].type, DSP::ScheduledEvent::NOTE_ON);
+    EXPECT_EQ(target.events[1].data.note.midiNote, 61);
+
+    ASSERT_EQ(queue.size(), 1);
+    EXPECT_EQ(queue[0].type, DSP::ScheduledEvent::NOTE_OFF);
+    EXPECT_EQ(queue[0].sampleOffset, 8u);
+    EXPECT_EQ(queue.overflowCount(), 1u);
+}
+
+TEST(ScheduledEventQueueTests, PushOrFlush_OverflowCountSurvivesClear)
+{
+    DSP::ScheduledEventQueue<1> queue;
+    EventRecorder target;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        queue.pushOrFlush(noteEvent(DSP::ScheduledEvent::NOTE_ON, 60 + i, static_cast<uint32_t>(i)), target);
+    }
+    queue.clear();
+
+    EXPECT_EQ(target.events.size(), 3u);
+    EXPECT_EQ(queue.overflowCount(), 3u);
+}
+
+//==============================================================================
+// TEST: MIDI Conversion
+//==============================================================================
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_MapsNotesAndKeepsOffset)
+{
+    DSP::ScheduledEvent event;
+    const uint8_t noteOn[] = { 0x91, 64, 127 };
+    ASSERT_TRUE(DSP::toScheduledEvent(noteOn, 3, 17, event));
+    EXPECT_EQ(event.type, DSP::ScheduledEvent::NOTE_ON);
+    EXPECT_EQ(event.data.note.midiNote, 64);
+    EXPECT_FLOAT_EQ(event.data.note.velocity, 1.0f);
+    EXPECT_EQ(event.sampleOffset, 17u);
+
+    // Note-on with velocity 0 is a note-off
+    const uint8_t silentNoteOn[] = { 0x90, 64, 0 };
+    ASSERT_TRUE(DSP::toScheduledEvent(silentNoteOn, 3, 0, event));
+    EXPECT_EQ(event.type, DSP::ScheduledEvent::NOTE_OFF);
+}
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_AllSoundOffIsReset)
+{
+    DSP::ScheduledEvent event;
+    const uint8_t allSoundOff[] = { 0xB5, 120, 0 };
+    ASSERT_TRUE(DSP::toScheduledEvent(allSoundOff, 3, 9, event));
+    EXPECT_EQ(event.type, DSP::ScheduledEvent::RESET);
+    EXPECT_EQ(event.sampleOffset, 9u);
+}
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_AllNotesOffReleasesInsteadOfResetting)
+{
+    // Engines release held notes on the controller; only all sound off cuts voices
+    DSP::ScheduledEvent event;
+    const uint8_t allNotesOff[] = { 0xB5, 123, 0 };
+    ASSERT_TRUE(DSP::toScheduledEvent(allNotesOff, 3, 9, event));
+    EXPECT_EQ(event.type, DSP::ScheduledEvent::CONTROL_CHANGE);
+    EXPECT_EQ(event.data.controlChange.controllerNumber, DSP::MIDI_CC_ALL_NOTES_OFF);
+    EXPECT_EQ(event.sampleOffset, 9u);
+}
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_MapsControllers)
+{
+    DSP::ScheduledEvent event;
+
+    // Reset all controllers is an ordinary controller, not a voice reset
+    const uint8_t resetControllers[] = { 0xB0, 121, 0 };
+    ASSERT_TRUE(DSP::toScheduledEvent(resetControllers, 3, 0, event));
+    EXPECT_EQ(event.type, DSP::ScheduledEvent::CONTROL_CHANGE);
+    EXPECT_EQ(event.data.controlChange.controllerNumber, 121);
+}
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_CentersPitchBend)
+{
+    DSP::ScheduledEvent event;
+    const uint8_t center[] = { 0xE0, 0x00, 0x40 };
+    ASSERT_TRUE(DSP::toScheduledEvent(center, 3, 0, event));
+    EXPECT_FLOAT_EQ(event.data.pitchBend.bendValue, 0.0f);
+
+    const uint8_t lowest[] = { 0xE0, 0x00, 0x00 };
+    ASSERT_TRUE(DSP::toScheduledEvent(lowest, 3, 0, event));
+    EXPECT_FLOAT_EQ(event.data.pitchBend.bendValue, -1.0f);
+}
+
+TEST(ScheduledEventQueueTests, ToScheduledEvent_RejectsUnmappedMessages)
+{
+    DSP::ScheduledEvent event;
+    const uint8_t sysex[] = { 0xF0, 0x7E, 0xF7 };
+    EXPECT_FALSE(DSP::toScheduledEvent(sysex, 3, 0, event));
+    EXPECT_FALSE(DSP::toScheduledEvent(nullptr, 3, 0, event));
+}
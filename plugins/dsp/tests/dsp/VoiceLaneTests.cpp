@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    VoiceLaneTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for Kane Marco voice lane rendering (VoiceManager::setVoiceLaneMode)
+    - Lane output matches the voice-major render for every oscillator shape
+    - ...with phase warp, sub-oscillator, noise and every filter type
+    - Voices beyond the last full lane group fall back to per-voice rendering
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../include/dsp/KaneMarcoPureDSP.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Settings = std::vector<std::pair<const char*, float>>;
+
+DSP::ScheduledEvent noteEvent(DSP::ScheduledEvent::Type type, int note, float velocity)
+{
+    DSP::ScheduledEvent event{};
+    event.type = type;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    return event;
+}
+
+// Renders numNotes notes (released half way) on Kane Marco
+std::vector<float> renderNotes(bool laneMode, const Settings& settings, int numNotes)
+{
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int NUM_BLOCKS = 24;
+
+    DSP::NaturePureDSP dsp;
+    dsp.prepare(48000.0, BLOCK_SIZE);
+    dsp.setVoiceLaneMode(laneMode);
+    for (const auto& [id, value] : settings)
+        dsp.setParameter(id, value);
+
+    for (int i = 0; i < numNotes; ++i)
+        dsp.handleEvent(noteEvent(DSP::ScheduledEvent::NOTE_ON, 40 + i * 3, 0.5f + 0.03f * static_cast<float>(i)));
+
+    std::vector<float> rendered;
+    float left[BLOCK_SIZE];
+    float right[BLOCK_SIZE];
+    float* outputs[] = { left, right };
+    for (int block = 0; block < NUM_BLOCKS; ++block)
+    {
+        if (block == NUM_BLOCKS / 2)
+        {
+            for (int i = 0; i < numNotes; ++i)
+                dsp.handleEvent(noteEvent(DSP::ScheduledEvent::NOTE_OFF, 40 + i * 3, 0.0f));
+        }
+        dsp.process(outputs, 2, BLOCK_SIZE);
+        rendered.insert(rendered.end(), left, left + BLOCK_SIZE);
+        rendered.insert(rendered.end(), right, right + BLOCK_SIZE);
+    }
+    return rendered;
+}
+
+// Same operations in the same order; a compiler may still contract them
+// differently (FMA) in the two loops, hence the small tolerance
+void expectLanesMatchVoiceMajor(const Settings& settings, int numNotes)
+{
+    const std::vector<float> voiceMajor = renderNotes(false, settings, numNotes);
+    const std::vector<float> lanes = renderNotes(true, settings, numNotes);
+
+    ASSERT_EQ(lanes.size(), voiceMajor.size());
+    float peak = 0.0f;
+    for (size_t i = 0; i < voiceMajor.size(); ++i)
+    {
+        ASSERT_NEAR(lanes[i], voiceMajor[i], 1.0e-5f) << "First difference at sample " << i;
+        peak = std::max(peak, std::abs(voiceMajor[i]));
+    }
+    EXPECT_GT(peak, 0.0f) << "The notes must actually sound";
+}
+
+} // namespace
+
+//==============================================================================
+// TEST: Equivalence
+//==============================================================================
+
+TEST(VoiceLaneTests, Lanes_MatchVoiceMajorForEveryShape)
+{
+    for (int shape = 0; shape < 5; ++shape)
+    {
+        SCOPED_TRACE(shape);
+        expectLanesMatchVoiceMajor({ { "osc1_shape", static_cast<float>(shape) },
+                                     { "osc2_shape", static_cast<float>(4 - shape) } }, 8);
+    }
+}
+
+TEST(VoiceLaneTests, Lanes_MatchVoiceMajorWithWarpSubAndNoise)
+{
+    for (int shape = 0; shape < 5; ++shape)
+    {
+        SCOPED_TRACE(shape);
+        expectLanesMatchVoiceMajor({ { "osc1_shape", static_cast<float>(shape) },
+                                     { "osc1_warp", 0.4f },
+                                     { "osc2_warp", -0.7f },
+                                     { "sub_enabled", 1.0f },
+                                     { "sub_level", 0.3f },
+                                     { "noise_level", 0.2f } }, 8);
+    }
+}
+
+TEST(VoiceLaneTests, Lanes_MatchVoiceMajorForEveryFilterType)
+{
+    for (int type = 0; type < 4; ++type)
+    {
+        SCOPED_TRACE(type);
+        expectLanesMatchVoiceMajor({ { "filter_type", static_cast<float>(type) },
+                                     { "filter_resonance", 0.7f } }, 8);
+    }
+}
+
+TEST(VoiceLaneTests, Lanes_PartialGroupFallsBackToPerVoice)
+{
+    // Three full groups of four and two per-voice leftovers
+    expectLanesMatchVoiceMajor({}, 14);
+}
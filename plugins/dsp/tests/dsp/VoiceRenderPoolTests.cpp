@@ -0,0 +1,216 @@
+/*
+  ==============================================================================
+
+    VoiceRenderPoolTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the work-stealing voice render pool (VoiceRenderPool.h)
+    - Every task runs exactly once, on workers and on the calling thread
+    - Tasks of a blocked participant are stolen by the others
+    - A pool already running a job renders on the caller instead
+    - Kane Marco: pooled rendering matches the serial render bit-exactly
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../include/dsp/VoiceRenderPool.h"
+#include "../../include/dsp/KaneMarcoPureDSP.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+DSP::VoiceRenderPool::Config testConfig(int numWorkers)
+{
+    // No pinning or SCHED_FIFO: tests run on shared CI machines
+    DSP::VoiceRenderPool::Config config;
+    config.numWorkers = numWorkers;
+    config.pinWorkers = false;
+    config.realtimePriority = false;
+    return config;
+}
+
+struct TaskLog
+{
+    std::array<std::atomic<int>, 256> runs{};
+    std::array<std::atomic<int>, DSP::VoiceRenderPool::MAX_PARTICIPANTS> byParticipant{};
+    std::atomic<int> byWorkers{0};
+    int waitForWorkers = 0;  // Task 0 blocks until the workers ran this many tasks
+
+    static void record(void* context, int task, int participant)
+    {
+        auto& log = *static_cast<TaskLog*>(context);
+        if (task == 0 && log.waitForWorkers > 0)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+            while (log.byWorkers.load() < log.waitForWorkers && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        log.runs[static_cast<size_t>(task)].fetch_add(1, std::memory_order_relaxed);
+        log.byParticipant[static_cast<size_t>(participant)].fetch_add(1, std::memory_order_relaxed);
+        if (participant != 0)
+            log.byWorkers.fetch_add(1);
+    }
+};
+
+DSP::ScheduledEvent noteOn(int note, float velocity)
+{
+    DSP::ScheduledEvent event{};
+    event.type = DSP::ScheduledEvent::NOTE_ON;
+    event.data.note.midiNote = note;
+    event.data.note.velocity = velocity;
+    return event;
+}
+
+// Renders a chord on Kane Marco, optionally through pool
+std::vector<float> renderChord(DSP::VoiceRenderPool* pool)
+{
+    constexpr int BLOCK_SIZE = 256;
+    constexpr int NUM_BLOCKS = 16;
+
+    DSP::NaturePureDSP dsp;
+    dsp.prepare(48000.0, BLOCK_SIZE);
+    dsp.setRenderPool(pool);
+
+    for (int i = 0; i < 12; ++i)
+        dsp.handleEvent(noteOn(48 + i * 3, 0.5f + 0.04f * static_cast<float>(i)));
+
+    std::vector<float> rendered;
+    float left[BLOCK_SIZE];
+    float right[BLOCK_SIZE];
+    float* outputs[] = { left, right };
+    for (int block = 0; block < NUM_BLOCKS; ++block)
+    {
+        dsp.process(outputs, 2, BLOCK_SIZE);
+        rendered.insert(rendered.end(), left, left + BLOCK_SIZE);
+        rendered.insert(rendered.end(), right, right + BLOCK_SIZE);
+    }
+    return rendered;
+}
+
+} // namespace
+
+//==============================================================================
+// TEST: Task Distribution
+//==============================================================================
+
+TEST(VoiceRenderPoolTests, Run_EveryTaskRunsExactlyOnce)
+{
+    DSP::VoiceRenderPool pool;
+    pool.start(testConfig(3));
+    ASSERT_EQ(pool.getNumParticipants(), 4);
+
+    for (int numTasks : { 1, 2, 3, 4, 5, 17, 64, 256 })
+    {
+        TaskLog log;
+        pool.run(&TaskLog::record, &log, numTasks);
+        for (int task = 0; task < 256; ++task)
+            EXPECT_EQ(log.runs[static_cast<size_t>(task)].load(), task < numTasks ? 1 : 0)
+                << "numTasks " << numTasks << ", task " << task;
+    }
+}
+
+TEST(VoiceRenderPoolTests, Run_StealsFromASlowParticipant)
+{
+    constexpr int NUM_TASKS = 64;
+    constexpr int WORKER_RANGES = NUM_TASKS * 3 / 4;
+
+    DSP::VoiceRenderPool pool;
+    pool.start(testConfig(3));
+
+    // The caller blocks on task 0, the front of its own range, until the
+    // workers have run more than their own ranges hold: the rest can only
+    // have been stolen from the back of the caller's range. A worker first
+    // scheduled mid-job sits that job out, hence a few attempts.
+    bool stolen = false;
+    for (int attempt = 0; attempt < 5 && !stolen; ++attempt)
+    {
+        TaskLog log;
+        log.waitForWorkers = WORKER_RANGES + 1;
+        pool.run(&TaskLog::record, &log, NUM_TASKS);
+
+        for (int task = 0; task < NUM_TASKS; ++task)
+            ASSERT_EQ(log.runs[static_cast<size_t>(task)].load(), 1);
+        stolen = log.byWorkers.load() > WORKER_RANGES;
+    }
+    EXPECT_TRUE(stolen) << "Workers never stole from the blocked caller";
+}
+
+TEST(VoiceRenderPoolTests, Run_WithoutWorkersIsSerial)
+{
+    DSP::VoiceRenderPool pool;
+    EXPECT_EQ(pool.getNumWorkers(), 0);
+
+    TaskLog log;
+    pool.run(&TaskLog::record, &log, 8);
+    EXPECT_EQ(log.byParticipant[0].load(), 8);
+}
+
+TEST(VoiceRenderPoolTests, Run_NestedCallRendersOnCaller)
+{
+    DSP::VoiceRenderPool pool;
+    pool.start(testConfig(2));
+
+    struct Nested
+    {
+        DSP::VoiceRenderPool* pool;
+        TaskLog inner;
+        std::atomic<int> outerRuns{0};
+
+        static void outer(void* context, int, int)
+        {
+            auto& self = *static_cast<Nested*>(context);
+            self.outerRuns.fetch_add(1);
+            self.pool->run(&TaskLog::record, &self.inner, 4);
+        }
+    };
+
+    Nested nested;
+    nested.pool = &pool;
+    pool.run(&Nested::outer, &nested, 3);
+
+    EXPECT_EQ(nested.outerRuns.load(), 3);
+    for (int task = 0; task < 4; ++task)
+        EXPECT_EQ(nested.inner.runs[static_cast<size_t>(task)].load(), 3);
+}
+
+TEST(VoiceRenderPoolTests, Stop_CanRestart)
+{
+    DSP::VoiceRenderPool pool;
+    pool.start(testConfig(2));
+    pool.stop();
+    EXPECT_EQ(pool.getNumWorkers(), 0);
+
+    pool.start(testConfig(1));
+    TaskLog log;
+    pool.run(&TaskLog::record, &log, 10);
+    for (int task = 0; task < 10; ++task)
+        EXPECT_EQ(log.runs[static_cast<size_t>(task)].load(), 1);
+}
+
+//==============================================================================
+// TEST: Kane Marco Pooled Rendering
+//==============================================================================
+
+TEST(VoiceRenderPoolTests, KaneMarco_PooledRenderMatchesSerial)
+{
+    const std::vector<float> serial = renderChord(nullptr);
+
+    DSP::VoiceRenderPool pool;
+    pool.start(testConfig(3));
+    const std::vector<float> pooled = renderChord(&pool);
+
+    ASSERT_EQ(pooled.size(), serial.size());
+    float peak = 0.0f;
+    for (size_t i = 0; i < serial.size(); ++i)
+    {
+        ASSERT_EQ(pooled[i], serial[i]) << "First difference at sample " << i;
+        peak = std::max(peak, std::abs(serial[i]));
+    }
+    EXPECT_GT(peak, 0.0f) << "The chord must actually sound";
+}
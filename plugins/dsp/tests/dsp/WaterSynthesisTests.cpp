@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    WaterSynthesisTests.cpp
+    Created: 19 Jan 2026
+    Author:  Bret Bouchard
+
+    Tests for the Nature water module (NatureDSP_Pure.h)
+    - Drips: a 50 ms burst plays out in full across render chunks
+    - Drips: output does not depend on how the host splits blocks
+
+  ==============================================================================
+*/
+
+#include <gtest/gtest.h>
+#include "../../../../include/dsp/NatureDSP_Pure.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+constexpr int NUM_SAMPLES = 48000;
+constexpr int DRIP_LENGTH = 2400;  // 50 ms
+
+/** Render one second of drips (texture 0: 2 per second) in calls of blockSize */
+std::vector<float> renderDrips(int blockSize)
+{
+    DSP::RandomState rng;
+    DSP::WaterSynthesis water;
+    water.init(SAMPLE_RATE, rng);
+    DSP::WaterSynthesis::State state;
+
+    std::vector<float> left(NUM_SAMPLES, 0.0f);
+    std::vector<float> right(NUM_SAMPLES, 0.0f);
+    for (int offset = 0; offset < NUM_SAMPLES; offset += blockSize)
+    {
+        const int n = std::min(blockSize, NUM_SAMPLES - offset);
+        float* outputs[] = { left.data() + offset, right.data() + offset };
+        water.process(state, outputs, 2, n, DSP::WaterSynthesis::Drips, 1.0f, 0.0f);
+    }
+    return left;
+}
+
+} // namespace
+
+//==============================================================================
+// TEST: Drips
+//==============================================================================
+
+TEST(WaterSynthesisTests, Drips_BurstSpansChunkBoundaries)
+{
+    const std::vector<float> left = renderDrips(NUM_SAMPLES);
+
+    const auto first = std::find_if(left.begin(), left.end(), [](float x) { return x != 0.0f; });
+    ASSERT_NE(first, left.end()) << "No drip fired";
+    const int onset = static_cast<int>(first - left.begin());
+
+    // The module renders in 256-sample chunks; this drip starts mid-chunk
+    ASSERT_NE(onset % 256, 0);
+    ASSERT_LE(onset + DRIP_LENGTH, NUM_SAMPLES);
+
+    // Every later chunk the burst touches still carries it
+    for (int chunk = onset / 256 + 1; chunk * 256 < onset + DRIP_LENGTH - 256; ++chunk)
+    {
+        float peak = 0.0f;
+        for (int i = chunk * 256; i < (chunk + 1) * 256; ++i)
+            peak = std::max(peak, std::abs(left[static_cast<size_t>(i)]));
+        EXPECT_GT(peak, 0.01f) << "Burst cut off before chunk " << chunk;
+    }
+
+    // ...and it ends after its 50 ms, before the next drip
+    for (int i = onset + DRIP_LENGTH; i < onset + 2 * DRIP_LENGTH; ++i)
+        EXPECT_EQ(left[static_cast<size_t>(i)], 0.0f) << "Sample " << i;
+}
+
+TEST(WaterSynthesisTests, Drips_IndependentOfHostBlockSize)
+{
+    const std::vector<float> whole = renderDrips(NUM_SAMPLES);
+    const std::vector<float> split = renderDrips(97);
+
+    for (size_t i = 0; i < whole.size(); ++i)
+        ASSERT_EQ(split[i], whole[i]) << "First difference at sample " << i;
+}
@@ -17,6 +17,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <cmath>
+#include <atomic>
+#include <thread>
 
 void print_separator()
 {
@@ -375,6 +377,120 @@ void test_audio_processing()
     nature_destroy(instance);
 }
 
+void test_render_parameter_handoff()
+{
+    print_separator();
+    printf("TEST: Render Parameter Handoff\n");
+    print_separator();
+
+    NatureDSPInstance* instance = nature_create();
+    nature_initialize(instance, 48000.0, 256);
+
+    float left[256];
+    float right[256];
+    float* outputs[2] = { left, right };
+    NatureMidiEvent noteOn = { 0, 3, { 0x90, 0x3C, 0x64 } };
+
+    // Set before rendering: must be applied at the start of the block
+    printf("Muting master_volume, then rendering a note...\n");
+    nature_set_parameter_value(instance, "master_volume", 0.0f);
+    nature_render(instance, outputs, 2, 256, &noteOn, 1);
+
+    float mutedPeak = 0.0f;
+    for (int i = 0; i < 256; ++i)
+    {
+        mutedPeak = fmaxf(mutedPeak, fmaxf(fabsf(left[i]), fabsf(right[i])));
+    }
+
+    if (mutedPeak == 0.0f)
+    {
+        printf("✓ PASS: Muted block is silent\n");
+    }
+    else
+    {
+        printf("✗ FAILED: Muted block peaked at %.6f\n", mutedPeak);
+    }
+
+    // Latest value wins when several sets land between blocks
+    nature_set_parameter_value(instance, "master_volume", 0.3f);
+    nature_set_parameter_value(instance, "master_volume", 1.0f);
+    nature_render(instance, outputs, 2, 256, nullptr, 0);
+
+    float peak = 0.0f;
+    for (int i = 0; i < 256; ++i)
+    {
+        peak = fmaxf(peak, fmaxf(fabsf(left[i]), fabsf(right[i])));
+    }
+
+    if (peak > 0.0f)
+    {
+        printf("✓ PASS: Unmuted block peaked at %.6f\n", peak);
+    }
+    else
+    {
+        printf("✗ FAILED: Unmuted block is silent\n");
+    }
+
+    // Presets load on another thread while the render thread keeps running:
+    // they are staged like parameter sets, never applied mid-block
+    printf("Loading presets on a second thread while rendering...\n");
+    const char* mutedPreset =
+        "{ \"version\": \"1.0.0\", \"format\": \"UPFS\", \"name\": \"Muted\","
+        "  \"parameters\": { \"master_volume\": 0.0, \"lfo1_waveform\": 2.0 } }";
+    const char* loudPreset = "{ \"master_volume\": 1.0, \"filter_cutoff\": 0.8 }";
+
+    std::atomic<bool> rendering{ true };
+    std::thread loader([&]
+    {
+        for (int i = 0; rendering.load(); ++i)
+        {
+            nature_load_preset(instance, (i % 2 == 0) ? loudPreset : mutedPreset);
+        }
+    });
+
+    bool finite = true;
+    for (int block = 0; block < 200; ++block)
+    {
+        nature_render(instance, outputs, 2, 256, nullptr, 0);
+        for (int i = 0; i < 256; ++i)
+        {
+            finite = finite && std::isfinite(left[i]) && std::isfinite(right[i]);
+        }
+    }
+    rendering.store(false);
+    loader.join();
+
+    if (finite)
+    {
+        printf("✓ PASS: Rendering stayed finite during concurrent preset loads\n");
+    }
+    else
+    {
+        printf("✗ FAILED: Non-finite output during concurrent preset loads\n");
+    }
+
+    // The last preset loaded applies in full at the next block
+    nature_load_preset(instance, mutedPreset);
+    nature_render(instance, outputs, 2, 256, nullptr, 0);
+
+    float presetPeak = 0.0f;
+    for (int i = 0; i < 256; ++i)
+    {
+        presetPeak = fmaxf(presetPeak, fmaxf(fabsf(left[i]), fabsf(right[i])));
+    }
+
+    if (presetPeak == 0.0f)
+    {
+        printf("✓ PASS: Staged UPFS preset muted the next block\n");
+    }
+    else
+    {
+        printf("✗ FAILED: Block after the muted preset peaked at %.6f\n", presetPeak);
+    }
+
+    nature_destroy(instance);
+}
+
 void test_reset()
 {
     print_separator();
@@ -437,6 +553,9 @@ int main(int argc, char* argv[])
     test_audio_processing();
     printf("\n");
 
+    test_render_parameter_handoff();
+    printf("\n");
+
     test_reset();
     printf("\n");
 
@@ -8,6 +8,35 @@
 
 #include "NaturePlugin.h"
 
+namespace {
+
+/**
+ * @brief Forwards one parameter to the DSP under its registry index
+ *
+ * The index is resolved once at registration, so automation callbacks do
+ * no ID lookup. Callbacks may fire on any thread; publishParameter() hands
+ * the value to the audio thread lock-free.
+ */
+class IndexedParameterListener : public juce::AudioProcessorValueTreeState::Listener
+{
+public:
+    IndexedParameterListener(DSP::NatureDSP& dsp, int index)
+        : dsp_(dsp), index_(index)
+    {
+    }
+
+    void parameterChanged(const juce::String&, float newValue) override
+    {
+        dsp_.publishParameter(index_, newValue);
+    }
+
+private:
+    DSP::NatureDSP& dsp_;
+    const int index_;
+};
+
+} // namespace
+
 //==============================================================================
 // Constructor/Destructor
 //==============================================================================
@@ -38,17 +67,19 @@ NaturePlugin::NaturePlugin()
         *this, nullptr, "NatureParameters", std::move(layout)
     );
 
-    // Register listener for parameter changes
+    // Register one listener per parameter, with its DSP index resolved here
     for (const auto& paramInfo : parameterInfos_) {
-        parameters_->addParameterListener(paramInfo.paramId, this);
+        parameterListeners_.push_back(std::make_unique<IndexedParameterListener>(
+            *dsp_, DSP::NatureDSP::getParameterIndex(paramInfo.paramId)));
+        parameters_->addParameterListener(paramInfo.paramId, parameterListeners_.back().get());
     }
 }
 
 NaturePlugin::~NaturePlugin()
 {
     // Remove parameter listeners
-    for (const auto& paramInfo : parameterInfos_) {
-        parameters_->removeParameterListener(paramInfo.paramId, this);
+    for (size_t i = 0; i < parameterListeners_.size(); ++i) {
+        parameters_->removeParameterListener(parameterInfos_[i].paramId, parameterListeners_[i].get());
     }
 }
 
@@ -81,19 +112,26 @@ void NaturePlugin::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuff
     // Ensure stereo output
     jassert(numChannels >= 2);
 
+    // Clear any channels beyond the stereo pair (pureDSP clears its own)
+    for (int ch = 2; ch < numChannels; ++ch) {
+        buffer.clear(ch, 0, numSamples);
+    }
+
     float* outputs[2] = {
         buffer.getWritePointer(0),
         buffer.getWritePointer(1)
     };
 
-    // Clear output buffers (pureDSP adds to output)
-    buffer.clear();
-
     // Process MIDI messages
     processMIDI(midiMessages, numSamples);
 
     // Process audio through pureDSP
-    dsp_->process(outputs, numChannels, numSamples);
+    dsp_->process(outputs, 2, numSamples);
+
+    // Report known-silent blocks so the host can skip downstream processing
+    if (dsp_->isOutputSilent()) {
+        buffer.clear();
+    }
 }
 
 void NaturePlugin::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -177,76 +215,25 @@ bool NaturePlugin::isOutputChannelStereoPair(int index) const
     return true;
 }
 
-//==============================================================================
-// Parameter Changes
-//==============================================================================
-
-void NaturePlugin::parameterChanged(const juce::String& parameterID, float newValue)
-{
-    // Update pureDSP parameter
-    dsp_->setParameter(parameterID.toStdString().c_str(), newValue);
-}
-
 //==============================================================================
 // MIDI Handling
 //==============================================================================
 
 void NaturePlugin::processMIDI(const juce::MidiBuffer& midiMessages, int numSamples)
 {
-    for (const auto& metadata : midiMessages) {
-        const auto& midiMessage = metadata.getMessage();
-        int sampleOffset = metadata.samplePosition;
-
+    // One pass from the raw MIDI bytes; messages with no event mapping
+    // (SysEx, clock, ...) are skipped; all sound off arrives as RESET,
+    // all notes off as CONTROL_CHANGE 123 (the engine releases held notes)
+    for (const auto metadata : midiMessages) {
         DSP::ScheduledEvent event;
-        convertMIDIToEvent(midiMessage, event, sampleOffset);
-
-        if (event.type != DSP::ScheduledEvent::Type::RESET) {
-            dsp_->handleEvent(event);
+        if (!DSP::toScheduledEvent(metadata.data, metadata.numBytes,
+                                   static_cast<uint32_t>(metadata.samplePosition), event)) {
+            continue;
         }
-    }
-}
 
-void NaturePlugin::convertMIDIToEvent(const juce::MidiMessage& midiMessage,
-                                      DSP::ScheduledEvent& event,
-                                      int sampleOffset)
-{
-    event.time = 0.0;
-    event.sampleOffset = static_cast<uint32_t>(sampleOffset);
-
-    if (midiMessage.isNoteOn()) {
-        event.type = DSP::ScheduledEvent::NOTE_ON;
-        event.data.note.midiNote = midiMessage.getNoteNumber();
-        event.data.note.velocity = midiMessage.getVelocity() / 127.0f;
-    }
-    else if (midiMessage.isNoteOff()) {
-        event.type = DSP::ScheduledEvent::NOTE_OFF;
-        event.data.note.midiNote = midiMessage.getNoteNumber();
-        event.data.note.velocity = 0.0f;
-    }
-    else if (midiMessage.isPitchWheel()) {
-        event.type = DSP::ScheduledEvent::PITCH_BEND;
-        int pitchBendValue = midiMessage.getPitchWheelValue();
-        event.data.pitchBend.bendValue = (pitchBendValue - 8192) / 8192.0f;
-    }
-    else if (midiMessage.isChannelPressure()) {
-        event.type = DSP::ScheduledEvent::CHANNEL_PRESSURE;
-        event.data.channelPressure.pressure = midiMessage.getChannelPressureValue() / 127.0f;
-    }
-    else if (midiMessage.isController()) {
-        event.type = DSP::ScheduledEvent::CONTROL_CHANGE;
-        event.data.controlChange.controllerNumber = midiMessage.getControllerNumber();
-        event.data.controlChange.value = midiMessage.getControllerValue() / 127.0f;
-    }
-    else if (midiMessage.isProgramChange()) {
-        event.type = DSP::ScheduledEvent::PROGRAM_CHANGE;
-        event.data.programChange.programNumber = midiMessage.getProgramChangeNumber();
-    }
-    else if (midiMessage.isAllNotesOff() || midiMessage.isAllSoundOff()) {
-        event.type = DSP::ScheduledEvent::RESET;
-    }
-    else {
-        // Unknown MIDI message, convert to RESET
-        event.type = DSP::ScheduledEvent::RESET;
+        // Dispatched at its sample offset inside process(); if the
+        // per-block queue is full the queued events are applied first
+        dsp_->scheduleEvent(event);
     }
 }
 
@@ -20,22 +20,10 @@ namespace DSP {
 //==============================================================================
 
 NatureDSP::NatureDSP() {
-    // Allocate synthesis modules
-    waterSynth_ = std::make_unique<WaterSynthesis>();
-    windSynth_ = std::make_unique<WindSynthesis>();
-    insectSynth_ = std::make_unique<InsectSynthesis>();
-    birdSynth_ = std::make_unique<BirdSynthesis>();
-    amphibianSynth_ = std::make_unique<AmphibianSynthesis>();
-    mammalSynth_ = std::make_unique<MammalSynthesis>();
-
-    // Allocate voices
-    for (auto& voice : voices_) {
-        voice = std::make_unique<VoiceState>();
-    }
+    // Synthesis modules and voice pool are value members (no heap allocation)
 }
 
 NatureDSP::~NatureDSP() {
-    // Cleanup handled by unique_ptr
 }
 
 //==============================================================================
@@ -50,16 +38,28 @@ bool NatureDSP::prepare(double sampleRate, int blockSize) {
     sampleRate_ = sampleRate;
     blockSize_ = blockSize;
 
+    // Vector kernels for this CPU (or the A/B override), fixed until the next prepare()
+    kernels_ = &selectSimdKernels();
+
+    // Shared sine / note tables: built by the first instance, reused by the rest
+    SharedTables::get();
+
     // Initialize synthesis modules
-    waterSynth_->init(sampleRate, random_);
-    windSynth_->init(sampleRate, random_);
-    insectSynth_->init(sampleRate, random_);
-    birdSynth_->init(sampleRate, random_);
-    amphibianSynth_->init(sampleRate, random_);
-    mammalSynth_->init(sampleRate, random_);
+    waterSynth_.init(sampleRate, random_);
+    windSynth_.init(sampleRate, random_);
+    insectSynth_.init(sampleRate, random_);
+    birdSynth_.init(sampleRate, random_);
+    amphibianSynth_.init(sampleRate, random_);
+    mammalSynth_.init(sampleRate, random_);
 
     // Initialize reverb
-    reverb_.init(sampleRate);
+    reverb_.prepare(sampleRate);
+    telemetry_.prepare(sampleRate);
+
+    // Parameter smoothing
+    masterLevelSmoother_.prepare(sampleRate, PARAMETER_SMOOTHING_SECONDS);
+    reverbMixSmoother_.prepare(sampleRate, PARAMETER_SMOOTHING_SECONDS);
+    reverbDampingSmoother_.prepare(sampleRate, PARAMETER_SMOOTHING_SECONDS);
 
     // Reset all voices
     reset();
@@ -70,57 +70,146 @@ bool NatureDSP::prepare(double sampleRate, int blockSize) {
 void NatureDSP::reset() {
     // Reset all voices
     for (auto& voice : voices_) {
-        voice->active = false;
-        voice->phase = VoiceState::Phase::Idle;
-        voice->amplitude = 0.0f;
+        voice.active = false;
+        voice.synth = VoiceSynthState{};
     }
+    envelopes_.reset();
     activeVoiceCount_.store(0);
-
-    // Reset synthesis modules
-    waterSynth_->reset();
-    windSynth_->reset();
-    insectSynth_->reset();
-    birdSynth_->reset();
-    amphibianSynth_->reset();
-    mammalSynth_->reset();
+    resetVoiceAllocator();
+    outputSilent_ = true;
+    outputPeak_ = 0.0f;
 
     // Reset reverb
     reverb_.reset();
+    snapSmoothers();
+}
+
+void NatureDSP::snapSmoothers() {
+    masterLevelSmoother_.snap(masterLevel_);
+    reverbMixSmoother_.snap(reverbMix_);
+    reverbDampingSmoother_.snap(reverbDamping_);
 }
 
 void NatureDSP::process(float** outputs, int numChannels, int numSamples) {
+    // Drain events queued via scheduleEvent() for this block
+    process(outputs, numChannels, numSamples, pendingEvents_.data(), pendingEvents_.size());
+    pendingEvents_.clear();
+}
+
+void NatureDSP::process(float** outputs, int numChannels, int numSamples,
+                        const ScheduledEvent* events, int numEvents) {
+    ScopedFlushDenormals noDenormals;  // voice filters and reverb ring down through the tail
+    Telemetry::BlockScope telemetryBlock(telemetry_, numSamples);
+
+    // Apply host-thread parameter changes published since the last block
+    hostParameters_.drain([this](int index, float value) { setParameter(index, value); });
+
     // Clear output buffers
     for (int ch = 0; ch < numChannels; ++ch) {
         std::memset(outputs[ch], 0, sizeof(float) * numSamples);
     }
 
-    // Process active voices
-    for (auto& voice : voices_) {
-        if (voice->active) {
-            // Update envelope
-            updateVoiceEnvelope(voice.get(), numSamples);
+    outputSilent_ = true;
+    outputPeak_ = 0.0f;
+
+    // Nothing sounding and nothing to start: the cleared block is the output
+    if (numEvents == 0 && activeVoiceCount_.load(std::memory_order_relaxed) == 0
+        && reverb_.isIdle()) {
+        snapSmoothers();  // inaudible while silent
+        return;
+    }
+
+    // Render up to each event boundary, then apply the event
+    int position = 0;
+    for (int e = 0; e < numEvents; ++e) {
+        int offset = std::min(static_cast<int>(events[e].sampleOffset), numSamples);
+        if (offset > position) {
+            renderSegment(outputs, numChannels, position, offset - position);
+            position = offset;
+        }
+        handleEvent(events[e]);
+    }
+
+    if (position < numSamples) {
+        renderSegment(outputs, numChannels, position, numSamples - position);
+    }
+
+    if (Telemetry::ENABLED) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            telemetry_.countDenormals(outputs[ch], numSamples);
+        }
+    }
+}
 
-            // Generate sound based on category
-            mixVoiceToOutput(voice.get(), outputs, numChannels, numSamples);
+bool NatureDSP::scheduleEvent(const ScheduledEvent& event) {
+    return pendingEvents_.pushOrFlush(event, *this);
+}
 
-            // Free voice if release finished
-            if (voice->phase == VoiceState::Phase::Idle) {
-                voice->active = false;
-                activeVoiceCount_.fetch_sub(1);
+void NatureDSP::renderSegment(float** outputs, int numChannels, int startSample, int numSamples) {
+    // Offset channel pointers into the current sub-block
+    numChannels = std::min(numChannels, MAX_OUTPUT_CHANNELS);
+    float* segment[MAX_OUTPUT_CHANNELS] = {};
+    for (int ch = 0; ch < numChannels; ++ch) {
+        segment[ch] = outputs[ch] + startSample;
+    }
+    outputs = segment;
+
+    // Process active voices in scratch-sized chunks
+    float segmentPeak = 0.0f;
+    {
+        Telemetry::Scope voicesScope(telemetry_, TelemetryStage::Voices);
+        for (int offset = 0; offset < numSamples; offset += RENDER_CHUNK_SIZE) {
+            int chunkSize = std::min(RENDER_CHUNK_SIZE, numSamples - offset);
+            float* chunk[MAX_OUTPUT_CHANNELS] = {};
+            for (int ch = 0; ch < numChannels; ++ch) {
+                chunk[ch] = outputs[ch] + offset;
             }
+
+            for (auto& voice : voices_) {
+                if (voice.active) {
+                    renderVoice(&voice, chunk, numChannels, chunkSize);
+                    if (!voice.silent) {
+                        segmentPeak = std::max(segmentPeak, voice.peak);
+                    }
+                }
+            }
+        }
+
+        // Fade-out of recently stolen voices
+        if (stealFadeLength_ > 0) {
+            segmentPeak = std::max(segmentPeak, stealFadePeak_);
+            mixStealFade(outputs, numChannels, numSamples);
         }
     }
 
+    // Silent voices were not mixed, so the segment is still all zeros
+    const bool segmentSilent = segmentPeak < SILENCE_THRESHOLD;
+
+    // Smoothed parameters advance once per segment and ramp linearly within it
+    const float levelStart = masterLevelSmoother_.getCurrent();
+    const float levelEnd = masterLevelSmoother_.advance(numSamples);
+    const float mixStart = reverbMixSmoother_.getCurrent();
+    const float mixEnd = reverbMixSmoother_.advance(numSamples);
+    const float damping = reverbDampingSmoother_.advance(numSamples);
+
     // Apply master level
-    for (int ch = 0; ch < numChannels; ++ch) {
-        for (int i = 0; i < numSamples; ++i) {
-            outputs[ch][i] *= masterLevel_;
+    if (!segmentSilent) {
+        const float levelStep = (levelEnd - levelStart) / static_cast<float>(numSamples);
+        for (int ch = 0; ch < numChannels; ++ch) {
+            for (int i = 0; i < numSamples; ++i) {
+                outputs[ch][i] *= levelStart + levelStep * static_cast<float>(i + 1);
+            }
         }
+        outputPeak_ = std::max(outputPeak_, segmentPeak * std::max(levelStart, levelEnd));
     }
 
-    // Apply reverb
-    reverb_.process(outputs[0], outputs[1], numSamples,
-                    reverbMix_, reverbRoomSize_, reverbDamping_);
+    // Apply reverb (bypasses itself once the tail has decayed)
+    if (!segmentSilent || !reverb_.isIdle()) {
+        Telemetry::Scope reverbScope(telemetry_, TelemetryStage::Reverb);
+        reverb_.process(outputs[0], numChannels > 1 ? outputs[1] : nullptr, numSamples,
+                        mixStart, mixEnd, reverbRoomSize_, damping);
+        outputSilent_ = false;
+    }
 }
 
 void NatureDSP::handleEvent(const ScheduledEvent& event) {
@@ -148,8 +237,9 @@ void NatureDSP::handleEvent(const ScheduledEvent& event) {
                 }
 
                 voice->active = true;
-                voice->midiNote = event.data.note.midiNote;
+                mapNote(voice, event.data.note.midiNote);
                 voice->velocity = event.data.note.velocity;
+                voice->startOrder = ++noteOnCounter_;
 
                 // Map MIDI note to category and sound
                 int note = event.data.note.midiNote;
@@ -167,9 +257,17 @@ void NatureDSP::handleEvent(const ScheduledEvent& event) {
                     voice->soundIndex = 0;
                 }
 
+                // Fresh and stolen voices start from clean synthesis state;
+                // retriggers keep their running LFO/filter state to avoid clicks
+                if (!existingVoice) {
+                    voice->synth = VoiceSynthState{};
+                }
+
                 // Start attack
-                voice->phase = VoiceState::Phase::Attack;
-                voice->amplitude = 0.0f;
+                int index = voiceIndex(voice);
+                envelopes_.setRates(index, ENV_ATTACK_RATE, ENV_DECAY_RATE,
+                                    ENV_SUSTAIN_LEVEL, ENV_RELEASE_RATE);
+                envelopes_.noteOn(index);
             }
             break;
         }
@@ -177,7 +275,7 @@ void NatureDSP::handleEvent(const ScheduledEvent& event) {
         case ScheduledEvent::NOTE_OFF: {
             auto voice = findVoice(event.data.note.midiNote);
             if (voice && voice->active) {
-                voice->phase = VoiceState::Phase::Release;
+                envelopes_.noteOff(voiceIndex(voice));
             }
             break;
         }
@@ -187,6 +285,13 @@ void NatureDSP::handleEvent(const ScheduledEvent& event) {
             break;
         }
 
+        case ScheduledEvent::CONTROL_CHANGE: {
+            if (event.data.controlChange.controllerNumber == MIDI_CC_ALL_NOTES_OFF) {
+                allNotesOff();
+            }
+            break;
+        }
+
         case ScheduledEvent::RESET: {
             panic();
             break;
@@ -198,27 +303,58 @@ void NatureDSP::handleEvent(const ScheduledEvent& event) {
 }
 
 float NatureDSP::getParameter(const char* paramId) const {
-    if (std::strcmp(paramId, PARAM_MASTER_LEVEL) == 0) {
-        return masterLevel_;
-    } else if (std::strcmp(paramId, PARAM_REVERB_MIX) == 0) {
-        return reverbMix_;
-    } else if (std::strcmp(paramId, PARAM_REVERB_ROOM_SIZE) == 0) {
-        return reverbRoomSize_;
-    } else if (std::strcmp(paramId, PARAM_REVERB_DAMPING) == 0) {
-        return reverbDamping_;
-    }
-    return 0.0f;
+    return getParameter(getParameterIndex(paramId));
 }
 
 void NatureDSP::setParameter(const char* paramId, float value) {
-    if (std::strcmp(paramId, PARAM_MASTER_LEVEL) == 0) {
-        masterLevel_ = clamp(value, 0.0f, 1.0f);
-    } else if (std::strcmp(paramId, PARAM_REVERB_MIX) == 0) {
-        reverbMix_ = clamp(value, 0.0f, 1.0f);
-    } else if (std::strcmp(paramId, PARAM_REVERB_ROOM_SIZE) == 0) {
-        reverbRoomSize_ = clamp(value, 0.0f, 1.0f);
-    } else if (std::strcmp(paramId, PARAM_REVERB_DAMPING) == 0) {
-        reverbDamping_ = clamp(value, 0.0f, 1.0f);
+    setParameter(getParameterIndex(paramId), value);
+}
+
+float NatureDSP::getParameter(int index) const {
+    // A value published by the host but not yet applied is the current one
+    float pending = 0.0f;
+    if (hostParameters_.peek(index, pending)) {
+        return pending;
+    }
+
+    switch (index) {
+        case PARAM_INDEX_MASTER_LEVEL:
+            return masterLevel_;
+        case PARAM_INDEX_REVERB_MIX:
+            return reverbMix_;
+        case PARAM_INDEX_REVERB_ROOM_SIZE:
+            return reverbRoomSize_;
+        case PARAM_INDEX_REVERB_DAMPING:
+            return reverbDamping_;
+        case PARAM_INDEX_REVERB_HALF_RATE:
+            return reverb_.isHalfRate() ? 1.0f : 0.0f;
+        default:
+            return 0.0f;
+    }
+}
+
+void NatureDSP::setParameter(int index, float value) {
+    switch (index) {
+        case PARAM_INDEX_MASTER_LEVEL:
+            masterLevel_ = clamp(value, 0.0f, 1.0f);
+            masterLevelSmoother_.setTarget(masterLevel_);
+            break;
+        case PARAM_INDEX_REVERB_MIX:
+            reverbMix_ = clamp(value, 0.0f, 1.0f);
+            reverbMixSmoother_.setTarget(reverbMix_);
+            break;
+        case PARAM_INDEX_REVERB_ROOM_SIZE:
+            reverbRoomSize_ = clamp(value, 0.0f, 1.0f);
+            break;
+        case PARAM_INDEX_REVERB_DAMPING:
+            reverbDamping_ = clamp(value, 0.0f, 1.0f);
+            reverbDampingSmoother_.setTarget(reverbDamping_);
+            break;
+        case PARAM_INDEX_REVERB_HALF_RATE:
+            reverb_.setHalfRate(value >= 0.5f);
+            break;
+        default:
+            break;
     }
 }
 
@@ -232,32 +368,33 @@ bool NatureDSP::savePreset(char* jsonBuffer, int jsonBufferSize) const {
     "}";
 
     int written = std::snprintf(jsonBuffer, jsonBufferSize, format,
-                                masterLevel_, reverbMix_,
-                                reverbRoomSize_, reverbDamping_);
+                                getParameter(PARAM_INDEX_MASTER_LEVEL),
+                                getParameter(PARAM_INDEX_REVERB_MIX),
+                                getParameter(PARAM_INDEX_REVERB_ROOM_SIZE),
+                                getParameter(PARAM_INDEX_REVERB_DAMPING));
 
     return (written > 0 && written < jsonBufferSize);
 }
 
 bool NatureDSP::loadPreset(const char* jsonData) {
-    // Simple JSON parsing (basic implementation)
-    // In production, use a proper JSON parser
-    float masterLevel = 0.8f;
-    float reverbMix = 0.15f;
-    float reverbRoomSize = 0.5f;
-    float reverbDamping = 0.5f;
+    Preset preset;
+    if (compilePreset(jsonData, preset) == 0) {
+        return false;
+    }
+
+    // Hosts load state off the audio thread: hand over like automation
+    publishPreset(preset);
+    return true;
+}
 
-    if (std::sscanf(jsonData,
-                    "{ \"master_level\":%f, \"reverb_mix\":%f, "
-                    "\"reverb_room_size\":%f, \"reverb_damping\":%f }",
-                    &masterLevel, &reverbMix, &reverbRoomSize, &reverbDamping) == 4) {
-        masterLevel_ = masterLevel;
-        reverbMix_ = reverbMix;
-        reverbRoomSize_ = reverbRoomSize;
-        reverbDamping_ = reverbDamping;
-        return true;
+bool NatureDSP::loadBinaryPreset(const void* data, size_t size) {
+    Preset preset;
+    if (!preset.readBinary(data, size, PARAMETERS.layoutHash())) {
+        return false;
     }
 
-    return false;
+    publishPreset(preset);
+    return true;
 }
 
 int NatureDSP::getActiveVoiceCount() const {
@@ -268,13 +405,24 @@ int NatureDSP::getMaxPolyphony() const {
     return MAX_VOICES;
 }
 
+void NatureDSP::allNotesOff() {
+    // Held notes move to release; tails ring out
+    for (auto& voice : voices_) {
+        if (voice.active) {
+            envelopes_.noteOff(voiceIndex(&voice));
+        }
+    }
+}
+
 void NatureDSP::panic() {
     for (auto& voice : voices_) {
-        voice->active = false;
-        voice->phase = VoiceState::Phase::Idle;
-        voice->amplitude = 0.0f;
+        voice.active = false;
     }
+    envelopes_.reset();
     activeVoiceCount_.store(0);
+    resetVoiceAllocator();
+    outputSilent_ = true;
+    outputPeak_ = 0.0f;
 }
 
 //==============================================================================
@@ -282,82 +430,200 @@ void NatureDSP::panic() {
 //==============================================================================
 
 NatureDSP::VoiceState* NatureDSP::allocateVoice() {
-    // Find free voice
-    for (auto& voice : voices_) {
-        if (!voice->active) {
-            return voice.get();
-        }
+    // Pop a free voice
+    if (freeListHead_ >= 0) {
+        VoiceState* voice = &voices_[freeListHead_];
+        freeListHead_ = voice->nextFree;
+        voice->nextFree = -1;
+        return voice;
     }
 
-    // Voice stealing: find oldest voice in release phase
+    // All voices busy: steal, fading the victim out instead of cutting it
+    telemetry_.addEvent(TelemetryEvent::VoiceSteal);
+    VoiceState* victim = selectVoiceToSteal();
+    renderStealFade(victim);
+    return victim;
+}
+
+NatureDSP::VoiceState* NatureDSP::selectVoiceToSteal() {
+    // Releasing voices go first (quietest wins). Otherwise weigh loudness
+    // against age so long-held, quiet layers go before fresh, loud ones;
+    // attacking voices count as full level since they are still rising.
+    VoiceState* best = nullptr;
+    bool bestReleasing = false;
+    float bestCost = 0.0f;
+
     for (auto& voice : voices_) {
-        if (voice->active && voice->phase == VoiceState::Phase::Release) {
-            return voice.get();
+        const int index = voiceIndex(&voice);
+        const auto phase = envelopes_.getPhase(index);
+        const bool releasing = (phase == EnvelopeBank::Phase::Release);
+        const float level = (phase == EnvelopeBank::Phase::Attack) ? 1.0f : envelopes_.getLevel(index);
+        const float loudness = level * std::max(voice.peak, SILENCE_THRESHOLD);
+
+        float cost = loudness;
+        if (!releasing) {
+            const float age = static_cast<float>(noteOnCounter_ - voice.startOrder);
+            cost = loudness / (1.0f + age);
+        }
+
+        if (best == nullptr || (releasing && !bestReleasing)
+            || (releasing == bestReleasing && cost < bestCost)) {
+            best = &voice;
+            bestReleasing = releasing;
+            bestCost = cost;
         }
     }
 
-    // All voices active, steal oldest
-    return voices_[0].get();
+    return best;
 }
 
 void NatureDSP::freeVoice(VoiceState* voice) {
+    int index = voiceIndex(voice);
+
     voice->active = false;
-    voice->phase = VoiceState::Phase::Idle;
-    voice->amplitude = 0.0f;
+    envelopes_.kill(index);
+
+    if (voice->midiNote >= 0 && voice->midiNote < NUM_MIDI_NOTES
+        && noteToVoice_[voice->midiNote] == index) {
+        noteToVoice_[voice->midiNote] = -1;
+    }
+
+    voice->nextFree = freeListHead_;
+    freeListHead_ = index;
+}
+
+void NatureDSP::resetVoiceAllocator() {
+    freeListHead_ = -1;
+    for (int i = MAX_VOICES - 1; i >= 0; --i) {
+        voices_[i].nextFree = freeListHead_;
+        freeListHead_ = i;
+    }
+    noteToVoice_.fill(-1);
+    noteOnCounter_ = 0;
+    stealFadeLength_ = 0;
+    stealFadePeak_ = 0.0f;
 }
 
 NatureDSP::VoiceState* NatureDSP::findVoice(int midiNote) {
-    for (auto& voice : voices_) {
-        if (voice->active && voice->midiNote == midiNote) {
-            return voice.get();
+    if (midiNote < 0 || midiNote >= NUM_MIDI_NOTES) {
+        return nullptr;
+    }
+
+    int index = noteToVoice_[midiNote];
+    if (index < 0) {
+        return nullptr;
+    }
+
+    VoiceState* voice = &voices_[index];
+    return (voice->active && voice->midiNote == midiNote) ? voice : nullptr;
+}
+
+void NatureDSP::mapNote(VoiceState* voice, int midiNote) {
+    int index = voiceIndex(voice);
+
+    // Drop the slot's previous note (stolen voices)
+    if (voice->midiNote >= 0 && voice->midiNote < NUM_MIDI_NOTES
+        && noteToVoice_[voice->midiNote] == index) {
+        noteToVoice_[voice->midiNote] = -1;
+    }
+
+    voice->midiNote = midiNote;
+    if (midiNote >= 0 && midiNote < NUM_MIDI_NOTES) {
+        noteToVoice_[midiNote] = static_cast<int8_t>(index);
+    }
+}
+
+void NatureDSP::renderStealFade(VoiceState* voice) {
+    // Render the victim's next STEAL_FADE_SAMPLES under a linear fade now,
+    // while its state is intact; the following segments mix it back in
+    int index = voiceIndex(voice);
+    envelopes_.render(index, gainRamp_, STEAL_FADE_SAMPLES);
+
+    float* scratch[MAX_OUTPUT_CHANNELS] = {};
+    for (int ch = 0; ch < MAX_OUTPUT_CHANNELS; ++ch) {
+        std::memset(voiceScratch_[ch], 0, sizeof(float) * STEAL_FADE_SAMPLES);
+        scratch[ch] = voiceScratch_[ch];
+    }
+    mixVoiceToOutput(voice, scratch, MAX_OUTPUT_CHANNELS, STEAL_FADE_SAMPLES);
+
+    // Keep any fade still playing, moved to the front
+    const int consumed = STEAL_FADE_SAMPLES - stealFadeLength_;
+    for (int ch = 0; ch < MAX_OUTPUT_CHANNELS; ++ch) {
+        if (stealFadeLength_ > 0 && consumed > 0) {
+            std::memmove(stealFade_[ch], stealFade_[ch] + consumed, sizeof(float) * stealFadeLength_);
         }
+        std::fill(stealFade_[ch] + stealFadeLength_, stealFade_[ch] + STEAL_FADE_SAMPLES, 0.0f);
     }
-    return nullptr;
+
+    constexpr float fadeStep = 1.0f / static_cast<float>(STEAL_FADE_SAMPLES);
+    for (int ch = 0; ch < MAX_OUTPUT_CHANNELS; ++ch) {
+        for (int i = 0; i < STEAL_FADE_SAMPLES; ++i) {
+            const float fade = 1.0f - fadeStep * static_cast<float>(i + 1);
+            stealFade_[ch][i] += voiceScratch_[ch][i] * gainRamp_[i] * fade;
+        }
+    }
+
+    stealFadeLength_ = STEAL_FADE_SAMPLES;
+    stealFadePeak_ = std::max(stealFadePeak_, voice->peak);
 }
 
-void NatureDSP::updateVoiceEnvelope(VoiceState* voice, int numSamples) {
-    if (!voice->active) return;
+void NatureDSP::mixStealFade(float** outputs, int numChannels, int numSamples) {
+    // stealFade_ holds the remaining stealFadeLength_ samples at its tail end
+    const int count = std::min(numSamples, stealFadeLength_);
+    const int start = STEAL_FADE_SAMPLES - stealFadeLength_;
 
-    for (int i = 0; i < numSamples; ++i) {
-        switch (voice->phase) {
-            case VoiceState::Phase::Attack:
-                voice->amplitude += voice->attackRate;
-                if (voice->amplitude >= 1.0f) {
-                    voice->amplitude = 1.0f;
-                    voice->phase = VoiceState::Phase::Decay;
-                }
-                break;
+    for (int ch = 0; ch < numChannels; ++ch) {
+        const float* src = stealFade_[ch] + start;
+        for (int i = 0; i < count; ++i) {
+            outputs[ch][i] += src[i];
+        }
+    }
 
-            case VoiceState::Phase::Decay:
-                voice->amplitude -= voice->decayRate;
-                if (voice->amplitude <= voice->sustainLevel) {
-                    voice->amplitude = voice->sustainLevel;
-                    voice->phase = VoiceState::Phase::Sustain;
-                }
-                break;
+    stealFadeLength_ -= count;
+    if (stealFadeLength_ == 0) {
+        stealFadePeak_ = 0.0f;
+    }
+}
 
-            case VoiceState::Phase::Sustain:
-                // Sustain level is constant
-                break;
+void NatureDSP::renderVoice(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
+    int index = voiceIndex(voice);
 
-            case VoiceState::Phase::Release:
-                voice->amplitude -= voice->releaseRate;
-                if (voice->amplitude <= 0.0f) {
-                    voice->amplitude = 0.0f;
-                    voice->phase = VoiceState::Phase::Idle;
-                }
-                break;
+    // Per-sample envelope gain for this chunk
+    envelopes_.render(index, gainRamp_, numSamples);
 
-            case VoiceState::Phase::Idle:
-                break;
+    // Render the voice at unit gain into scratch
+    float* scratch[MAX_OUTPUT_CHANNELS] = {};
+    for (int ch = 0; ch < numChannels; ++ch) {
+        std::memset(voiceScratch_[ch], 0, sizeof(float) * numSamples);
+        scratch[ch] = voiceScratch_[ch];
+    }
+    mixVoiceToOutput(voice, scratch, numChannels, numSamples);
+
+    // Peak estimate: source peak times envelope peak over the chunk
+    float sourcePeak = 0.0f;
+    for (int ch = 0; ch < numChannels; ++ch) {
+        sourcePeak = std::max(sourcePeak, kernels_->peak(voiceScratch_[ch], numSamples));
+    }
+    const float gainPeak = kernels_->peak(gainRamp_, numSamples);  // envelope gains are >= 0
+    voice->peak = sourcePeak * gainPeak;
+    voice->silent = voice->peak < SILENCE_THRESHOLD;
+
+    // Apply envelope while summing into the output
+    if (!voice->silent) {
+        for (int ch = 0; ch < numChannels; ++ch) {
+            kernels_->multiplyAdd(outputs[ch], voiceScratch_[ch], gainRamp_, numSamples);
         }
     }
+
+    // Free voice if release finished
+    if (envelopes_.isIdle(index)) {
+        freeVoice(voice);
+        activeVoiceCount_.fetch_sub(1);
+    }
 }
 
 void NatureDSP::mixVoiceToOutput(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
-    if (voice->amplitude <= 0.0f) return;
-
-    // Generate sound based on category
+    // Generate sound based on category (envelope is applied by renderVoice)
     switch (voice->category) {
         case SoundCategory::Water:
             generateWaterSound(voice, outputs, numChannels, numSamples);
@@ -382,138 +648,80 @@ void NatureDSP::mixVoiceToOutput(VoiceState* voice, float** outputs, int numChan
 
 void NatureDSP::generateWaterSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<WaterSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > WaterSynthesis::Drips) {
         soundType = WaterSynthesis::Rain;
     }
 
-    waterSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
+    waterSynth_.process(voice->synth.water, outputs, numChannels, numSamples,
+                        soundType, amplitude, voice->velocity);
 }
 
 void NatureDSP::generateWindSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<WindSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > WindSynthesis::Storm) {
         soundType = WindSynthesis::Breeze;
     }
 
-    windSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
+    windSynth_.process(voice->synth.wind, outputs, numChannels, numSamples,
+                       soundType, amplitude, voice->velocity);
 }
 
 void NatureDSP::generateInsectSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<InsectSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > InsectSynthesis::Swarm) {
         soundType = InsectSynthesis::Cricket;
     }
 
-    insectSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
+    insectSynth_.process(voice->synth.insect, outputs, numChannels, numSamples,
+                         soundType, amplitude, voice->velocity);
 }
 
 void NatureDSP::generateBirdSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<BirdSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > BirdSynthesis::Flock) {
         soundType = BirdSynthesis::Songbird;
     }
 
-    birdSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
+    birdSynth_.process(voice->synth.bird, outputs, numChannels, numSamples,
+                       soundType, amplitude, voice->velocity);
 }
 
 void NatureDSP::generateAmphibianSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<AmphibianSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > AmphibianSynthesis::TreeFrog) {
         soundType = AmphibianSynthesis::Frog;
     }
 
-    amphibianSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
+    amphibianSynth_.process(voice->synth.amphibian, outputs, numChannels, numSamples,
+                            soundType, amplitude, voice->velocity);
 }
 
 void NatureDSP::generateMammalSound(VoiceState* voice, float** outputs, int numChannels, int numSamples) {
     auto soundType = static_cast<MammalSynthesis::SoundType>(voice->soundIndex);
-    float amplitude = voice->amplitude * voice->velocity;
+    float amplitude = voice->velocity;
 
     // Clamp to valid range
     if (soundType > MammalSynthesis::Fox) {
         soundType = MammalSynthesis::Wolf;
     }
 
-    mammalSynth_->process(outputs, numChannels, numSamples, soundType, amplitude, voice->velocity, random_);
-}
-
-//==============================================================================
-// Reverb Implementation (Simple Schroeder Reverb)
-//==============================================================================
-
-void NatureDSP::ReverbState::init(double sr) {
-    sampleRate = sr;
-
-    // Set delay times (in samples) for 8 parallel comb filters
-    // Based on prime numbers for good diffusion
-    delayTimes = {{
-        static_cast<int>(sr * 0.030),  // 30ms
-        static_cast<int>(sr * 0.037),  // 37ms
-        static_cast<int>(sr * 0.047),  // 47ms
-        static_cast<int>(sr * 0.053),  // 53ms
-        static_cast<int>(sr * 0.061),  // 61ms
-        static_cast<int>(sr * 0.071),  // 71ms
-        static_cast<int>(sr * 0.079),  // 79ms
-        static_cast<int>(sr * 0.087)   // 87ms
-    }};
-
-    reset();
-}
-
-void NatureDSP::ReverbState::reset() {
-    delayLines.fill(0.0f);
-    dampingFilters.fill(0.0f);
-    writeIndex = 0;
-}
-
-void NatureDSP::ReverbState::process(float* outputL, float* outputR, int numSamples,
-                                     float mix, float roomSize, float damping) {
-    // Simple reverb using 8 parallel comb filters
-    float feedback = roomSize * 0.5f;
-    float damp = damping * 0.5f;
-
-    for (int i = 0; i < numSamples; ++i) {
-        float input = (outputL[i] + outputR[i]) * 0.5f;
-        float output = 0.0f;
-
-        for (int j = 0; j < 8; ++j) {
-            // Read from delay line
-            int readIndex = (writeIndex - delayTimes[j] + 65536) % 65536;
-            float delayed = delayLines[j];
-
-            // Apply damping filter
-            dampingFilters[j] = delayed * (1.0f - damp) + dampingFilters[j] * damp;
-
-            // Write to delay line with feedback
-            delayLines[j] = input + dampingFilters[j] * feedback;
-
-            output += delayed;
-        }
-
-        output *= 0.125f;  // Mix 8 parallel lines
-
-        // Mix wet/dry
-        outputL[i] = outputL[i] * (1.0f - mix) + output * mix;
-        outputR[i] = outputR[i] * (1.0f - mix) + output * mix;
-
-        // Advance write index
-        writeIndex = (writeIndex + 1) % 65536;
-    }
+    mammalSynth_.process(voice->synth.mammal, outputs, numChannels, numSamples,
+                         soundType, amplitude, voice->velocity);
 }
 
 //==============================================================================
@@ -523,111 +731,104 @@ void NatureDSP::ReverbState::process(float* outputL, float* outputR, int numSamp
 void WaterSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
+    noise_.seed(static_cast<uint32_t>(rng.nextFloat() * 16777216.0f) + 1u);
 }
 
-void WaterSynthesis::reset() {
-    lfo_.phase = 0.0f;
-    lfo_.frequency = 0.5f;
-    lowpass_.z1 = 0.0f;
-    lowpass_.z2 = 0.0f;
-    bandpass_.z1 = 0.0f;
-    bandpass_.z2 = 0.0f;
-    grain_.position = 0.0f;
-}
-
-void WaterSynthesis::process(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                         SoundType soundType, float amplitude,
-                                        float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Rain:
-            generateRain(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Stream:
-            generateStream(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Ocean:
-            generateOcean(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Waterfall:
-            generateWaterfall(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Drips:
-            generateDrips(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                        float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Rain:
+                generateRain(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Stream:
+                generateStream(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Ocean:
+                generateOcean(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Waterfall:
+                generateWaterfall(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Drips:
+                generateDrips(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void WaterSynthesis::generateRain(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::generateRain(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float texture) {
     float noiseLevel = intensity * 0.3f;
     float cutoff = 3000.0f + texture * 2000.0f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
-
-        // Modulate with LFO for texture
-        float modulation = 1.0f + (texture * 0.5f * std::sin(lfo_.phase));
-        lfo_.phase += 2.0f * M_PI * lfo_.frequency / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
+    noise_.fill(noiseBuffer_, numSamples);
+    noise_.fill(auxBuffer_, numSamples);  // Per-sample pan jitter
+    renderSineLFO(s.lfo, 2.0f * M_PI * s.lfo.frequency / sampleRate_, lfoBuffer_, numSamples);
 
-        noise *= modulation * noiseLevel;
+    // Modulate with LFO for texture
+    for (int i = 0; i < numSamples; ++i) {
+        noiseBuffer_[i] *= (1.0f + texture * 0.5f * lfoBuffer_[i]) * noiseLevel;
+    }
 
-        // Lowpass filter
-        float filtered = processLowpass(noise, cutoff);
+    // Lowpass filter (cutoff is constant for the block)
+    processLowpassBlock(s.lowpass, OnePoleCoefficients::lowpass(cutoff, sampleRate_),
+                        noiseBuffer_, filterBuffer_, numSamples);
 
-        // Stereo output with slight pan
-        float panOffset = rng_->nextFloat() * 0.1f - 0.05f;
-        outputs[0][i] += filtered * (1.0f - panOffset);
+    // Stereo output with slight pan
+    for (int i = 0; i < numSamples; ++i) {
+        float panOffset = auxBuffer_[i] * 0.05f;
+        outputs[0][i] += filterBuffer_[i] * (1.0f - panOffset);
         if (numChannels > 1) {
-            outputs[1][i] += filtered * (1.0f + panOffset);
+            outputs[1][i] += filterBuffer_[i] * (1.0f + panOffset);
         }
     }
 }
 
-void WaterSynthesis::generateStream(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::generateStream(State& s, float** outputs, int numChannels, int numSamples,
                                                 float intensity, float texture) {
     float baseFreq = 500.0f + texture * 500.0f;
     float noiseLevel = intensity * 0.2f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
-
-        // Bandpass filter for stream character
-        float modFreq = baseFreq + texture * 100.0f * std::sin(lfo_.phase);
-        float filtered = processBandpass(noise, modFreq, 2.0f);
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * s.lfo.frequency / sampleRate_, lfoBuffer_, numSamples);
 
-        lfo_.phase += 2.0f * M_PI * lfo_.frequency / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
+    // Bandpass filter for stream character
+    processModulatedBandpassBlock(s.bandpass, noiseBuffer_, filterBuffer_, numSamples,
+                                  lfoBuffer_, baseFreq, texture * 100.0f, 2.0f, sampleRate_);
 
-        outputs[0][i] += filtered * noiseLevel;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += filterBuffer_[i] * noiseLevel;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel * 0.9f;
+            outputs[1][i] += filterBuffer_[i] * noiseLevel * 0.9f;
         }
     }
 }
 
-void WaterSynthesis::generateOcean(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::generateOcean(State& s, float** outputs, int numChannels, int numSamples,
                                                float intensity, float texture) {
     float lowFreq = 100.0f;
     float highFreq = 800.0f + texture * 400.0f;
     float noiseLevel = intensity * 0.25f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * 0.1f / sampleRate_, lfoBuffer_, numSamples);
 
-        // Dual filter for ocean character
-        float lowFiltered = processLowpass(noise, lowFreq);
-        float highFiltered = processBandpass(noise, highFreq, 1.0f);
+    // Dual filter for ocean character
+    processLowpassBlock(s.lowpass, OnePoleCoefficients::lowpass(lowFreq, sampleRate_),
+                        noiseBuffer_, auxBuffer_, numSamples);
+    processBandpassBlock(s.bandpass, ResonatorCoefficients::bandpass(highFreq, 1.0f, sampleRate_),
+                         noiseBuffer_, filterBuffer_, numSamples);
 
-        float ocean = lowFiltered * 0.6f + highFiltered * 0.4f;
+    for (int i = 0; i < numSamples; ++i) {
+        float ocean = auxBuffer_[i] * 0.6f + filterBuffer_[i] * 0.4f;
 
         // Modulate with LFO
-        float modulation = 1.0f + 0.3f * std::sin(lfo_.phase);
-        lfo_.phase += 2.0f * M_PI * 0.1f / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
-
-        ocean *= modulation * noiseLevel;
+        ocean *= (1.0f + 0.3f * lfoBuffer_[i]) * noiseLevel;
 
         outputs[0][i] += ocean;
         if (numChannels > 1) {
@@ -636,33 +837,33 @@ void WaterSynthesis::generateOcean(float** outputs, int numChannels, int numSamp
     }
 }
 
-void WaterSynthesis::generateWaterfall(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::generateWaterfall(State& s, float** outputs, int numChannels, int numSamples,
                                                    float intensity, float texture) {
     float baseFreq = 1000.0f + texture * 1000.0f;
     float noiseLevel = intensity * 0.3f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * 2.0f / sampleRate_, lfoBuffer_, numSamples);
 
-        // High-pass filtered noise for waterfall roar
-        float modFreq = baseFreq + texture * 200.0f * std::sin(lfo_.phase);
-        float filtered = processBandpass(noise, modFreq, 1.5f);
+    // Band-limited noise for waterfall roar
+    processModulatedBandpassBlock(s.bandpass, noiseBuffer_, filterBuffer_, numSamples,
+                                  lfoBuffer_, baseFreq, texture * 200.0f, 1.5f, sampleRate_);
 
-        lfo_.phase += 2.0f * M_PI * 2.0f / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
-
-        outputs[0][i] += filtered * noiseLevel;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += filterBuffer_[i] * noiseLevel;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel * 0.95f;
+            outputs[1][i] += filterBuffer_[i] * noiseLevel * 0.95f;
         }
     }
 }
 
-void WaterSynthesis::generateDrips(float** outputs, int numChannels, int numSamples,
+void WaterSynthesis::generateDrips(State& s, float** outputs, int numChannels, int numSamples,
                                                float intensity, float texture) {
     float dripRate = 2.0f + texture * 8.0f;  // Drips per second
     float samplesPerDrip = sampleRate_ / dripRate;
-    float sampleCounter = 0.0f;
+    float& sampleCounter = s.grain.position;  // Persists across blocks
+    DripState& drip = s.drip;                 // Bursts continue into the next block
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         sampleCounter += 1.0f;
@@ -670,61 +871,29 @@ void WaterSynthesis::generateDrips(float** outputs, int numChannels, int numSamp
         if (sampleCounter >= samplesPerDrip) {
             sampleCounter = 0.0f;
 
-            // Generate drip
-            float dripFreq = 800.0f + rng_->nextFloat() * 400.0f;
-            float dripAmp = intensity * (0.3f + rng_->nextFloat() * 0.2f);
-
-            // Short sine burst
-            int dripLength = static_cast<int>(sampleRate_ * 0.05f);  // 50ms
-            int endSample = std::min(i + dripLength, numSamples);
+            // Start a drip: short sine burst
+            drip.frequency = 800.0f + rng_->nextFloat() * 400.0f;
+            drip.amplitude = intensity * (0.3f + rng_->nextFloat() * 0.2f);
+            drip.length = static_cast<int>(sampleRate_ * 0.05f);  // 50ms
+            drip.elapsed = 0;
+        }
 
-            for (int j = i; j < endSample; ++j) {
-                float t = static_cast<float>(j - i) / dripLength;
-                float envelope = std::sin(t * M_PI);  // Half sine envelope
-                float drip = std::sin(2.0f * M_PI * dripFreq * t) * envelope * dripAmp;
+        if (drip.elapsed < drip.length) {
+            float t = static_cast<float>(drip.elapsed) / drip.length;
+            float envelope = sine.lookup(0.5f * t);  // Half sine envelope
+            float sample = sine.lookupWrapped(drip.frequency * t) * envelope * drip.amplitude;
+            ++drip.elapsed;
 
-                // Pan randomly
-                float pan = rng_->nextFloat() * 2.0f - 1.0f;
-                outputs[0][j] += drip * (1.0f - pan * 0.5f);
-                if (numChannels > 1) {
-                    outputs[1][j] += drip * (1.0f + pan * 0.5f);
-                }
+            // Pan randomly
+            float pan = rng_->nextFloat() * 2.0f - 1.0f;
+            outputs[0][i] += sample * (1.0f - pan * 0.5f);
+            if (numChannels > 1) {
+                outputs[1][i] += sample * (1.0f + pan * 0.5f);
             }
         }
     }
 }
 
-float WaterSynthesis::processLowpass(float input, float cutoff) {
-    float rc = 1.0f / (cutoff * 2.0f * M_PI);
-    float dt = 1.0f / sampleRate_;
-    float alpha = dt / (rc + dt);
-
-    float output = lowpass_.z1 + alpha * (input - lowpass_.z1);
-    lowpass_.z1 = output;
-
-    return output;
-}
-
-float WaterSynthesis::processBandpass(float input, float cutoff, float resonance) {
-    float omega = 2.0f * M_PI * cutoff / sampleRate_;
-    float alpha = std::sin(omega) / (2.0f * resonance);
-
-    float b0 = alpha;
-    float b1 = 0.0f;
-    float b2 = -alpha;
-    float a0 = 1.0f + alpha;
-    float a1 = -2.0f * std::cos(omega);
-    float a2 = 1.0f - alpha;
-
-    float output = (b0 * input + b1 * bandpass_.z1 + b2 * bandpass_.z2
-                    - a1 * bandpass_.z1 - a2 * bandpass_.z2) / a0;
-
-    bandpass_.z2 = bandpass_.z1;
-    bandpass_.z1 = output;
-
-    return output;
-}
-
 //==============================================================================
 // Wind Synthesis Implementation
 //==============================================================================
@@ -732,141 +901,116 @@ float WaterSynthesis::processBandpass(float input, float cutoff, float resonance
 void WindSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
-}
-
-void WindSynthesis::reset() {
-    lfo_.phase = 0.0f;
-    lfo_.frequency = 0.2f;
-    bandpass_.z1 = 0.0f;
-    bandpass_.z2 = 0.0f;
+    noise_.seed(static_cast<uint32_t>(rng.nextFloat() * 16777216.0f) + 1u);
 }
 
-void WindSynthesis::process(float** outputs, int numChannels, int numSamples,
+void WindSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                        SoundType soundType, float amplitude,
-                                       float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Breeze:
-            generateBreeze(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Gusts:
-            generateGusts(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Whistle:
-            generateWhistle(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Storm:
-            generateStorm(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                       float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Breeze:
+                generateBreeze(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Gusts:
+                generateGusts(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Whistle:
+                generateWhistle(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Storm:
+                generateStorm(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void WindSynthesis::generateBreeze(float** outputs, int numChannels, int numSamples,
+void WindSynthesis::generateBreeze(State& s, float** outputs, int numChannels, int numSamples,
                                                float intensity, float modulation) {
     float baseFreq = 400.0f + modulation * 200.0f;
     float noiseLevel = intensity * 0.15f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
-
-        // Modulate frequency with LFO
-        float modFreq = baseFreq + 50.0f * std::sin(lfo_.phase);
-        lfo_.phase += 2.0f * M_PI * lfo_.frequency / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * s.lfo.frequency / sampleRate_, lfoBuffer_, numSamples);
 
-        float filtered = processBandpass(noise, modFreq, 1.0f);
+    // Modulate frequency with LFO
+    processModulatedBandpassBlock(s.bandpass, noiseBuffer_, filterBuffer_, numSamples,
+                                  lfoBuffer_, baseFreq, 50.0f, 1.0f, sampleRate_);
 
-        outputs[0][i] += filtered * noiseLevel;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += filterBuffer_[i] * noiseLevel;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel;
+            outputs[1][i] += filterBuffer_[i] * noiseLevel;
         }
     }
 }
 
-void WindSynthesis::generateGusts(float** outputs, int numChannels, int numSamples,
+void WindSynthesis::generateGusts(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float gustSpeed) {
     float baseFreq = 300.0f;
     float noiseLevel = intensity * 0.2f;
     float gustFreq = 0.5f + gustSpeed * 1.0f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * gustFreq / sampleRate_, lfoBuffer_, numSamples);
 
-        // Modulate amplitude with slow LFO for gusts
-        float gustEnvelope = 0.5f + 0.5f * std::sin(lfo_.phase);
-        lfo_.phase += 2.0f * M_PI * gustFreq / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
+    // Gust envelope 0.5 + 0.5 * sin sweeps the band from base to base + 200 Hz
+    processModulatedBandpassBlock(s.bandpass, noiseBuffer_, filterBuffer_, numSamples,
+                                  lfoBuffer_, baseFreq + 100.0f, 100.0f, 1.0f, sampleRate_);
 
-        float modFreq = baseFreq + gustEnvelope * 200.0f;
-        float filtered = processBandpass(noise, modFreq, 1.0f);
+    for (int i = 0; i < numSamples; ++i) {
+        float gustEnvelope = 0.5f + 0.5f * lfoBuffer_[i];
+        float gust = filterBuffer_[i] * noiseLevel * gustEnvelope;
 
-        outputs[0][i] += filtered * noiseLevel * gustEnvelope;
+        outputs[0][i] += gust;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel * gustEnvelope;
+            outputs[1][i] += gust;
         }
     }
 }
 
-void WindSynthesis::generateWhistle(float** outputs, int numChannels, int numSamples,
+void WindSynthesis::generateWhistle(State& s, float** outputs, int numChannels, int numSamples,
                                                 float intensity, float frequency) {
     float baseFreq = 800.0f + frequency * 400.0f;
     float noiseLevel = intensity * 0.1f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
+    noise_.fill(noiseBuffer_, numSamples);
 
-        // Narrow bandpass for whistle
-        float filtered = processBandpass(noise, baseFreq, 5.0f);
+    // Narrow bandpass for whistle (fixed centre, coefficients once per block)
+    processBandpassBlock(s.bandpass, ResonatorCoefficients::bandpass(baseFreq, 5.0f, sampleRate_),
+                         noiseBuffer_, filterBuffer_, numSamples);
 
-        outputs[0][i] += filtered * noiseLevel;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += filterBuffer_[i] * noiseLevel;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel;
+            outputs[1][i] += filterBuffer_[i] * noiseLevel;
         }
     }
 }
 
-void WindSynthesis::generateStorm(float** outputs, int numChannels, int numSamples,
+void WindSynthesis::generateStorm(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float turbulence) {
     float baseFreq = 200.0f;
     float noiseLevel = intensity * 0.3f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        float noise = rng_->nextFloat() * 2.0f - 1.0f;
+    noise_.fill(noiseBuffer_, numSamples);
+    renderSineLFO(s.lfo, 2.0f * M_PI * 3.0f / sampleRate_, lfoBuffer_, numSamples);
 
-        // Wide modulation for storm
-        float modFreq = baseFreq + turbulence * 300.0f * std::sin(lfo_.phase);
-        lfo_.phase += 2.0f * M_PI * 3.0f / sampleRate_;
-        if (lfo_.phase >= 2.0f * M_PI) lfo_.phase -= 2.0f * M_PI;
+    // Wide modulation for storm
+    processModulatedBandpassBlock(s.bandpass, noiseBuffer_, filterBuffer_, numSamples,
+                                  lfoBuffer_, baseFreq, turbulence * 300.0f, 0.5f, sampleRate_);
 
-        float filtered = processBandpass(noise, modFreq, 0.5f);
-
-        outputs[0][i] += filtered * noiseLevel;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += filterBuffer_[i] * noiseLevel;
         if (numChannels > 1) {
-            outputs[1][i] += filtered * noiseLevel;
+            outputs[1][i] += filterBuffer_[i] * noiseLevel;
         }
     }
 }
 
-float WindSynthesis::processBandpass(float input, float cutoff, float resonance) {
-    float omega = 2.0f * M_PI * cutoff / sampleRate_;
-    float alpha = std::sin(omega) / (2.0f * resonance);
-
-    float b0 = alpha;
-    float b1 = 0.0f;
-    float b2 = -alpha;
-    float a0 = 1.0f + alpha;
-    float a1 = -2.0f * std::cos(omega);
-    float a2 = 1.0f - alpha;
-
-    float output = (b0 * input + b1 * bandpass_.z1 + b2 * bandpass_.z2
-                    - a1 * bandpass_.z1 - a2 * bandpass_.z2) / a0;
-
-    bandpass_.z2 = bandpass_.z1;
-    bandpass_.z1 = output;
-
-    return output;
-}
-
 //==============================================================================
 // Insect Synthesis Implementation
 //==============================================================================
@@ -874,60 +1018,52 @@ float WindSynthesis::processBandpass(float input, float cutoff, float resonance)
 void InsectSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
+    kernels_ = &selectSimdKernels();
 }
 
-void InsectSynthesis::reset() {
-    fm_.carrierPhase = 0.0f;
-    fm_.modulatorPhase = 0.0f;
-    am_.carrierPhase = 0.0f;
-    am_.modulatorPhase = 0.0f;
-}
-
-void InsectSynthesis::process(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                          SoundType soundType, float amplitude,
-                                         float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Cricket:
-            generateCricket(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Cicada:
-            generateCicada(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Bee:
-            generateBee(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Fly:
-            generateFly(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Mosquito:
-            generateMosquito(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Swarm:
-            generateSwarm(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                         float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Cricket:
+                generateCricket(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Cicada:
+                generateCicada(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Bee:
+                generateBee(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Fly:
+                generateFly(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Mosquito:
+                generateMosquito(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Swarm:
+                generateSwarm(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void InsectSynthesis::generateCricket(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateCricket(State& s, float** outputs, int numChannels, int numSamples,
                                                    float intensity, float pitch) {
     float carrierFreq = 4000.0f + pitch * 1000.0f;
     float modulatorFreq = 80.0f;
     float modulationIndex = 50.0f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        // FM synthesis
-        float modulator = std::sin(2.0f * M_PI * fm_.modulatorPhase);
-        float carrier = std::sin(2.0f * M_PI * fm_.carrierPhase + modulationIndex * modulator);
-
-        fm_.carrierPhase += carrierFreq / sampleRate_;
-        fm_.modulatorPhase += modulatorFreq / sampleRate_;
+    // FM synthesis
+    renderFMPair(s.fm.carrierPhase, s.fm.modulatorPhase,
+                 carrierFreq / sampleRate_, modulatorFreq / sampleRate_,
+                 modulationIndex, toneBuffer_, numSamples);
 
-        // Wrap phases
-        if (fm_.carrierPhase >= 1.0f) fm_.carrierPhase -= 1.0f;
-        if (fm_.modulatorPhase >= 1.0f) fm_.modulatorPhase -= 1.0f;
-
-        float cricket = carrier * intensity * 0.3f;
+    for (int i = 0; i < numSamples; ++i) {
+        float cricket = toneBuffer_[i] * intensity * 0.3f;
 
         outputs[0][i] += cricket;
         if (numChannels > 1) {
@@ -936,24 +1072,19 @@ void InsectSynthesis::generateCricket(float** outputs, int numChannels, int numS
     }
 }
 
-void InsectSynthesis::generateCicada(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateCicada(State& s, float** outputs, int numChannels, int numSamples,
                                                   float intensity, float pitch) {
     float carrierFreq = 5000.0f + pitch * 1500.0f;
     float modulatorFreq = 100.0f;
     float modulationIndex = 80.0f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        // FM synthesis with higher index for buzzing
-        float modulator = std::sin(2.0f * M_PI * fm_.modulatorPhase);
-        float carrier = std::sin(2.0f * M_PI * fm_.carrierPhase + modulationIndex * modulator);
-
-        fm_.carrierPhase += carrierFreq / sampleRate_;
-        fm_.modulatorPhase += modulatorFreq / sampleRate_;
-
-        if (fm_.carrierPhase >= 1.0f) fm_.carrierPhase -= 1.0f;
-        if (fm_.modulatorPhase >= 1.0f) fm_.modulatorPhase -= 1.0f;
+    // FM synthesis with higher index for buzzing
+    renderFMPair(s.fm.carrierPhase, s.fm.modulatorPhase,
+                 carrierFreq / sampleRate_, modulatorFreq / sampleRate_,
+                 modulationIndex, toneBuffer_, numSamples);
 
-        float cicada = carrier * intensity * 0.25f;
+    for (int i = 0; i < numSamples; ++i) {
+        float cicada = toneBuffer_[i] * intensity * 0.25f;
 
         outputs[0][i] += cicada;
         if (numChannels > 1) {
@@ -962,21 +1093,22 @@ void InsectSynthesis::generateCicada(float** outputs, int numChannels, int numSa
     }
 }
 
-void InsectSynthesis::generateBee(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateBee(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float pitch) {
     float carrierFreq = 150.0f + pitch * 50.0f;
     float modulatorFreq = 20.0f;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         // Sawtooth + AM synthesis
-        float sawtooth = generateSawtooth(am_.carrierPhase);
-        float modulator = std::sin(2.0f * M_PI * am_.modulatorPhase);
+        float sawtooth = generateSawtooth(s.am.carrierPhase);
+        float modulator = sine.lookup(s.am.modulatorPhase);
 
-        am_.carrierPhase += carrierFreq / sampleRate_;
-        am_.modulatorPhase += modulatorFreq / sampleRate_;
+        s.am.carrierPhase += carrierFreq / sampleRate_;
+        s.am.modulatorPhase += modulatorFreq / sampleRate_;
 
-        if (am_.carrierPhase >= 1.0f) am_.carrierPhase -= 1.0f;
-        if (am_.modulatorPhase >= 1.0f) am_.modulatorPhase -= 1.0f;
+        if (s.am.carrierPhase >= 1.0f) s.am.carrierPhase -= 1.0f;
+        if (s.am.modulatorPhase >= 1.0f) s.am.modulatorPhase -= 1.0f;
 
         float bee = sawtooth * (1.0f + 0.5f * modulator) * intensity * 0.2f;
 
@@ -987,21 +1119,22 @@ void InsectSynthesis::generateBee(float** outputs, int numChannels, int numSampl
     }
 }
 
-void InsectSynthesis::generateFly(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateFly(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float pitch) {
     float carrierFreq = 100.0f + pitch * 30.0f;
     float modulatorFreq = 15.0f;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         // Sawtooth + AM synthesis with higher modulation
-        float sawtooth = generateSawtooth(am_.carrierPhase);
-        float modulator = std::sin(2.0f * M_PI * am_.modulatorPhase);
+        float sawtooth = generateSawtooth(s.am.carrierPhase);
+        float modulator = sine.lookup(s.am.modulatorPhase);
 
-        am_.carrierPhase += carrierFreq / sampleRate_;
-        am_.modulatorPhase += modulatorFreq / sampleRate_;
+        s.am.carrierPhase += carrierFreq / sampleRate_;
+        s.am.modulatorPhase += modulatorFreq / sampleRate_;
 
-        if (am_.carrierPhase >= 1.0f) am_.carrierPhase -= 1.0f;
-        if (am_.modulatorPhase >= 1.0f) am_.modulatorPhase -= 1.0f;
+        if (s.am.carrierPhase >= 1.0f) s.am.carrierPhase -= 1.0f;
+        if (s.am.modulatorPhase >= 1.0f) s.am.modulatorPhase -= 1.0f;
 
         float fly = sawtooth * (1.0f + 0.8f * modulator) * intensity * 0.15f;
 
@@ -1012,21 +1145,22 @@ void InsectSynthesis::generateFly(float** outputs, int numChannels, int numSampl
     }
 }
 
-void InsectSynthesis::generateMosquito(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateMosquito(State& s, float** outputs, int numChannels, int numSamples,
                                                    float intensity, float pitch) {
     float carrierFreq = 800.0f + pitch * 200.0f;
     float modulatorFreq = 25.0f;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         // High-pitched sawtooth + AM
-        float sawtooth = generateSawtooth(am_.carrierPhase);
-        float modulator = std::sin(2.0f * M_PI * am_.modulatorPhase);
+        float sawtooth = generateSawtooth(s.am.carrierPhase);
+        float modulator = sine.lookup(s.am.modulatorPhase);
 
-        am_.carrierPhase += carrierFreq / sampleRate_;
-        am_.modulatorPhase += modulatorFreq / sampleRate_;
+        s.am.carrierPhase += carrierFreq / sampleRate_;
+        s.am.modulatorPhase += modulatorFreq / sampleRate_;
 
-        if (am_.carrierPhase >= 1.0f) am_.carrierPhase -= 1.0f;
-        if (am_.modulatorPhase >= 1.0f) am_.modulatorPhase -= 1.0f;
+        if (s.am.carrierPhase >= 1.0f) s.am.carrierPhase -= 1.0f;
+        if (s.am.modulatorPhase >= 1.0f) s.am.modulatorPhase -= 1.0f;
 
         float mosquito = sawtooth * (1.0f + 0.3f * modulator) * intensity * 0.1f;
 
@@ -1037,23 +1171,26 @@ void InsectSynthesis::generateMosquito(float** outputs, int numChannels, int num
     }
 }
 
-void InsectSynthesis::generateSwarm(float** outputs, int numChannels, int numSamples,
+void InsectSynthesis::generateSwarm(State& s, float** outputs, int numChannels, int numSamples,
                                                 float intensity, float density) {
     int numInsects = static_cast<int>(3 + density * 7);  // 3-10 insects
 
-    for (int insect = 0; insect < numInsects; ++insect) {
-        float insectFreq = 100.0f + rng_->nextFloat() * 4000.0f;
-        float insectPhase = rng_->nextFloat();
+    // Pick each insect's pitch once per note; phases then run continuously
+    if (s.swarm.size() != numInsects) {
+        s.swarm.clear();
+        for (int insect = 0; insect < numInsects; ++insect) {
+            float insectFreq = 100.0f + rng_->nextFloat() * 4000.0f;
+            s.swarm.add(insectFreq, rng_->nextFloat(), 1.0f, sampleRate_);
+        }
+    }
 
-        for (int i = 0; i < numSamples; ++i) {
-            float sound = std::sin(2.0f * M_PI * insectPhase);
-            insectPhase += insectFreq / sampleRate_;
-            if (insectPhase >= 1.0f) insectPhase -= 1.0f;
+    std::fill(toneBuffer_, toneBuffer_ + numSamples, 0.0f);
+    s.swarm.render(*kernels_, toneBuffer_, numSamples, intensity * 0.05f);
 
-            outputs[0][i] += sound * intensity * 0.05f;
-            if (numChannels > 1) {
-                outputs[1][i] += sound * intensity * 0.05f;
-            }
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += toneBuffer_[i];
+        if (numChannels > 1) {
+            outputs[1][i] += toneBuffer_[i];
         }
     }
 }
@@ -1073,52 +1210,46 @@ float InsectSynthesis::generateSquare(float phase) {
 void BirdSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
+    kernels_ = &selectSimdKernels();
 }
 
-void BirdSynthesis::reset() {
-    fm_.carrierPhase = 0.0f;
-    fm_.modulatorPhase = 0.0f;
-    formant_.phase = 0.0f;
-}
-
-void BirdSynthesis::process(float** outputs, int numChannels, int numSamples,
+void BirdSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                        SoundType soundType, float amplitude,
-                                       float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Songbird:
-            generateSongbird(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Owl:
-            generateOwl(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Crow:
-            generateCrow(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Flock:
-            generateFlock(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                       float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Songbird:
+                generateSongbird(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Owl:
+                generateOwl(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Crow:
+                generateCrow(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Flock:
+                generateFlock(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void BirdSynthesis::generateSongbird(float** outputs, int numChannels, int numSamples,
+void BirdSynthesis::generateSongbird(State& s, float** outputs, int numChannels, int numSamples,
                                                   float intensity, float pitch) {
     float carrierFreq = 2000.0f + pitch * 1000.0f;
     float modulatorFreq = 500.0f;
     float modulationIndex = 10.0f;
 
-    for (int i = 0; i < numSamples; ++i) {
-        // FM synthesis for melodic song
-        float modulator = std::sin(2.0f * M_PI * fm_.modulatorPhase);
-        float carrier = std::sin(2.0f * M_PI * fm_.carrierPhase + modulationIndex * modulator);
-
-        fm_.carrierPhase += carrierFreq / sampleRate_;
-        fm_.modulatorPhase += modulatorFreq / sampleRate_;
+    // FM synthesis for melodic song
+    renderFMPair(s.fm.carrierPhase, s.fm.modulatorPhase,
+                 carrierFreq / sampleRate_, modulatorFreq / sampleRate_,
+                 modulationIndex, toneBuffer_, numSamples);
 
-        if (fm_.carrierPhase >= 1.0f) fm_.carrierPhase -= 1.0f;
-        if (fm_.modulatorPhase >= 1.0f) fm_.modulatorPhase -= 1.0f;
-
-        float song = carrier * intensity * 0.2f;
+    for (int i = 0; i < numSamples; ++i) {
+        float song = toneBuffer_[i] * intensity * 0.2f;
 
         outputs[0][i] += song;
         if (numChannels > 1) {
@@ -1127,18 +1258,22 @@ void BirdSynthesis::generateSongbird(float** outputs, int numChannels, int numSa
     }
 }
 
-void BirdSynthesis::generateOwl(float** outputs, int numChannels, int numSamples,
+void BirdSynthesis::generateOwl(State& s, float** outputs, int numChannels, int numSamples,
                                             float intensity, float pitch) {
     float formantFreq = 400.0f + pitch * 200.0f;
     float pulseRate = 2.0f;  // 2 Hz hoot rate
+    float toneIncrement = formantFreq / sampleRate_;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         // Formant synthesis for hoot
-        float pulse = (formant_.phase < 0.1f) ? 1.0f : 0.0f;  // Pulse train
-        formant_.phase += pulseRate / sampleRate_;
-        if (formant_.phase >= 1.0f) formant_.phase -= 1.0f;
+        float pulse = (s.formant.phase < 0.1f) ? 1.0f : 0.0f;  // Pulse train
+        s.formant.phase += pulseRate / sampleRate_;
+        if (s.formant.phase >= 1.0f) s.formant.phase -= 1.0f;
 
-        float hoot = pulse * std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.3f;
+        float hoot = pulse * sine.lookup(s.formant.tonePhase) * intensity * 0.3f;
+        s.formant.tonePhase += toneIncrement;
+        if (s.formant.tonePhase >= 1.0f) s.formant.tonePhase -= 1.0f;
 
         outputs[0][i] += hoot;
         if (numChannels > 1) {
@@ -1147,16 +1282,20 @@ void BirdSynthesis::generateOwl(float** outputs, int numChannels, int numSamples
     }
 }
 
-void BirdSynthesis::generateCrow(float** outputs, int numChannels, int numSamples,
+void BirdSynthesis::generateCrow(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float pitch) {
     float baseFreq = 800.0f + pitch * 400.0f;
+    float toneIncrement = baseFreq / sampleRate_;
 
     for (int i = 0; i < numSamples; ++i) {
         // Sawtooth + noise for harsh caw
-        float phase = baseFreq * i / sampleRate_;
+        float phase = s.formant.tonePhase;
         float sawtooth = 2.0f * (phase - std::floor(phase + 0.5f));
         float noise = rng_->nextFloat() * 2.0f - 1.0f;
 
+        s.formant.tonePhase += toneIncrement;
+        if (s.formant.tonePhase >= 1.0f) s.formant.tonePhase -= 1.0f;
+
         float caw = (sawtooth * 0.7f + noise * 0.3f) * intensity * 0.25f;
 
         outputs[0][i] += caw;
@@ -1166,23 +1305,26 @@ void BirdSynthesis::generateCrow(float** outputs, int numChannels, int numSample
     }
 }
 
-void BirdSynthesis::generateFlock(float** outputs, int numChannels, int numSamples,
+void BirdSynthesis::generateFlock(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float density) {
     int numBirds = static_cast<int>(2 + density * 8);  // 2-10 birds
 
-    for (int bird = 0; bird < numBirds; ++bird) {
-        float birdFreq = 1500.0f + rng_->nextFloat() * 2000.0f;
-        float birdPhase = rng_->nextFloat();
+    // Pick each bird's pitch once per note; phases then run continuously
+    if (s.flock.size() != numBirds) {
+        s.flock.clear();
+        for (int bird = 0; bird < numBirds; ++bird) {
+            float birdFreq = 1500.0f + rng_->nextFloat() * 2000.0f;
+            s.flock.add(birdFreq, rng_->nextFloat(), 1.0f, sampleRate_);
+        }
+    }
 
-        for (int i = 0; i < numSamples; ++i) {
-            float sound = std::sin(2.0f * M_PI * birdPhase);
-            birdPhase += birdFreq / sampleRate_;
-            if (birdPhase >= 1.0f) birdPhase -= 1.0f;
+    std::fill(toneBuffer_, toneBuffer_ + numSamples, 0.0f);
+    s.flock.render(*kernels_, toneBuffer_, numSamples, intensity * 0.05f);
 
-            outputs[0][i] += sound * intensity * 0.05f;
-            if (numChannels > 1) {
-                outputs[1][i] += sound * intensity * 0.05f;
-            }
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += toneBuffer_[i];
+        if (numChannels > 1) {
+            outputs[1][i] += toneBuffer_[i];
         }
     }
 }
@@ -1194,82 +1336,67 @@ void BirdSynthesis::generateFlock(float** outputs, int numChannels, int numSampl
 void AmphibianSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
 }
 
-void AmphibianSynthesis::reset() {
-    formant_.phase = 0.0f;
-}
-
-void AmphibianSynthesis::process(float** outputs, int numChannels, int numSamples,
+void AmphibianSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                             SoundType soundType, float amplitude,
-                                            float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Frog:
-            generateFrog(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Toad:
-            generateToad(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case TreeFrog:
-            generateTreeFrog(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                            float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Frog:
+                generateFrog(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Toad:
+                generateToad(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case TreeFrog:
+                generateTreeFrog(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void AmphibianSynthesis::generateFrog(float** outputs, int numChannels, int numSamples,
+void AmphibianSynthesis::generateFrog(State& s, float** outputs, int numChannels, int numSamples,
                                                   float intensity, float pitch) {
-    float formantFreq = 150.0f + pitch * 100.0f;
-    float pulseRate = 3.0f;
-
-    for (int i = 0; i < numSamples; ++i) {
-        float pulse = (formant_.phase < 0.05f) ? 1.0f : 0.0f;
-        formant_.phase += pulseRate / sampleRate_;
-        if (formant_.phase >= 1.0f) formant_.phase -= 1.0f;
-
-        float croak = pulse * std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.3f;
-
-        outputs[0][i] += croak;
-        if (numChannels > 1) {
-            outputs[1][i] += croak;
-        }
-    }
+    generatePulsedTone(s, outputs, numChannels, numSamples,
+                       150.0f + pitch * 100.0f, 3.0f, 0.05f, intensity * 0.3f);
 }
 
-void AmphibianSynthesis::generateToad(float** outputs, int numChannels, int numSamples,
+void AmphibianSynthesis::generateToad(State& s, float** outputs, int numChannels, int numSamples,
                                                   float intensity, float pitch) {
-    float formantFreq = 100.0f + pitch * 50.0f;
-    float pulseRate = 2.0f;
-
-    for (int i = 0; i < numSamples; ++i) {
-        float pulse = (formant_.phase < 0.08f) ? 1.0f : 0.0f;
-        formant_.phase += pulseRate / sampleRate_;
-        if (formant_.phase >= 1.0f) formant_.phase -= 1.0f;
-
-        float croak = pulse * std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.3f;
-
-        outputs[0][i] += croak;
-        if (numChannels > 1) {
-            outputs[1][i] += croak;
-        }
-    }
+    generatePulsedTone(s, outputs, numChannels, numSamples,
+                       100.0f + pitch * 50.0f, 2.0f, 0.08f, intensity * 0.3f);
 }
 
-void AmphibianSynthesis::generateTreeFrog(float** outputs, int numChannels, int numSamples,
+void AmphibianSynthesis::generateTreeFrog(State& s, float** outputs, int numChannels, int numSamples,
                                                       float intensity, float pitch) {
-    float formantFreq = 2000.0f + pitch * 1000.0f;
-    float pulseRate = 5.0f;
+    generatePulsedTone(s, outputs, numChannels, numSamples,
+                       2000.0f + pitch * 1000.0f, 5.0f, 0.03f, intensity * 0.2f);
+}
+
+void AmphibianSynthesis::generatePulsedTone(State& s, float** outputs, int numChannels, int numSamples,
+                                            float toneFreq, float pulseRate, float pulseWidth,
+                                            float gain) {
+    float pulseIncrement = pulseRate / sampleRate_;
+    float toneIncrement = toneFreq / sampleRate_;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
-        float pulse = (formant_.phase < 0.03f) ? 1.0f : 0.0f;
-        formant_.phase += pulseRate / sampleRate_;
-        if (formant_.phase >= 1.0f) formant_.phase -= 1.0f;
+        // Gated tone: croak while the pulse phase is inside the duty cycle
+        float pulse = (s.formant.phase < pulseWidth) ? 1.0f : 0.0f;
+        s.formant.phase += pulseIncrement;
+        if (s.formant.phase >= 1.0f) s.formant.phase -= 1.0f;
 
-        float chirp = pulse * std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.2f;
+        float croak = pulse * sine.lookup(s.formant.tonePhase) * gain;
+        s.formant.tonePhase += toneIncrement;
+        if (s.formant.tonePhase >= 1.0f) s.formant.tonePhase -= 1.0f;
 
-        outputs[0][i] += chirp;
+        outputs[0][i] += croak;
         if (numChannels > 1) {
-            outputs[1][i] += chirp;
+            outputs[1][i] += croak;
         }
     }
 }
@@ -1281,40 +1408,47 @@ void AmphibianSynthesis::generateTreeFrog(float** outputs, int numChannels, int
 void MammalSynthesis::init(double sampleRate, RandomState& rng) {
     sampleRate_ = sampleRate;
     rng_ = &rng;
-    reset();
-}
-
-void MammalSynthesis::reset() {
-    formant_.phase = 0.0f;
 }
 
-void MammalSynthesis::process(float** outputs, int numChannels, int numSamples,
+void MammalSynthesis::process(State& state, float** outputs, int numChannels, int numSamples,
                                          SoundType soundType, float amplitude,
-                                         float velocity, RandomState& rng) {
-    switch (soundType) {
-        case Wolf:
-            generateWolf(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Coyote:
-            generateCoyote(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Deer:
-            generateDeer(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
-        case Fox:
-            generateFox(outputs, numChannels, numSamples, amplitude, velocity);
-            break;
+                                         float velocity) {
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        int blockSize = std::min(MAX_BLOCK_SIZE, numSamples - offset);
+        float* block[2] = { outputs[0] + offset, numChannels > 1 ? outputs[1] + offset : nullptr };
+
+        switch (soundType) {
+            case Wolf:
+                generateWolf(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Coyote:
+                generateCoyote(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Deer:
+                generateDeer(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+            case Fox:
+                generateFox(state, block, numChannels, blockSize, amplitude, velocity);
+                break;
+        }
     }
 }
 
-void MammalSynthesis::generateWolf(float** outputs, int numChannels, int numSamples,
+void MammalSynthesis::generateWolf(State& s, float** outputs, int numChannels, int numSamples,
                                                 float intensity, float pitch) {
     float formantFreq = 200.0f + pitch * 100.0f;
+    float vibratoIncrement = 5.0f / sampleRate_;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
         // Formant synthesis with vibrato
-        float vibrato = std::sin(2.0f * M_PI * 5.0f * i / sampleRate_);
-        float howl = std::sin(2.0f * M_PI * (formantFreq + vibrato * 20.0f) * i / sampleRate_) * intensity * 0.2f;
+        float vibrato = sine.lookup(s.formant.phase);
+        s.formant.phase += vibratoIncrement;
+        if (s.formant.phase >= 1.0f) s.formant.phase -= 1.0f;
+
+        float howl = sine.lookup(s.formant.tonePhase) * intensity * 0.2f;
+        s.formant.tonePhase += (formantFreq + vibrato * 20.0f) / sampleRate_;
+        if (s.formant.tonePhase >= 1.0f) s.formant.tonePhase -= 1.0f;
 
         outputs[0][i] += howl;
         if (numChannels > 1) {
@@ -1323,21 +1457,12 @@ void MammalSynthesis::generateWolf(float** outputs, int numChannels, int numSamp
     }
 }
 
-void MammalSynthesis::generateCoyote(float** outputs, int numChannels, int numSamples,
+void MammalSynthesis::generateCoyote(State& s, float** outputs, int numChannels, int numSamples,
                                                   float intensity, float pitch) {
-    float formantFreq = 300.0f + pitch * 150.0f;
-
-    for (int i = 0; i < numSamples; ++i) {
-        float yip = std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.15f;
-
-        outputs[0][i] += yip;
-        if (numChannels > 1) {
-            outputs[1][i] += yip;
-        }
-    }
+    generateTone(s, outputs, numChannels, numSamples, 300.0f + pitch * 150.0f, intensity * 0.15f);
 }
 
-void MammalSynthesis::generateDeer(float** outputs, int numChannels, int numSamples,
+void MammalSynthesis::generateDeer(State& s, float** outputs, int numChannels, int numSamples,
                                                 float intensity, float pitch) {
     // Deer snort (noise burst)
     for (int i = 0; i < numSamples; ++i) {
@@ -1351,16 +1476,26 @@ void MammalSynthesis::generateDeer(float** outputs, int numChannels, int numSamp
     }
 }
 
-void MammalSynthesis::generateFox(float** outputs, int numChannels, int numSamples,
+void MammalSynthesis::generateFox(State& s, float** outputs, int numChannels, int numSamples,
                                               float intensity, float pitch) {
-    float formantFreq = 400.0f + pitch * 200.0f;
+    generateTone(s, outputs, numChannels, numSamples, 400.0f + pitch * 200.0f, intensity * 0.2f);
+}
+
+void MammalSynthesis::generateTone(State& s, float** outputs, int numChannels, int numSamples,
+                                   float toneFreq, float gain) {
+    float toneIncrement = toneFreq / sampleRate_;
+    const auto& sine = SineTable::get();
 
     for (int i = 0; i < numSamples; ++i) {
-        float bark = std::sin(2.0f * M_PI * formantFreq * i / sampleRate_) * intensity * 0.2f;
+        toneBuffer_[i] = sine.lookup(s.formant.tonePhase) * gain;
+        s.formant.tonePhase += toneIncrement;
+        if (s.formant.tonePhase >= 1.0f) s.formant.tonePhase -= 1.0f;
+    }
 
-        outputs[0][i] += bark;
+    for (int i = 0; i < numSamples; ++i) {
+        outputs[0][i] += toneBuffer_[i];
         if (numChannels > 1) {
-            outputs[1][i] += bark;
+            outputs[1][i] += toneBuffer_[i];
         }
     }
 }
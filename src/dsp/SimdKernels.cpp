@@ -0,0 +1,228 @@
+/*
+ * SimdKernels.cpp
+ *
+ * CPU feature detection and kernel table selection
+ *
+ * x86: CPUID for the instruction sets plus XGETBV for the register state
+ * the OS saves (AVX needs YMM, AVX-512 needs opmask/ZMM). macOS enables
+ * AVX-512 state lazily on first use, so there the sysctl is authoritative.
+ * AArch64: NEON is architectural.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "dsp/SimdKernels.h"
+#include "simd/SimdKernelTables.h"
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define NATURE_SIMD_X86 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+    #if defined(__APPLE__)
+        #include <sys/sysctl.h>
+    #endif
+#endif
+
+namespace DSP {
+
+namespace {
+
+struct CpuFeatures
+{
+    bool sse2 = false;
+    bool avx2 = false;    // AVX2 + FMA with YMM state enabled
+    bool avx512 = false;  // AVX-512F with opmask / ZMM state enabled
+    bool neon = false;
+};
+
+#if defined(NATURE_SIMD_X86)
+void cpuid(unsigned leaf, unsigned subleaf, unsigned registers[4])
+{
+#if defined(_MSC_VER)
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        registers[i] = static_cast<unsigned>(values[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+uint64_t readXcr0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned low = 0, high = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+}
+
+#if defined(__APPLE__)
+bool sysctlFlag(const char* name)
+{
+    int value = 0;
+    size_t size = sizeof(value);
+    return sysctlbyname(name, &value, &size, nullptr, 0) == 0 && value != 0;
+}
+#endif
+#endif
+
+CpuFeatures queryCpuFeatures()
+{
+    CpuFeatures features;
+
+#if defined(NATURE_SIMD_X86)
+    unsigned leaf0[4], leaf1[4], leaf7[4] = {};
+    cpuid(0, 0, leaf0);
+    cpuid(1, 0, leaf1);
+    if (leaf0[0] >= 7) {
+        cpuid(7, 0, leaf7);
+    }
+
+    const unsigned ecx1 = leaf1[2], edx1 = leaf1[3], ebx7 = leaf7[1];
+    features.sse2 = (edx1 & (1u << 26)) != 0;
+
+    // XGETBV faults unless the OS has set OSXSAVE
+    const bool osxsave = (ecx1 & (1u << 27)) != 0;
+    const uint64_t xcr0 = osxsave ? readXcr0() : 0;
+    const bool ymmState = (xcr0 & 0x6) == 0x6;     // XMM | YMM
+    bool zmmState = (xcr0 & 0xe6) == 0xe6;         // XMM | YMM | opmask | ZMM_Hi256 | Hi16_ZMM
+
+    const bool avx = (ecx1 & (1u << 28)) != 0;
+    const bool fma = (ecx1 & (1u << 12)) != 0;
+    features.avx2 = avx && fma && ymmState && (ebx7 & (1u << 5)) != 0;
+
+    bool avx512f = (ebx7 & (1u << 16)) != 0;
+#if defined(__APPLE__)
+    avx512f = avx512f && sysctlFlag("hw.optional.avx512f");
+    zmmState = zmmState || avx512f;
+#endif
+    features.avx512 = features.avx2 && avx512f && zmmState;
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+    features.neon = true;
+#endif
+
+    return features;
+}
+
+const CpuFeatures& getCpuFeatures()
+{
+    static const CpuFeatures features = queryCpuFeatures();
+    return features;
+}
+
+constexpr int NO_OVERRIDE = -1;
+std::atomic<int> levelOverride{NO_OVERRIDE};
+
+/** NATURE_DSP_SIMD, read once */
+int getEnvironmentLevel()
+{
+    static const int level = [] {
+        SimdLevel parsed;
+        const char* text = std::getenv("NATURE_DSP_SIMD");
+        return (text != nullptr && parseSimdLevel(text, parsed)) ? static_cast<int>(parsed) : NO_OVERRIDE;
+    }();
+    return level;
+}
+
+} // namespace
+
+const SimdKernels& getSimdKernels(SimdLevel level)
+{
+    const CpuFeatures& cpu = getCpuFeatures();
+    const SimdKernels* kernels = nullptr;
+
+    if (level != SimdLevel::Scalar) {
+        // ARM has a single vector level: any vector request means NEON
+        if (cpu.neon) {
+            kernels = Simd::getNeonKernels();
+        }
+        if (kernels == nullptr && level == SimdLevel::AVX512 && cpu.avx512) {
+            kernels = Simd::getAvx512Kernels();
+        }
+        if (kernels == nullptr && (level == SimdLevel::AVX512 || level == SimdLevel::AVX2) && cpu.avx2) {
+            kernels = Simd::getAvx2Kernels();
+        }
+        if (kernels == nullptr && level != SimdLevel::NEON && cpu.sse2) {
+            kernels = Simd::getSse2Kernels();
+        }
+    }
+
+    return kernels != nullptr ? *kernels : *Simd::getScalarKernels();
+}
+
+SimdLevel detectSimdLevel()
+{
+    return getSimdKernels(SimdLevel::AVX512).level;
+}
+
+const SimdKernels& selectSimdKernels()
+{
+    int level = levelOverride.load(std::memory_order_acquire);
+    if (level == NO_OVERRIDE) {
+        level = getEnvironmentLevel();
+    }
+    return level == NO_OVERRIDE ? getSimdKernels(detectSimdLevel())
+                                : getSimdKernels(static_cast<SimdLevel>(level));
+}
+
+void setSimdLevelOverride(SimdLevel maximum)
+{
+    levelOverride.store(static_cast<int>(maximum), std::memory_order_release);
+}
+
+void clearSimdLevelOverride()
+{
+    levelOverride.store(NO_OVERRIDE, std::memory_order_release);
+}
+
+const char* getSimdLevelName(SimdLevel level)
+{
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2: return "sse2";
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::AVX512: return "avx512";
+        case SimdLevel::NEON: return "neon";
+    }
+    return "unknown";
+}
+
+bool parseSimdLevel(const char* text, SimdLevel& level)
+{
+    if (text == nullptr) {
+        return false;
+    }
+
+    char lower[16] = {};
+    for (size_t i = 0; text[i] != '\0'; ++i) {
+        if (i + 1 >= sizeof(lower)) {
+            return false;
+        }
+        lower[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(text[i])));
+    }
+
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2,
+                                 SimdLevel::AVX512, SimdLevel::NEON };
+    for (const SimdLevel candidate : levels) {
+        if (std::strcmp(lower, getSimdLevelName(candidate)) == 0) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace DSP
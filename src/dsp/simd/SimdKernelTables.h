@@ -0,0 +1,30 @@
+/*
+ * SimdKernelTables.h
+ *
+ * Per-ISA kernel tables behind DSP::selectSimdKernels()
+ *
+ * One function per translation unit; each returns nullptr when its ISA
+ * was not compiled into this build (other architecture, or the multi-ISA
+ * variants disabled). The ISA translation units must not call inline
+ * header code (std::min, std::abs, ...): the linker may keep any one
+ * compiled copy of an inline function, and an AVX2-compiled copy would
+ * then run on every CPU. They use intrinsics and plain arithmetic only.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "dsp/SimdKernels.h"
+
+namespace DSP {
+namespace Simd {
+
+const SimdKernels* getScalarKernels();
+const SimdKernels* getSse2Kernels();
+const SimdKernels* getAvx2Kernels();
+const SimdKernels* getAvx512Kernels();
+const SimdKernels* getNeonKernels();
+
+} // namespace Simd
+} // namespace DSP
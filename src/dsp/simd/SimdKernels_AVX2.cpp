@@ -0,0 +1,128 @@
+/*
+ * SimdKernels_AVX2.cpp
+ *
+ * AVX2 + FMA kernels (SimdLevel::AVX2), 8 samples per step
+ *
+ * Built with -mavx2 -mfma (/arch:AVX2) when NATURE_DSP_MULTI_ISA is on;
+ * only selected on CPUs (and OSes) that report AVX2, FMA and YMM state.
+ * The sine bank gathers both interpolation taps with vpgatherdd.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "SimdKernelTables.h"
+
+#if NATURE_DSP_MULTI_ISA && defined(__AVX2__) && defined(__FMA__)
+    #include <immintrin.h>
+    #define NATURE_SIMD_AVX2 1
+#endif
+
+namespace DSP {
+namespace Simd {
+
+#if defined(NATURE_SIMD_AVX2)
+namespace {
+
+void multiplyAdd(float* dst, const float* src, const float* gain, int numSamples)
+{
+    int i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const __m256 sum = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), _mm256_loadu_ps(gain + i),
+                                           _mm256_loadu_ps(dst + i));
+        _mm256_storeu_ps(dst + i, sum);
+    }
+    for (; i < numSamples; ++i) {
+        dst[i] += src[i] * gain[i];
+    }
+}
+
+float peak(const float* src, int numSamples)
+{
+    const __m256 vAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 vPeak = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        vPeak = _mm256_max_ps(vPeak, _mm256_and_ps(_mm256_loadu_ps(src + i), vAbsMask));
+    }
+
+    __m128 half = _mm_max_ps(_mm256_castps256_ps128(vPeak), _mm256_extractf128_ps(vPeak, 1));
+    half = _mm_max_ps(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(1, 0, 3, 2)));
+    half = _mm_max_ps(half, _mm_shuffle_ps(half, half, _MM_SHUFFLE(2, 3, 0, 1)));
+    float result = _mm_cvtss_f32(half);
+
+    for (; i < numSamples; ++i) {
+        const float magnitude = src[i] < 0.0f ? -src[i] : src[i];
+        result = magnitude > result ? magnitude : result;
+    }
+    return result;
+}
+
+void sineBank(const float* table, int tableSize, float* phases, const float* increments,
+              const float* gains, int count, float outputGain, float* output, int numSamples)
+{
+    const int mask = tableSize - 1;
+    const float size = static_cast<float>(tableSize);
+    const __m256 vSize = _mm256_set1_ps(size);
+    const __m256i vMask = _mm256_set1_epi32(mask);
+    const __m256 vLanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+
+    for (int k = 0; k < count; ++k) {
+        float phase = phases[k];
+        const float increment = increments[k];
+        const float gain = gains[k] * outputGain;
+        const __m256 vOffsets = _mm256_mul_ps(vLanes, _mm256_set1_ps(increment));
+        const __m256 vGain = _mm256_set1_ps(gain);
+        const float step = 8.0f * increment;
+
+        int i = 0;
+        for (; i + 8 <= numSamples; i += 8) {
+            // Phases are non-negative, so truncation is floor
+            __m256 p = _mm256_add_ps(_mm256_set1_ps(phase), vOffsets);
+            p = _mm256_sub_ps(p, _mm256_cvtepi32_ps(_mm256_cvttps_epi32(p)));
+
+            const __m256 position = _mm256_mul_ps(p, vSize);
+            __m256i index = _mm256_cvttps_epi32(position);
+            const __m256 frac = _mm256_sub_ps(position, _mm256_cvtepi32_ps(index));
+            index = _mm256_and_si256(index, vMask);
+
+            const __m256 a = _mm256_i32gather_ps(table, index, 4);
+            const __m256 b = _mm256_i32gather_ps(table + 1, index, 4);
+            const __m256 sine = _mm256_fmadd_ps(frac, _mm256_sub_ps(b, a), a);
+            _mm256_storeu_ps(output + i, _mm256_fmadd_ps(vGain, sine, _mm256_loadu_ps(output + i)));
+
+            phase += step;
+            phase -= static_cast<float>(static_cast<int>(phase));
+        }
+
+        for (; i < numSamples; ++i) {
+            const float position = phase * size;
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float a = table[index & mask];
+            const float b = table[(index & mask) + 1];
+            output[i] += gain * (a + frac * (b - a));
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        phases[k] = phase;
+    }
+}
+
+const SimdKernels KERNELS = { SimdLevel::AVX2, "avx2", multiplyAdd, peak, sineBank };
+
+} // namespace
+
+const SimdKernels* getAvx2Kernels()
+{
+    return &KERNELS;
+}
+#else
+const SimdKernels* getAvx2Kernels()
+{
+    return nullptr;
+}
+#endif
+
+} // namespace Simd
+} // namespace DSP
@@ -0,0 +1,124 @@
+/*
+ * SimdKernels_AVX512.cpp
+ *
+ * AVX-512F kernels (SimdLevel::AVX512), 16 samples per step
+ *
+ * Built with -mavx512f (/arch:AVX512) when NATURE_DSP_MULTI_ISA is on;
+ * only selected on CPUs that report AVX-512F and an OS that saves ZMM
+ * state (on macOS: hw.optional.avx512f).
+ *
+ * Created: January 19, 2026
+ */
+
+#include "SimdKernelTables.h"
+
+#if NATURE_DSP_MULTI_ISA && defined(__AVX512F__)
+    #include <immintrin.h>
+    #define NATURE_SIMD_AVX512 1
+#endif
+
+namespace DSP {
+namespace Simd {
+
+#if defined(NATURE_SIMD_AVX512)
+namespace {
+
+void multiplyAdd(float* dst, const float* src, const float* gain, int numSamples)
+{
+    int i = 0;
+    for (; i + 16 <= numSamples; i += 16) {
+        const __m512 sum = _mm512_fmadd_ps(_mm512_loadu_ps(src + i), _mm512_loadu_ps(gain + i),
+                                           _mm512_loadu_ps(dst + i));
+        _mm512_storeu_ps(dst + i, sum);
+    }
+    for (; i < numSamples; ++i) {
+        dst[i] += src[i] * gain[i];
+    }
+}
+
+float peak(const float* src, int numSamples)
+{
+    __m512 vPeak = _mm512_setzero_ps();
+    int i = 0;
+    for (; i + 16 <= numSamples; i += 16) {
+        vPeak = _mm512_max_ps(vPeak, _mm512_abs_ps(_mm512_loadu_ps(src + i)));
+    }
+    float result = _mm512_reduce_max_ps(vPeak);
+
+    for (; i < numSamples; ++i) {
+        const float magnitude = src[i] < 0.0f ? -src[i] : src[i];
+        result = magnitude > result ? magnitude : result;
+    }
+    return result;
+}
+
+void sineBank(const float* table, int tableSize, float* phases, const float* increments,
+              const float* gains, int count, float outputGain, float* output, int numSamples)
+{
+    const int mask = tableSize - 1;
+    const float size = static_cast<float>(tableSize);
+    const __m512 vSize = _mm512_set1_ps(size);
+    const __m512i vMask = _mm512_set1_epi32(mask);
+    const __m512 vLanes = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f,
+                                         8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+
+    for (int k = 0; k < count; ++k) {
+        float phase = phases[k];
+        const float increment = increments[k];
+        const float gain = gains[k] * outputGain;
+        const __m512 vOffsets = _mm512_mul_ps(vLanes, _mm512_set1_ps(increment));
+        const __m512 vGain = _mm512_set1_ps(gain);
+        const float step = 16.0f * increment;
+
+        int i = 0;
+        for (; i + 16 <= numSamples; i += 16) {
+            // Phases are non-negative, so truncation is floor
+            __m512 p = _mm512_add_ps(_mm512_set1_ps(phase), vOffsets);
+            p = _mm512_sub_ps(p, _mm512_cvtepi32_ps(_mm512_cvttps_epi32(p)));
+
+            const __m512 position = _mm512_mul_ps(p, vSize);
+            __m512i index = _mm512_cvttps_epi32(position);
+            const __m512 frac = _mm512_sub_ps(position, _mm512_cvtepi32_ps(index));
+            index = _mm512_and_si512(index, vMask);
+
+            const __m512 a = _mm512_i32gather_ps(index, table, 4);
+            const __m512 b = _mm512_i32gather_ps(index, table + 1, 4);
+            const __m512 sine = _mm512_fmadd_ps(frac, _mm512_sub_ps(b, a), a);
+            _mm512_storeu_ps(output + i, _mm512_fmadd_ps(vGain, sine, _mm512_loadu_ps(output + i)));
+
+            phase += step;
+            phase -= static_cast<float>(static_cast<int>(phase));
+        }
+
+        for (; i < numSamples; ++i) {
+            const float position = phase * size;
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float a = table[index & mask];
+            const float b = table[(index & mask) + 1];
+            output[i] += gain * (a + frac * (b - a));
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        phases[k] = phase;
+    }
+}
+
+const SimdKernels KERNELS = { SimdLevel::AVX512, "avx512", multiplyAdd, peak, sineBank };
+
+} // namespace
+
+const SimdKernels* getAvx512Kernels()
+{
+    return &KERNELS;
+}
+#else
+const SimdKernels* getAvx512Kernels()
+{
+    return nullptr;
+}
+#endif
+
+} // namespace Simd
+} // namespace DSP
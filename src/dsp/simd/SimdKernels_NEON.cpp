@@ -0,0 +1,129 @@
+/*
+ * SimdKernels_NEON.cpp
+ *
+ * NEON kernels (SimdLevel::NEON), 4 samples per step
+ *
+ * Advanced SIMD is mandatory on AArch64 (Apple Silicon, ARM servers), so
+ * no extra flags are needed there; on 32-bit ARM the variant exists only
+ * when the build targets NEON. NEON has no gather: the sine bank loads its
+ * taps per lane and interpolates four at a time.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "SimdKernelTables.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define NATURE_SIMD_NEON 1
+#endif
+
+namespace DSP {
+namespace Simd {
+
+#if defined(NATURE_SIMD_NEON)
+namespace {
+
+void multiplyAdd(float* dst, const float* src, const float* gain, int numSamples)
+{
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), vld1q_f32(gain + i)));
+    }
+    for (; i < numSamples; ++i) {
+        dst[i] += src[i] * gain[i];
+    }
+}
+
+float peak(const float* src, int numSamples)
+{
+    float32x4_t vPeak = vdupq_n_f32(0.0f);
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vPeak = vmaxq_f32(vPeak, vabsq_f32(vld1q_f32(src + i)));
+    }
+    float32x2_t pair = vpmax_f32(vget_low_f32(vPeak), vget_high_f32(vPeak));
+    pair = vpmax_f32(pair, pair);
+    float result = vget_lane_f32(pair, 0);
+
+    for (; i < numSamples; ++i) {
+        const float magnitude = src[i] < 0.0f ? -src[i] : src[i];
+        result = magnitude > result ? magnitude : result;
+    }
+    return result;
+}
+
+void sineBank(const float* table, int tableSize, float* phases, const float* increments,
+              const float* gains, int count, float outputGain, float* output, int numSamples)
+{
+    const int mask = tableSize - 1;
+    const float size = static_cast<float>(tableSize);
+    const float32x4_t vSize = vdupq_n_f32(size);
+    const int32x4_t vMask = vdupq_n_s32(mask);
+    const float laneSteps[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t vLanes = vld1q_f32(laneSteps);
+
+    for (int k = 0; k < count; ++k) {
+        float phase = phases[k];
+        const float increment = increments[k];
+        const float gain = gains[k] * outputGain;
+        const float32x4_t vOffsets = vmulq_n_f32(vLanes, increment);
+        const float step = 4.0f * increment;
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4) {
+            // Phases are non-negative, so truncation is floor
+            float32x4_t p = vaddq_f32(vdupq_n_f32(phase), vOffsets);
+            p = vsubq_f32(p, vcvtq_f32_s32(vcvtq_s32_f32(p)));
+
+            const float32x4_t position = vmulq_f32(p, vSize);
+            int32x4_t index = vcvtq_s32_f32(position);
+            const float32x4_t frac = vsubq_f32(position, vcvtq_f32_s32(index));
+            index = vandq_s32(index, vMask);
+
+            int lanes[4];
+            vst1q_s32(lanes, index);
+            const float taps[8] = { table[lanes[0]], table[lanes[1]], table[lanes[2]], table[lanes[3]],
+                                    table[lanes[0] + 1], table[lanes[1] + 1],
+                                    table[lanes[2] + 1], table[lanes[3] + 1] };
+            const float32x4_t a = vld1q_f32(taps);
+            const float32x4_t b = vld1q_f32(taps + 4);
+            const float32x4_t sine = vmlaq_f32(a, frac, vsubq_f32(b, a));
+            vst1q_f32(output + i, vmlaq_n_f32(vld1q_f32(output + i), sine, gain));
+
+            phase += step;
+            phase -= static_cast<float>(static_cast<int>(phase));
+        }
+
+        for (; i < numSamples; ++i) {
+            const float position = phase * size;
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float a = table[index & mask];
+            const float b = table[(index & mask) + 1];
+            output[i] += gain * (a + frac * (b - a));
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        phases[k] = phase;
+    }
+}
+
+const SimdKernels KERNELS = { SimdLevel::NEON, "neon", multiplyAdd, peak, sineBank };
+
+} // namespace
+
+const SimdKernels* getNeonKernels()
+{
+    return &KERNELS;
+}
+#else
+const SimdKernels* getNeonKernels()
+{
+    return nullptr;
+}
+#endif
+
+} // namespace Simd
+} // namespace DSP
@@ -0,0 +1,128 @@
+/*
+ * SimdKernels_SSE2.cpp
+ *
+ * SSE2 kernels (SimdLevel::SSE2), 4 samples per step
+ *
+ * The x86-64 baseline, so compiled without extra flags there (-msse2 on
+ * 32-bit x86). SSE2 has no gather: the sine bank loads its taps per lane
+ * and interpolates four at a time.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "SimdKernelTables.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define NATURE_SIMD_SSE2 1
+#endif
+
+namespace DSP {
+namespace Simd {
+
+#if defined(NATURE_SIMD_SSE2)
+namespace {
+
+void multiplyAdd(float* dst, const float* src, const float* gain, int numSamples)
+{
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        const __m128 product = _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(gain + i));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), product));
+    }
+    for (; i < numSamples; ++i) {
+        dst[i] += src[i] * gain[i];
+    }
+}
+
+float peak(const float* src, int numSamples)
+{
+    const __m128 vAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 vPeak = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vPeak = _mm_max_ps(vPeak, _mm_and_ps(_mm_loadu_ps(src + i), vAbsMask));
+    }
+    vPeak = _mm_max_ps(vPeak, _mm_shuffle_ps(vPeak, vPeak, _MM_SHUFFLE(1, 0, 3, 2)));
+    vPeak = _mm_max_ps(vPeak, _mm_shuffle_ps(vPeak, vPeak, _MM_SHUFFLE(2, 3, 0, 1)));
+    float result = _mm_cvtss_f32(vPeak);
+
+    for (; i < numSamples; ++i) {
+        const float magnitude = src[i] < 0.0f ? -src[i] : src[i];
+        result = magnitude > result ? magnitude : result;
+    }
+    return result;
+}
+
+void sineBank(const float* table, int tableSize, float* phases, const float* increments,
+              const float* gains, int count, float outputGain, float* output, int numSamples)
+{
+    const int mask = tableSize - 1;
+    const float size = static_cast<float>(tableSize);
+    const __m128 vSize = _mm_set1_ps(size);
+    const __m128i vMask = _mm_set1_epi32(mask);
+    const __m128 vLanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+
+    for (int k = 0; k < count; ++k) {
+        float phase = phases[k];
+        const float increment = increments[k];
+        const float gain = gains[k] * outputGain;
+        const __m128 vOffsets = _mm_mul_ps(vLanes, _mm_set1_ps(increment));
+        const __m128 vGain = _mm_set1_ps(gain);
+        const float step = 4.0f * increment;
+
+        int i = 0;
+        for (; i + 4 <= numSamples; i += 4) {
+            // Phases are non-negative, so truncation is floor
+            __m128 p = _mm_add_ps(_mm_set1_ps(phase), vOffsets);
+            p = _mm_sub_ps(p, _mm_cvtepi32_ps(_mm_cvttps_epi32(p)));
+
+            const __m128 position = _mm_mul_ps(p, vSize);
+            __m128i index = _mm_cvttps_epi32(position);
+            const __m128 frac = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+            index = _mm_and_si128(index, vMask);
+
+            alignas(16) int lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), index);
+            const __m128 a = _mm_setr_ps(table[lanes[0]], table[lanes[1]], table[lanes[2]], table[lanes[3]]);
+            const __m128 b = _mm_setr_ps(table[lanes[0] + 1], table[lanes[1] + 1],
+                                         table[lanes[2] + 1], table[lanes[3] + 1]);
+            const __m128 sine = _mm_add_ps(a, _mm_mul_ps(frac, _mm_sub_ps(b, a)));
+            _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i), _mm_mul_ps(vGain, sine)));
+
+            phase += step;
+            phase -= static_cast<float>(static_cast<int>(phase));
+        }
+
+        for (; i < numSamples; ++i) {
+            const float position = phase * size;
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float a = table[index & mask];
+            const float b = table[(index & mask) + 1];
+            output[i] += gain * (a + frac * (b - a));
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        phases[k] = phase;
+    }
+}
+
+const SimdKernels KERNELS = { SimdLevel::SSE2, "sse2", multiplyAdd, peak, sineBank };
+
+} // namespace
+
+const SimdKernels* getSse2Kernels()
+{
+    return &KERNELS;
+}
+#else
+const SimdKernels* getSse2Kernels()
+{
+    return nullptr;
+}
+#endif
+
+} // namespace Simd
+} // namespace DSP
@@ -0,0 +1,73 @@
+/*
+ * SimdKernels_Scalar.cpp
+ *
+ * Portable reference kernels (SimdLevel::Scalar)
+ *
+ * Always compiled with the baseline flags. The sine bank is the same loop
+ * as OscillatorBank::render(), so forcing Scalar reproduces the original
+ * output exactly.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "SimdKernelTables.h"
+
+namespace DSP {
+namespace Simd {
+
+namespace {
+
+void multiplyAdd(float* dst, const float* src, const float* gain, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i) {
+        dst[i] += src[i] * gain[i];
+    }
+}
+
+float peak(const float* src, int numSamples)
+{
+    float result = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        const float magnitude = src[i] < 0.0f ? -src[i] : src[i];
+        result = magnitude > result ? magnitude : result;
+    }
+    return result;
+}
+
+void sineBank(const float* table, int tableSize, float* phases, const float* increments,
+              const float* gains, int count, float outputGain, float* output, int numSamples)
+{
+    const int mask = tableSize - 1;
+    const float size = static_cast<float>(tableSize);
+
+    for (int k = 0; k < count; ++k) {
+        float phase = phases[k];
+        const float increment = increments[k];
+        const float gain = gains[k] * outputGain;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float position = phase * size;
+            const int index = static_cast<int>(position);
+            const float frac = position - static_cast<float>(index);
+            const float a = table[index & mask];
+            const float b = table[(index & mask) + 1];
+            output[i] += gain * (a + frac * (b - a));
+            phase += increment;
+            if (phase >= 1.0f) phase -= 1.0f;
+        }
+
+        phases[k] = phase;
+    }
+}
+
+const SimdKernels KERNELS = { SimdLevel::Scalar, "scalar", multiplyAdd, peak, sineBank };
+
+} // namespace
+
+const SimdKernels* getScalarKernels()
+{
+    return &KERNELS;
+}
+
+} // namespace Simd
+} // namespace DSP
@@ -0,0 +1,128 @@
+/*
+ * AllocationCounter.cpp
+ *
+ * Replacement global operator new / delete that count allocations
+ *
+ * Linked into nature-bench only. Every form of operator new funnels into
+ * countedAlloc(); the matching deletes release through the same allocator
+ * family (free / _aligned_free).
+ *
+ * Created: January 19, 2026
+ */
+
+#include "Benchmark.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<int64_t> allocationCount{0};
+
+void* countedAlloc(std::size_t size, std::size_t alignment) noexcept
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    size = size == 0 ? 1 : size;
+
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc requires a size that is a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void countedFree(void* pointer, std::size_t alignment) noexcept
+{
+#if defined(_WIN32)
+    if (alignment > alignof(std::max_align_t)) {
+        _aligned_free(pointer);
+        return;
+    }
+#else
+    (void)alignment;
+#endif
+    std::free(pointer);
+}
+
+void* allocOrThrow(std::size_t size, std::size_t alignment)
+{
+    void* pointer = countedAlloc(size, alignment);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+constexpr std::size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+} // namespace
+
+namespace DSP {
+namespace Bench {
+
+int64_t getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace Bench
+} // namespace DSP
+
+void* operator new(std::size_t size) { return allocOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size) { return allocOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, DEFAULT_ALIGNMENT); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size, DEFAULT_ALIGNMENT); }
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+void operator delete(void* pointer, std::size_t) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer, std::size_t) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { countedFree(pointer, DEFAULT_ALIGNMENT); }
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    countedFree(pointer, static_cast<std::size_t>(alignment));
+}
@@ -0,0 +1,384 @@
+/*
+ * Benchmark.cpp
+ *
+ * Measurement, JSON results and baseline comparison
+ *
+ * Created: January 19, 2026
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define NATURE_BENCH_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define NATURE_BENCH_HAS_TSC 0
+#endif
+
+namespace DSP {
+namespace Bench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int64_t MAX_RUNS_PER_BATCH = int64_t(1) << 24;
+
+double median(std::vector<double> values)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return (values.size() & 1) ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+double timeRuns(const RunFunction& run, int64_t count)
+{
+    const auto start = Clock::now();
+    for (int64_t i = 0; i < count; ++i) {
+        run();
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void writeEscaped(std::FILE* file, const std::string& text)
+{
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(c, file);
+    }
+}
+
+/**
+ * Minimal JSON reader for results files: walks any document and reports
+ * numbers found at results.<name>.<field>
+ */
+class ResultsReader
+{
+public:
+    explicit ResultsReader(const char* text) : p_(text) {}
+
+    bool read(std::map<std::string, BaselineEntry>& baseline)
+    {
+        baseline_ = &baseline;
+        return parseValue(0) && (skipSpace(), *p_ == '\0');
+    }
+
+private:
+    static constexpr int MAX_DEPTH = 64;
+
+    void skipSpace()
+    {
+        while (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r') {
+            ++p_;
+        }
+    }
+
+    bool parseString(std::string& out)
+    {
+        if (*p_ != '"') {
+            return false;
+        }
+        ++p_;
+        out.clear();
+        while (*p_ != '"') {
+            if (*p_ == '\0') {
+                return false;
+            }
+            if (*p_ == '\\' && p_[1] != '\0') {
+                ++p_;  // Keep the escaped character; \uXXXX is not needed here
+            }
+            out.push_back(*p_++);
+        }
+        ++p_;
+        return true;
+    }
+
+    bool parseValue(int depth)
+    {
+        skipSpace();
+        if (depth > MAX_DEPTH) {
+            return false;
+        }
+
+        if (*p_ == '{') {
+            ++p_;
+            skipSpace();
+            if (*p_ == '}') {
+                ++p_;
+                return true;
+            }
+            while (true) {
+                skipSpace();
+                std::string key;
+                if (!parseString(key)) {
+                    return false;
+                }
+                skipSpace();
+                if (*p_++ != ':') {
+                    return false;
+                }
+                if (depth < static_cast<int>(sizeof(path_) / sizeof(path_[0]))) {
+                    path_[depth] = key;
+                }
+                if (!parseValue(depth + 1)) {
+                    return false;
+                }
+                skipSpace();
+                if (*p_ == ',') {
+                    ++p_;
+                    continue;
+                }
+                if (*p_++ != '}') {
+                    return false;
+                }
+                return true;
+            }
+        }
+
+        if (*p_ == '[') {
+            ++p_;
+            skipSpace();
+            if (*p_ == ']') {
+                ++p_;
+                return true;
+            }
+            while (true) {
+                if (!parseValue(depth + 1)) {
+                    return false;
+                }
+                skipSpace();
+                if (*p_ == ',') {
+                    ++p_;
+                    continue;
+                }
+                return *p_++ == ']';
+            }
+        }
+
+        if (*p_ == '"') {
+            std::string ignored;
+            return parseString(ignored);
+        }
+
+        for (const char* literal : { "true", "false", "null" }) {
+            const size_t length = std::strlen(literal);
+            if (std::strncmp(p_, literal, length) == 0) {
+                p_ += length;
+                return true;
+            }
+        }
+
+        char* end = nullptr;
+        const double value = std::strtod(p_, &end);
+        if (end == p_) {
+            return false;
+        }
+        p_ = end;
+
+        // results.<name>.<field>
+        if (depth == 3 && path_[0] == "results") {
+            auto& entry = (*baseline_)[path_[1]];
+            if (path_[2] == "ns_per_sample") {
+                entry.nsPerSample = value;
+            } else if (path_[2] == "allocations_per_run") {
+                entry.allocationsPerRun = static_cast<int64_t>(value);
+            }
+        }
+        return true;
+    }
+
+    const char* p_;
+    std::string path_[3];
+    std::map<std::string, BaselineEntry>* baseline_ = nullptr;
+};
+
+} // namespace
+
+uint64_t readCycleCounter()
+{
+#if NATURE_BENCH_HAS_TSC
+    return static_cast<uint64_t>(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+const char* getCycleCounterName(const MeasureOptions& options)
+{
+#if NATURE_BENCH_HAS_TSC
+    (void)options;
+    return "tsc";
+#else
+    return options.ghz > 0.0 ? "estimated" : "none";
+#endif
+}
+
+BenchmarkResult measure(const Benchmark& benchmark, const MeasureOptions& options)
+{
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.voices = benchmark.voices;
+    result.blockSize = benchmark.blockSize;
+
+    const RunFunction run = benchmark.prepare();
+    if (!run || benchmark.samplesPerRun <= 0) {
+        return result;
+    }
+
+    // Warm caches, branch predictors and any lazily built state
+    const auto warmupEnd = Clock::now() + std::chrono::duration<double>(options.warmupSeconds);
+    do {
+        run();
+    } while (Clock::now() < warmupEnd);
+
+    // Grow the batch until it is long enough to time reliably
+    int64_t runsPerBatch = 1;
+    while (runsPerBatch < MAX_RUNS_PER_BATCH) {
+        const double seconds = timeRuns(run, runsPerBatch);
+        if (seconds >= options.minBatchSeconds) {
+            break;
+        }
+        const double scale = seconds > 0.0 ? options.minBatchSeconds / seconds : 16.0;
+        runsPerBatch = std::min(MAX_RUNS_PER_BATCH,
+                                std::max(runsPerBatch * 2, static_cast<int64_t>(std::ceil(runsPerBatch * scale * 1.1))));
+    }
+
+    const double samplesPerBatch = static_cast<double>(runsPerBatch) * static_cast<double>(benchmark.samplesPerRun);
+    const double voiceSamplesPerBatch = samplesPerBatch * std::max(1, benchmark.voices);
+
+    std::vector<double> nsPerSample, cyclesPerVoiceSample;
+    const int batches = std::max(1, options.batches);
+    for (int b = 0; b < batches; ++b) {
+        const int64_t allocationsBefore = getAllocationCount();
+        const uint64_t cyclesBefore = readCycleCounter();
+        const double seconds = timeRuns(run, runsPerBatch);
+        const uint64_t cyclesAfter = readCycleCounter();
+        const int64_t allocations = getAllocationCount() - allocationsBefore;
+
+        nsPerSample.push_back(seconds * 1.0e9 / samplesPerBatch);
+        if (cyclesAfter > cyclesBefore) {
+            cyclesPerVoiceSample.push_back(static_cast<double>(cyclesAfter - cyclesBefore) / voiceSamplesPerBatch);
+        } else if (options.ghz > 0.0) {
+            cyclesPerVoiceSample.push_back(seconds * 1.0e9 * options.ghz / voiceSamplesPerBatch);
+        }
+
+        result.allocations += allocations;
+        result.allocationsPerRun = std::max(result.allocationsPerRun, (allocations + runsPerBatch - 1) / runsPerBatch);
+    }
+
+    result.samples = static_cast<int64_t>(samplesPerBatch) * batches;
+    result.nsPerSample = median(nsPerSample);
+    result.cyclesPerVoiceSample = median(cyclesPerVoiceSample);
+    return result;
+}
+
+bool writeResults(const std::string& path, const std::vector<BenchmarkResult>& results,
+                  const MeasureOptions& options)
+{
+    std::FILE* file = path == "-" ? stdout : std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        return false;
+    }
+
+    std::fprintf(file, "{\n  \"format\": \"nature-bench\",\n  \"version\": 1,\n");
+    std::fprintf(file, "  \"cycle_counter\": \"%s\",\n  \"results\": {", getCycleCounterName(options));
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::fprintf(file, "%s\n    \"", i == 0 ? "" : ",");
+        writeEscaped(file, r.name);
+        std::fprintf(file,
+                     "\": {\"ns_per_sample\": %.6g, \"cycles_per_voice_sample\": %.6g, "
+                     "\"allocations\": %lld, \"allocations_per_run\": %lld, "
+                     "\"voices\": %d, \"block_size\": %d, \"samples\": %lld}",
+                     r.nsPerSample, r.cyclesPerVoiceSample,
+                     static_cast<long long>(r.allocations), static_cast<long long>(r.allocationsPerRun),
+                     r.voices, r.blockSize, static_cast<long long>(r.samples));
+    }
+    std::fprintf(file, "\n  }\n}\n");
+
+    const bool ok = std::ferror(file) == 0;
+    if (file != stdout) {
+        return std::fclose(file) == 0 && ok;
+    }
+    std::fflush(file);
+    return ok;
+}
+
+bool readBaseline(const std::string& path, std::map<std::string, BaselineEntry>& baseline, std::string& error)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::string text;
+    char buffer[65536];
+    size_t count = 0;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, count);
+    }
+    std::fclose(file);
+
+    ResultsReader reader(text.c_str());
+    if (!reader.read(baseline)) {
+        error = path + ": not a valid results file";
+        return false;
+    }
+    return true;
+}
+
+int compareWithBaseline(const std::vector<BenchmarkResult>& results,
+                        const std::map<std::string, BaselineEntry>& baseline, double tolerance, std::FILE* out)
+{
+    int regressions = 0;
+    std::fprintf(out, "\n%-56s %12s %12s %8s  %s\n", "benchmark", "baseline ns", "current ns", "change", "status");
+
+    for (const auto& r : results) {
+        const auto found = baseline.find(r.name);
+        if (found == baseline.end()) {
+            std::fprintf(out, "%-56s %12s %12.3f %8s  new\n", r.name.c_str(), "-", r.nsPerSample, "-");
+            continue;
+        }
+
+        const BaselineEntry& base = found->second;
+        const double change = base.nsPerSample > 0.0 ? r.nsPerSample / base.nsPerSample - 1.0 : 0.0;
+        const bool slower = change > tolerance;
+        const bool allocates = r.allocationsPerRun > base.allocationsPerRun;
+
+        const char* status = "ok";
+        if (slower && allocates) {
+            status = "REGRESSION (time, allocations)";
+        } else if (slower) {
+            status = "REGRESSION (time)";
+        } else if (allocates) {
+            status = "REGRESSION (allocations)";
+        } else if (change < -tolerance) {
+            status = "faster";
+        }
+        regressions += (slower || allocates) ? 1 : 0;
+
+        std::fprintf(out, "%-56s %12.3f %12.3f %+7.1f%%  %s\n", r.name.c_str(), base.nsPerSample, r.nsPerSample,
+                    change * 100.0, status);
+    }
+
+    std::fprintf(out, "%d regression(s) at %.0f%% tolerance\n", regressions, tolerance * 100.0);
+    return regressions;
+}
+
+} // namespace Bench
+} // namespace DSP
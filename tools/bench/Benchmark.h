@@ -0,0 +1,108 @@
+/*
+ * Benchmark.h
+ *
+ * Micro / macro benchmark harness for the pure DSP code
+ *
+ * - A benchmark is a prepare step (allocate, configure, warm state) that
+ *   returns a run step; only run steps are timed and allocation-counted
+ * - Each run renders samplesPerRun samples for `voices` voices, so results
+ *   are reported per sample (ns) and per voice-sample (cycles)
+ * - Runs are batched until a batch lasts at least minBatchSeconds, then
+ *   the median of several batches is kept (robust to the odd preemption)
+ * - Allocations are counted by the replacement global operator new in
+ *   AllocationCounter.cpp; anything above zero in a run step is a
+ *   real-time violation
+ * - Results are written as JSON and compared against a baseline file
+ *   produced by an earlier run (see main.cpp)
+ *
+ * Cycles come from the time-stamp counter on x86 (constant-rate reference
+ * cycles, not core clock cycles under turbo or throttling); elsewhere
+ * they are derived from ns and --ghz, or omitted.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace DSP {
+namespace Bench {
+
+using RunFunction = std::function<void()>;
+
+struct Benchmark
+{
+    std::string name;           // "micro/..." or "macro/...", unique
+    int voices = 1;             // Voices rendered by one run
+    int blockSize = 0;          // Informational (0: not block based)
+    int64_t samplesPerRun = 0;  // Samples per voice rendered by one run
+    std::function<RunFunction()> prepare;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    int voices = 1;
+    int blockSize = 0;
+    int64_t samples = 0;               // Samples per voice measured (all batches)
+    double nsPerSample = 0.0;          // Median batch
+    double cyclesPerVoiceSample = 0.0; // Median batch, 0 when unavailable
+    int64_t allocations = 0;           // Allocations during all measured runs
+    int64_t allocationsPerRun = 0;     // Worst batch, rounded up
+};
+
+struct MeasureOptions
+{
+    double minBatchSeconds = 0.05;
+    int batches = 5;
+    double warmupSeconds = 0.02;
+    double ghz = 0.0;           // Cycle estimate where no counter exists
+};
+
+/** @brief Allocation counter (AllocationCounter.cpp); counts every thread */
+int64_t getAllocationCount();
+
+/** @brief Raw cycle counter, 0 on platforms without one */
+uint64_t readCycleCounter();
+
+/** @brief Name of the cycle source written to the results ("tsc", "estimated", "none") */
+const char* getCycleCounterName(const MeasureOptions& options);
+
+/** @brief Prepare and measure one benchmark on the calling thread */
+BenchmarkResult measure(const Benchmark& benchmark, const MeasureOptions& options);
+
+/** @brief Write results as JSON ("-" for stdout) */
+bool writeResults(const std::string& path, const std::vector<BenchmarkResult>& results,
+                  const MeasureOptions& options);
+
+struct BaselineEntry
+{
+    double nsPerSample = 0.0;
+    int64_t allocationsPerRun = 0;
+};
+
+/** @brief Read a results file written by writeResults() */
+bool readBaseline(const std::string& path, std::map<std::string, BaselineEntry>& baseline, std::string& error);
+
+/**
+ * @brief Print a comparison against a baseline
+ * @param tolerance Allowed slowdown, e.g. 0.10 for 10%
+ * @return Number of regressions: slower than tolerance allows, or more
+ *         allocations per run than the baseline
+ */
+int compareWithBaseline(const std::vector<BenchmarkResult>& results,
+                        const std::map<std::string, BaselineEntry>& baseline, double tolerance, std::FILE* out);
+
+/** @brief Register every benchmark in this build */
+void addMicroBenchmarks(std::vector<Benchmark>& benchmarks);
+void addMacroBenchmarks(std::vector<Benchmark>& benchmarks, const std::string& presetsDirectory,
+                        int polyphony, const std::vector<int>& blockSizes, double sampleRate);
+
+} // namespace Bench
+} // namespace DSP
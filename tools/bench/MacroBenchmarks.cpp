@@ -0,0 +1,228 @@
+/*
+ * MacroBenchmarks.cpp
+ *
+ * Whole-engine scenarios at fixed polyphony and block sizes
+ *
+ * One run renders a one-second phrase: `polyphony` notes start together,
+ * are released at 0.75 s and ring out for the rest of the phrase, so
+ * attack, sustain and release cost are all in the average. Events go
+ * through the sample-accurate processWithEvents() path, as in a host.
+ *
+ * Every scenario also has a .../tail/... variant: notes are released after
+ * 0.25 s and the run is dominated by four seconds of release and reverb
+ * tail, where feedback state decays towards the subnormal range. A tail
+ * much slower than its phrase points at missing denormal protection.
+ *
+ * - macro/nature/...: NatureDSP, notes spread across all six categories
+ * - macro/<engine>/<preset>/...: every factory preset under
+ *   plugins/dsp/presets/{KaneMarco,Aether,String}; needs
+ *   NATURE_RENDER_PLUGIN_ENGINES (the Aether Giant presets belong to the
+ *   JUCE-side Giant instruments and are not covered)
+ *
+ * Created: January 19, 2026
+ */
+
+#include "Benchmark.h"
+#include "BatchRender.h"
+#include "dsp/ScheduledEventQueue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+
+namespace DSP {
+namespace Bench {
+
+namespace {
+
+constexpr int MAX_CHANNELS = 2;
+
+struct Phrase
+{
+    const char* suffix;     // Inserted after the scenario name
+    double seconds;         // Length of one run
+    double releaseSeconds;  // Note-offs
+};
+
+constexpr Phrase PHRASES[] = {
+    { "", 1.0, 0.75 },
+    { "/tail", 4.0, 0.25 },
+};
+
+// Note spread: C2..G#5 covers every Nature category and a playable range
+// for the others
+constexpr int LOWEST_NOTE = 36;
+constexpr int NOTE_SPAN = 44;
+
+struct PresetFolder
+{
+    const char* folder;
+    const char* engine;
+};
+
+constexpr PresetFolder PRESET_FOLDERS[] = {
+    { "KaneMarco", "kanemarco" },
+    { "Aether", "aether" },
+    { "String", "string" },
+};
+
+struct TimedEvent
+{
+    int64_t sample = 0;
+    ScheduledEvent event;
+};
+
+struct ScenarioState
+{
+    std::unique_ptr<InstrumentDSP> engine;
+    std::vector<TimedEvent> phrase;        // Sorted by sample
+    std::vector<ScheduledEvent> blockEvents;  // Reserved for the whole phrase
+    std::vector<float> audio;
+    float* outputs[MAX_CHANNELS] = {};
+    int blockSize = 0;
+    int64_t phraseFrames = 0;
+};
+
+bool readTextFile(const std::filesystem::path& path, std::string& text)
+{
+    std::FILE* file = std::fopen(path.string().c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char buffer[65536];
+    size_t count = 0;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, count);
+    }
+    std::fclose(file);
+    return true;
+}
+
+void addTimedEvent(ScenarioState& s, int64_t sample, uint8_t status, int note, int velocity)
+{
+    const uint8_t message[3] = { status, static_cast<uint8_t>(note), static_cast<uint8_t>(velocity) };
+    TimedEvent timed;
+    timed.sample = sample;
+    if (toScheduledEvent(message, 3, 0, timed.event)) {
+        s.phrase.push_back(timed);
+    }
+}
+
+/** Engine + preset + phrase; nullptr when the engine or preset is unavailable */
+std::shared_ptr<ScenarioState> prepareScenario(const std::string& engineName, const std::string& presetJson,
+                                               int polyphony, int blockSize, double sampleRate,
+                                               const Phrase& phrase)
+{
+    auto s = std::make_shared<ScenarioState>();
+    s->engine = Render::createEngine(engineName);
+    if (s->engine == nullptr || !s->engine->prepare(sampleRate, blockSize)) {
+        return nullptr;
+    }
+    if (!presetJson.empty() && !s->engine->loadPreset(presetJson.c_str())) {
+        return nullptr;
+    }
+
+    s->blockSize = blockSize;
+    const int64_t frames = static_cast<int64_t>(std::ceil(phrase.seconds * sampleRate));
+    s->phraseFrames = (frames + blockSize - 1) / blockSize * blockSize;
+
+    const int64_t releaseSample = static_cast<int64_t>(phrase.releaseSeconds * sampleRate);
+    for (int v = 0; v < polyphony; ++v) {
+        addTimedEvent(*s, 0, 0x90, LOWEST_NOTE + v * NOTE_SPAN / std::max(1, polyphony), 100);
+    }
+    for (int v = 0; v < polyphony; ++v) {
+        addTimedEvent(*s, releaseSample, 0x80, LOWEST_NOTE + v * NOTE_SPAN / std::max(1, polyphony), 0);
+    }
+    s->blockEvents.reserve(s->phrase.size());
+
+    s->audio.assign(static_cast<size_t>(blockSize) * MAX_CHANNELS, 0.0f);
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch) {
+        s->outputs[ch] = s->audio.data() + static_cast<size_t>(ch) * static_cast<size_t>(blockSize);
+    }
+    return s;
+}
+
+void renderPhrase(ScenarioState& s)
+{
+    size_t next = 0;
+    for (int64_t position = 0; position < s.phraseFrames; position += s.blockSize) {
+        s.blockEvents.clear();
+        while (next < s.phrase.size() && s.phrase[next].sample < position + s.blockSize) {
+            const TimedEvent& timed = s.phrase[next++];
+            s.blockEvents.push_back(timed.event);
+            s.blockEvents.back().sampleOffset = static_cast<uint32_t>(timed.sample - position);
+        }
+        processWithEvents<MAX_CHANNELS>(*s.engine, s.outputs, MAX_CHANNELS, s.blockSize,
+                                        s.blockEvents.data(), static_cast<int>(s.blockEvents.size()));
+    }
+}
+
+void addScenarios(std::vector<Benchmark>& benchmarks, const std::string& prefix, const std::string& engineName,
+                  const std::filesystem::path& presetPath, int polyphony,
+                  const std::vector<int>& blockSizes, double sampleRate)
+{
+    // Polyphony is clamped to what the engine can actually play
+    const auto probe = Render::createEngine(engineName);
+    if (probe == nullptr) {
+        return;
+    }
+    const int voices = std::clamp(polyphony, 1, std::max(1, probe->getMaxPolyphony()));
+
+    for (const Phrase& phrase : PHRASES) {
+        for (const int blockSize : blockSizes) {
+            Benchmark benchmark;
+            benchmark.name = prefix + phrase.suffix + "/poly" + std::to_string(voices)
+                           + "/block" + std::to_string(blockSize);
+            benchmark.voices = voices;
+            benchmark.blockSize = blockSize;
+            const int64_t frames = static_cast<int64_t>(std::ceil(phrase.seconds * sampleRate));
+            benchmark.samplesPerRun = (frames + blockSize - 1) / blockSize * blockSize;
+            benchmark.prepare = [=, &phrase]() -> RunFunction {
+                std::string preset;
+                if (!presetPath.empty() && !readTextFile(presetPath, preset)) {
+                    return {};
+                }
+                auto s = prepareScenario(engineName, preset, voices, blockSize, sampleRate, phrase);
+                if (s == nullptr) {
+                    return {};
+                }
+                return [s] { renderPhrase(*s); };
+            };
+            benchmarks.push_back(std::move(benchmark));
+        }
+    }
+}
+
+} // namespace
+
+void addMacroBenchmarks(std::vector<Benchmark>& benchmarks, const std::string& presetsDirectory,
+                        int polyphony, const std::vector<int>& blockSizes, double sampleRate)
+{
+    addScenarios(benchmarks, "macro/nature/default", "nature", {}, polyphony, blockSizes, sampleRate);
+
+    std::error_code error;
+    for (const auto& folder : PRESET_FOLDERS) {
+        const std::filesystem::path directory = std::filesystem::path(presetsDirectory) / folder.folder;
+        if (Render::createEngine(folder.engine) == nullptr || !std::filesystem::is_directory(directory, error)) {
+            continue;
+        }
+
+        std::vector<std::filesystem::path> presets;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            if (entry.is_regular_file(error) && entry.path().extension() == ".json") {
+                presets.push_back(entry.path());
+            }
+        }
+        std::sort(presets.begin(), presets.end());
+
+        for (const auto& preset : presets) {
+            addScenarios(benchmarks, std::string("macro/") + folder.engine + "/" + preset.stem().string(),
+                         folder.engine, preset, polyphony, blockSizes, sampleRate);
+        }
+    }
+}
+
+} // namespace Bench
+} // namespace DSP
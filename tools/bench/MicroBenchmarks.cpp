@@ -0,0 +1,587 @@
+/*
+ * MicroBenchmarks.cpp
+ *
+ * Building-block benchmarks: one 256-sample block per run
+ *
+ * - DelayLine (integer, fractional, modulated, block feedback loop)
+ * - FDNReverb (full and half rate)
+ * - Every Nature generator, every sound type
+ * - SIMD kernels: every variant this CPU can run, side by side
+ *   (micro/simd/<level>/...), whatever --simd selects for the engines
+ * - Denormal tails: a resonator ringing down through the subnormal range,
+ *   with and without ScopedFlushDenormals (tail/.../ftz vs .../no_ftz)
+ * - Shared function tables against the libm calls they replace
+ *   (tables/<function>/{shared,std})
+ * - With NATURE_RENDER_PLUGIN_ENGINES: Kane Marco Oscillator and
+ *   SVFFilter (including its tail), 16 Kane Marco voices per-voice and in
+ *   voice lanes (micro/kanemarco/voices/<shape>/{voice_major,lanes}),
+ *   Aether ModalFilter
+ *
+ * Inputs are fixed-seed noise so runs are comparable across builds.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "Benchmark.h"
+#include "dsp/DelayLine.h"
+#include "dsp/DenormalGuard.h"
+#include "dsp/FDNReverb.h"
+#include "dsp/NatureDSP_Pure.h"
+#include "dsp/SharedTables.h"
+#include "dsp/SimdKernels.h"
+
+#if NATURE_RENDER_PLUGIN_ENGINES
+#include "dsp/KaneMarcoPureDSP.h"
+#include "dsp/AetherPureDSP.h"
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace DSP {
+namespace Bench {
+
+namespace {
+
+constexpr int BLOCK = 256;
+constexpr double SAMPLE_RATE = 48000.0;
+constexpr float TWO_PI = 6.28318530718f;
+
+struct NoiseBlock
+{
+    alignas(32) float samples[BLOCK];
+
+    explicit NoiseBlock(uint32_t seed)
+    {
+        RandomState rng{seed};
+        for (float& sample : samples) {
+            sample = rng.nextFloat() * 2.0f - 1.0f;
+        }
+    }
+};
+
+Benchmark makeBenchmark(std::string name, std::function<RunFunction()> prepare)
+{
+    Benchmark benchmark;
+    benchmark.name = std::move(name);
+    benchmark.blockSize = BLOCK;
+    benchmark.samplesPerRun = BLOCK;
+    benchmark.prepare = std::move(prepare);
+    return benchmark;
+}
+
+//==============================================================================
+// DelayLine
+//==============================================================================
+
+struct DelayBenchState
+{
+    DelayLine delay;
+    NoiseBlock input{1u};
+    alignas(32) float output[BLOCK] = {};
+    float delays[BLOCK] = {};
+};
+
+void addDelayLineBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    enum class Mode { PerSample, Modulated, Block };
+    struct Variant { const char* name; float delay; Mode mode; };
+    const Variant variants[] = {
+        { "integer", 480.0f, Mode::PerSample },
+        { "fractional", 480.37f, Mode::PerSample },
+        { "fractional_modulated", 480.37f, Mode::Modulated },
+        { "fractional_block", 480.37f, Mode::Block },
+        { "integer_block", 480.0f, Mode::Block },
+    };
+
+    for (const auto& variant : variants) {
+        benchmarks.push_back(makeBenchmark(std::string("micro/delay_line/") + variant.name, [variant] {
+            auto s = std::make_shared<DelayBenchState>();
+            s->delay.prepare(4096);
+            s->delay.setDelay(variant.delay);
+            for (int i = 0; i < BLOCK; ++i) {
+                // Chorus-style sweep of +-3 samples over the block
+                s->delays[i] = variant.delay + 3.0f * std::sin(TWO_PI * static_cast<float>(i) / BLOCK);
+            }
+
+            return RunFunction([s, mode = variant.mode] {
+                DelayLine& delay = s->delay;
+                if (mode == Mode::Block) {
+                    // Feedback loop in chunks, as the waveguide strings run it
+                    const int chunk = std::min(BLOCK, delay.getMaxBlockLength());
+                    for (int done = 0; done < BLOCK; done += chunk) {
+                        const int n = std::min(chunk, BLOCK - done);
+                        float* out = s->output + done;
+                        delay.read(out, n);
+                        for (int i = 0; i < n; ++i) {
+                            out[i] = s->input.samples[done + i] + 0.5f * out[i];
+                        }
+                        delay.write(out, n);
+                    }
+                    return;
+                }
+
+                for (int i = 0; i < BLOCK; ++i) {
+                    if (mode == Mode::Modulated) {
+                        delay.setDelay(s->delays[i]);
+                    }
+                    const float y = delay.read();
+                    delay.write(s->input.samples[i] + 0.5f * y);
+                    s->output[i] = y;
+                }
+            });
+        }));
+    }
+}
+
+//==============================================================================
+// FDNReverb
+//==============================================================================
+
+struct ReverbBenchState
+{
+    FDNReverb reverb;
+    NoiseBlock inputL{2u};
+    NoiseBlock inputR{3u};
+    alignas(32) float left[BLOCK] = {};
+    alignas(32) float right[BLOCK] = {};
+};
+
+void addReverbBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    for (const bool halfRate : { false, true }) {
+        benchmarks.push_back(makeBenchmark(halfRate ? "micro/fdn_reverb/half_rate" : "micro/fdn_reverb/full_rate",
+                                           [halfRate] {
+            auto s = std::make_shared<ReverbBenchState>();
+            s->reverb.prepare(SAMPLE_RATE);
+            s->reverb.setHalfRate(halfRate);
+
+            return RunFunction([s] {
+                std::memcpy(s->left, s->inputL.samples, sizeof(s->left));
+                std::memcpy(s->right, s->inputR.samples, sizeof(s->right));
+                s->reverb.process(s->left, s->right, BLOCK, 0.3f, 0.7f, 0.4f);
+            });
+        }));
+    }
+}
+
+//==============================================================================
+// Nature generators
+//==============================================================================
+
+template <typename Synthesis>
+struct GeneratorBenchState
+{
+    RandomState rng;
+    Synthesis synthesis;
+    typename Synthesis::State state;
+    alignas(32) float left[BLOCK] = {};
+    alignas(32) float right[BLOCK] = {};
+};
+
+template <typename Synthesis>
+void addGenerator(std::vector<Benchmark>& benchmarks, const char* category,
+                  std::initializer_list<std::pair<typename Synthesis::SoundType, const char*>> soundTypes)
+{
+    for (const auto& [soundType, soundName] : soundTypes) {
+        const std::string name = std::string("micro/nature/") + category + "/" + soundName;
+        benchmarks.push_back(makeBenchmark(name, [soundType = soundType] {
+            auto s = std::make_shared<GeneratorBenchState<Synthesis>>();
+            s->synthesis.init(SAMPLE_RATE, s->rng);
+
+            return RunFunction([s, soundType] {
+                // Generators mix into the outputs
+                std::memset(s->left, 0, sizeof(s->left));
+                std::memset(s->right, 0, sizeof(s->right));
+                float* outputs[2] = { s->left, s->right };
+                s->synthesis.process(s->state, outputs, 2, BLOCK, soundType, 0.8f, 0.8f);
+            });
+        }));
+    }
+}
+
+void addNatureGeneratorBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    addGenerator<WaterSynthesis>(benchmarks, "water", {
+        { WaterSynthesis::Rain, "rain" }, { WaterSynthesis::Stream, "stream" },
+        { WaterSynthesis::Ocean, "ocean" }, { WaterSynthesis::Waterfall, "waterfall" },
+        { WaterSynthesis::Drips, "drips" } });
+    addGenerator<WindSynthesis>(benchmarks, "wind", {
+        { WindSynthesis::Breeze, "breeze" }, { WindSynthesis::Gusts, "gusts" },
+        { WindSynthesis::Whistle, "whistle" }, { WindSynthesis::Storm, "storm" } });
+    addGenerator<InsectSynthesis>(benchmarks, "insect", {
+        { InsectSynthesis::Cricket, "cricket" }, { InsectSynthesis::Cicada, "cicada" },
+        { InsectSynthesis::Bee, "bee" }, { InsectSynthesis::Fly, "fly" },
+        { InsectSynthesis::Mosquito, "mosquito" }, { InsectSynthesis::Swarm, "swarm" } });
+    addGenerator<BirdSynthesis>(benchmarks, "bird", {
+        { BirdSynthesis::Songbird, "songbird" }, { BirdSynthesis::Owl, "owl" },
+        { BirdSynthesis::Crow, "crow" }, { BirdSynthesis::Flock, "flock" } });
+    addGenerator<AmphibianSynthesis>(benchmarks, "amphibian", {
+        { AmphibianSynthesis::Frog, "frog" }, { AmphibianSynthesis::Toad, "toad" },
+        { AmphibianSynthesis::TreeFrog, "tree_frog" } });
+    addGenerator<MammalSynthesis>(benchmarks, "mammal", {
+        { MammalSynthesis::Wolf, "wolf" }, { MammalSynthesis::Coyote, "coyote" },
+        { MammalSynthesis::Deer, "deer" }, { MammalSynthesis::Fox, "fox" } });
+}
+
+//==============================================================================
+// SIMD kernels
+//==============================================================================
+
+struct SimdBenchState
+{
+    static constexpr int PARTIALS = 10;  // Nature swarm / flock size
+
+    NoiseBlock source{6u};
+    NoiseBlock gain{7u};
+    alignas(32) float output[BLOCK] = {};
+    float phases[PARTIALS] = {};
+    float increments[PARTIALS] = {};
+    float gains[PARTIALS] = {};
+    float sink = 0.0f;
+};
+
+void addSimdBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2,
+                                 SimdLevel::AVX512, SimdLevel::NEON };
+
+    for (const SimdLevel level : levels) {
+        // Only levels this CPU and build actually have (no duplicate fallbacks)
+        const SimdKernels& kernels = getSimdKernels(level);
+        if (kernels.level != level) {
+            continue;
+        }
+        const std::string prefix = std::string("micro/simd/") + kernels.name + "/";
+
+        benchmarks.push_back(makeBenchmark(prefix + "multiply_add", [&kernels] {
+            auto s = std::make_shared<SimdBenchState>();
+            return RunFunction([s, &kernels] {
+                kernels.multiplyAdd(s->output, s->source.samples, s->gain.samples, BLOCK);
+            });
+        }));
+
+        benchmarks.push_back(makeBenchmark(prefix + "peak", [&kernels] {
+            auto s = std::make_shared<SimdBenchState>();
+            return RunFunction([s, &kernels] { s->sink += kernels.peak(s->source.samples, BLOCK); });
+        }));
+
+        benchmarks.push_back(makeBenchmark(prefix + "sine_bank_10", [&kernels] {
+            auto s = std::make_shared<SimdBenchState>();
+            for (int k = 0; k < SimdBenchState::PARTIALS; ++k) {
+                s->increments[k] = (100.0f + 400.0f * static_cast<float>(k)) / static_cast<float>(SAMPLE_RATE);
+                s->phases[k] = 0.1f * static_cast<float>(k);
+                s->gains[k] = 1.0f;
+            }
+            return RunFunction([s, &kernels] {
+                std::memset(s->output, 0, sizeof(s->output));
+                kernels.sineBank(SineTable::get().data(), SineTable::SIZE, s->phases, s->increments,
+                                 s->gains, SimdBenchState::PARTIALS, 0.05f, s->output, BLOCK);
+            });
+        }));
+    }
+}
+
+//==============================================================================
+// Denormal tails
+//==============================================================================
+
+// Bottom of a ring-down: the state is re-seeded here every run so each run
+// measures the same stretch of subnormal arithmetic
+constexpr float SUBNORMAL_STATE = 1.0e-39f;
+
+const char* tailVariantName(bool flushToZero)
+{
+    return flushToZero ? "ftz" : "no_ftz";
+}
+
+template <typename Render>
+void renderTail(bool flushToZero, Render&& render)
+{
+    if (flushToZero) {
+        ScopedFlushDenormals noDenormals;
+        render();
+    } else {
+        render();
+    }
+}
+
+struct BandpassTailState
+{
+    FilterState state;
+    ResonatorCoefficients coefficients;
+    alignas(32) float silence[BLOCK] = {};
+    alignas(32) float output[BLOCK] = {};
+};
+
+void addTailBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    for (const bool flushToZero : { false, true }) {
+        const std::string name = std::string("micro/tail/bandpass/") + tailVariantName(flushToZero);
+        benchmarks.push_back(makeBenchmark(name, [flushToZero] {
+            auto s = std::make_shared<BandpassTailState>();
+            // High Q: the pole radius keeps the state subnormal for the whole block
+            s->coefficients = ResonatorCoefficients::bandpass(1000.0f, 50.0f, SAMPLE_RATE);
+
+            return RunFunction([s, flushToZero] {
+                s->state = { SUBNORMAL_STATE, -SUBNORMAL_STATE };
+                renderTail(flushToZero, [&] {
+                    processBandpassBlock(s->state, s->coefficients, s->silence, s->output, BLOCK);
+                });
+            });
+        }));
+    }
+}
+
+//==============================================================================
+// Shared function tables
+//==============================================================================
+
+struct TableBenchState
+{
+    NoiseBlock input{8u};
+    alignas(32) float output[BLOCK] = {};
+};
+
+void addTableBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    // Each input is [-1, 1) noise mapped onto the function's working range
+    struct Function
+    {
+        const char* name;
+        float (*shared)(float);
+        float (*standard)(float);
+    };
+    const Function functions[] = {
+        { "sin",
+          [](float x) { return SharedTables::get().sin(x * TWO_PI); },
+          [](float x) { return std::sin(x * TWO_PI); } },
+        { "sin_cycles",  // oscillator / LFO phase in cycles
+          [](float x) { return SineTable::get().lookupWrapped(x); },
+          [](float x) { return static_cast<float>(std::sin(x * 2.0 * M_PI)); } },
+        { "midi_to_hz",  // whole notes, as at note-on
+          [](float x) { return SharedTables::get().midiToFrequency(std::round(64.0f + x * 63.0f)); },
+          [](float x) { return static_cast<float>(440.0 * std::pow(2.0, (std::round(64.0f + x * 63.0f) - 69) / 12.0)); } },
+    };
+
+    for (const Function& function : functions) {
+        for (const bool shared : { true, false }) {
+            const std::string name = std::string("micro/tables/") + function.name + (shared ? "/shared" : "/std");
+            benchmarks.push_back(makeBenchmark(name, [evaluate = shared ? function.shared : function.standard] {
+                auto s = std::make_shared<TableBenchState>();
+                return RunFunction([s, evaluate] {
+                    for (int i = 0; i < BLOCK; ++i) {
+                        s->output[i] = evaluate(s->input.samples[i]);
+                    }
+                });
+            }));
+        }
+    }
+}
+
+#if NATURE_RENDER_PLUGIN_ENGINES
+//==============================================================================
+// Plugin engine building blocks
+//==============================================================================
+
+struct OscillatorBenchState
+{
+    Oscillator carrier;
+    Oscillator modulator;
+    alignas(32) float output[BLOCK] = {};
+};
+
+void addOscillatorBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    const char* waveforms[] = { "saw", "square", "triangle", "sine", "pulse" };
+    for (int w = 0; w < 5; ++w) {
+        benchmarks.push_back(makeBenchmark(std::string("micro/kanemarco/oscillator/") + waveforms[w], [w] {
+            auto s = std::make_shared<OscillatorBenchState>();
+            s->carrier.prepare(SAMPLE_RATE);
+            s->carrier.setWaveform(w);
+            s->carrier.setWarp(0.3f);
+            s->carrier.setFrequency(220.0f, SAMPLE_RATE);
+
+            return RunFunction([s] { s->carrier.processBlock(s->output, BLOCK); });
+        }));
+    }
+
+    benchmarks.push_back(makeBenchmark("micro/kanemarco/oscillator/fm", [] {
+        auto s = std::make_shared<OscillatorBenchState>();
+        s->carrier.prepare(SAMPLE_RATE);
+        s->carrier.setWaveform(3);
+        s->carrier.setIsFMCarrier(true);
+        s->carrier.setFMDepth(0.5f);
+        s->carrier.setFrequency(220.0f, SAMPLE_RATE);
+        s->modulator.prepare(SAMPLE_RATE);
+        s->modulator.setWaveform(3);
+        s->modulator.setFrequency(440.0f, SAMPLE_RATE);
+
+        return RunFunction([s] {
+            for (int i = 0; i < BLOCK; ++i) {
+                s->output[i] = s->carrier.processSampleWithFM(s->modulator.processSample());
+            }
+        });
+    }));
+}
+
+struct FilterBenchState
+{
+    SVFFilter filter;
+    NoiseBlock input{4u};
+    alignas(32) float buffer[BLOCK] = {};
+    bool rising = true;
+};
+
+void addFilterBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    struct Variant { const char* name; FilterType type; bool swept; };
+    const Variant variants[] = {
+        { "lowpass", FilterType::LOWPASS, false },
+        { "highpass", FilterType::HIGHPASS, false },
+        { "bandpass", FilterType::BANDPASS, false },
+        { "notch", FilterType::NOTCH, false },
+        { "lowpass_swept", FilterType::LOWPASS, true },
+    };
+
+    for (const auto& variant : variants) {
+        benchmarks.push_back(makeBenchmark(std::string("micro/kanemarco/svf/") + variant.name, [variant] {
+            auto s = std::make_shared<FilterBenchState>();
+            s->filter.prepare(SAMPLE_RATE);
+            s->filter.setType(variant.type);
+            s->filter.setCutoff(1200.0f);
+            s->filter.setResonance(0.6f);
+
+            return RunFunction([s, swept = variant.swept] {
+                std::memcpy(s->buffer, s->input.samples, sizeof(s->buffer));
+                if (swept) {
+                    // Envelope-style sweep, alternating direction each block
+                    s->filter.processBlock(s->buffer, BLOCK, s->rising ? 0.5f : 2.0f, s->rising ? 2.0f : 0.5f);
+                    s->rising = !s->rising;
+                } else {
+                    s->filter.processBlock(s->buffer, BLOCK);
+                }
+            });
+        }));
+    }
+
+    for (const bool flushToZero : { false, true }) {
+        const std::string name = std::string("micro/kanemarco/svf/tail/") + tailVariantName(flushToZero);
+        benchmarks.push_back(makeBenchmark(name, [flushToZero] {
+            auto s = std::make_shared<FilterBenchState>();
+            s->filter.prepare(SAMPLE_RATE);
+            s->filter.setType(FilterType::LOWPASS);
+            s->filter.setCutoff(200.0f);
+            s->filter.setResonance(0.6f);
+
+            return RunFunction([s, flushToZero] {
+                std::memset(s->buffer, 0, sizeof(s->buffer));
+                s->filter.setState(SUBNORMAL_STATE, -SUBNORMAL_STATE, 0.0f);
+                renderTail(flushToZero, [&] { s->filter.processBlock(s->buffer, BLOCK); });
+            });
+        }));
+    }
+}
+
+struct VoiceLaneBenchState
+{
+    static constexpr int NUM_VOICES = 16;
+    NaturePureDSP synth;
+    alignas(32) float left[BLOCK] = {};
+    alignas(32) float right[BLOCK] = {};
+};
+
+void addVoiceLaneBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    const char* waveforms[] = { "saw", "square", "triangle", "sine", "pulse" };
+    for (int w = 0; w < 5; ++w) {
+        for (const bool laneMode : { false, true }) {
+            const std::string name = std::string("micro/kanemarco/voices/") + waveforms[w]
+                                     + (laneMode ? "/lanes" : "/voice_major");
+            Benchmark benchmark = makeBenchmark(name, [w, laneMode] {
+                auto s = std::make_shared<VoiceLaneBenchState>();
+                s->synth.prepare(SAMPLE_RATE, BLOCK);
+                s->synth.setVoiceLaneMode(laneMode);
+                s->synth.setParameter("osc1_shape", static_cast<float>(w));
+                s->synth.setParameter("osc2_shape", static_cast<float>(w));
+
+                // Held notes: every run renders all voices at sustain
+                for (int v = 0; v < VoiceLaneBenchState::NUM_VOICES; ++v) {
+                    ScheduledEvent event{};
+                    event.type = ScheduledEvent::NOTE_ON;
+                    event.data.note.midiNote = 36 + v * 2;
+                    event.data.note.velocity = 0.8f;
+                    s->synth.handleEvent(event);
+                }
+
+                return RunFunction([s] {
+                    float* outputs[] = { s->left, s->right };
+                    s->synth.process(outputs, 2, BLOCK);
+                });
+            });
+            benchmark.voices = VoiceLaneBenchState::NUM_VOICES;
+            benchmarks.push_back(std::move(benchmark));
+        }
+    }
+}
+
+struct ModalBenchState
+{
+    static constexpr int MAX_MODES = 32;
+    ModalFilter modes[MAX_MODES];
+    NoiseBlock input{5u};
+    alignas(32) float output[BLOCK] = {};
+};
+
+void addModalBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    for (const int numModes : { 1, ModalBenchState::MAX_MODES }) {
+        const std::string name = numModes == 1 ? "micro/aether/modal_filter"
+                                               : "micro/aether/modal_filter_bank_" + std::to_string(numModes);
+        benchmarks.push_back(makeBenchmark(name, [numModes] {
+            auto s = std::make_shared<ModalBenchState>();
+            for (int m = 0; m < numModes; ++m) {
+                ModalFilter& mode = s->modes[m];
+                mode.frequency = 110.0f * static_cast<float>(m + 1);
+                mode.modeIndex = static_cast<float>(m);
+                mode.decay = 1.5f;
+                mode.prepare(SAMPLE_RATE);
+            }
+
+            return RunFunction([s, numModes] {
+                for (int i = 0; i < BLOCK; ++i) {
+                    const float excitation = s->input.samples[i] * 0.1f;
+                    float sum = 0.0f;
+                    for (int m = 0; m < numModes; ++m) {
+                        sum += s->modes[m].processSample(excitation);
+                    }
+                    s->output[i] = sum;
+                }
+            });
+        }));
+    }
+}
+#endif
+
+} // namespace
+
+void addMicroBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    addDelayLineBenchmarks(benchmarks);
+    addReverbBenchmarks(benchmarks);
+    addNatureGeneratorBenchmarks(benchmarks);
+    addSimdBenchmarks(benchmarks);
+    addTailBenchmarks(benchmarks);
+    addTableBenchmarks(benchmarks);
+#if NATURE_RENDER_PLUGIN_ENGINES
+    addOscillatorBenchmarks(benchmarks);
+    addFilterBenchmarks(benchmarks);
+    addVoiceLaneBenchmarks(benchmarks);
+    addModalBenchmarks(benchmarks);
+#endif
+}
+
+} // namespace Bench
+} // namespace DSP
@@ -0,0 +1,231 @@
+/*
+ * main.cpp
+ *
+ * nature-bench: micro / macro benchmarks with baseline comparison
+ *
+ *   nature-bench --json results.json               record
+ *   nature-bench --baseline results.json           compare (exit 1 on regression)
+ *   nature-bench --filter micro/nature --list      see what would run
+ *
+ * Created: January 19, 2026
+ */
+
+#include "Benchmark.h"
+#include "dsp/SimdKernels.h"
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef NATURE_BENCH_PRESETS_DIR
+#define NATURE_BENCH_PRESETS_DIR "plugins/dsp/presets"
+#endif
+
+using namespace DSP::Bench;
+
+namespace {
+
+void printUsage()
+{
+    std::printf(
+        "usage: nature-bench [options]\n"
+        "\n"
+        "selection:\n"
+        "  --filter TEXT       only benchmarks whose name contains TEXT (repeatable)\n"
+        "  --micro | --macro   only one layer\n"
+        "  --list              print benchmark names and exit\n"
+        "\n"
+        "macro scenarios:\n"
+        "  --presets DIR       factory preset root (default %s)\n"
+        "  --polyphony N       notes per phrase (default 8)\n"
+        "  --blocks A,B,...    block sizes (default 64,512)\n"
+        "  --rate HZ           sample rate (default 48000)\n"
+        "  --simd LEVEL        cap the engines' kernels: scalar, sse2, avx2, avx512, neon\n"
+        "\n"
+        "measurement:\n"
+        "  --min-time SECONDS  shortest timed batch (default 0.05)\n"
+        "  --batches N         timed batches, median reported (default 5)\n"
+        "  --ghz GHZ           estimate cycles where there is no cycle counter\n"
+        "\n"
+        "output:\n"
+        "  --json FILE         write results as JSON ('-' for stdout)\n"
+        "  --baseline FILE     compare against an earlier --json file\n"
+        "  --tolerance PCT     allowed slowdown before failing (default 10)\n",
+        NATURE_BENCH_PRESETS_DIR);
+}
+
+bool parseBlockSizes(const std::string& text, std::vector<int>& blockSizes)
+{
+    blockSizes.clear();
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const int blockSize = std::atoi(item.c_str());
+        if (blockSize <= 0) {
+            return false;
+        }
+        blockSizes.push_back(blockSize);
+    }
+    return !blockSizes.empty();
+}
+
+bool matches(const std::string& name, const std::vector<std::string>& filters)
+{
+    if (filters.empty()) {
+        return true;
+    }
+    for (const auto& filter : filters) {
+        if (name.find(filter) != std::string::npos) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    MeasureOptions options;
+    std::vector<std::string> filters;
+    std::string presetsDirectory = NATURE_BENCH_PRESETS_DIR;
+    std::string jsonPath, baselinePath;
+    std::vector<int> blockSizes = { 64, 512 };
+    double sampleRate = 48000.0;
+    double tolerance = 0.10;
+    int polyphony = 8;
+    bool list = false, micro = true, macro = true;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (option == "--list") {
+            list = true;
+            continue;
+        }
+        if (option == "--micro" || option == "--macro") {
+            micro = option == "--micro";
+            macro = !micro;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "nature-bench: missing value for %s\n", option.c_str());
+            return 2;
+        }
+        const std::string value = argv[++i];
+
+        if (option == "--filter") {
+            filters.push_back(value);
+        } else if (option == "--presets") {
+            presetsDirectory = value;
+        } else if (option == "--polyphony") {
+            polyphony = std::atoi(value.c_str());
+        } else if (option == "--blocks") {
+            if (!parseBlockSizes(value, blockSizes)) {
+                std::fprintf(stderr, "nature-bench: bad --blocks '%s'\n", value.c_str());
+                return 2;
+            }
+        } else if (option == "--simd") {
+            DSP::SimdLevel level;
+            if (!DSP::parseSimdLevel(value.c_str(), level)) {
+                std::fprintf(stderr, "nature-bench: bad --simd '%s'\n", value.c_str());
+                return 2;
+            }
+            DSP::setSimdLevelOverride(level);
+        } else if (option == "--rate") {
+            sampleRate = std::atof(value.c_str());
+        } else if (option == "--min-time") {
+            options.minBatchSeconds = std::atof(value.c_str());
+        } else if (option == "--batches") {
+            options.batches = std::atoi(value.c_str());
+        } else if (option == "--ghz") {
+            options.ghz = std::atof(value.c_str());
+        } else if (option == "--json") {
+            jsonPath = value;
+        } else if (option == "--baseline") {
+            baselinePath = value;
+        } else if (option == "--tolerance") {
+            tolerance = std::atof(value.c_str()) / 100.0;
+        } else {
+            std::fprintf(stderr, "nature-bench: unknown option %s\n", option.c_str());
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (sampleRate <= 0.0 || polyphony < 1 || options.batches < 1 || tolerance < 0.0) {
+        std::fprintf(stderr, "nature-bench: bad --rate, --polyphony, --batches or --tolerance\n");
+        return 2;
+    }
+
+    // Read the baseline first so a bad path fails before a long run
+    std::map<std::string, BaselineEntry> baseline;
+    if (!baselinePath.empty()) {
+        std::string error;
+        if (!readBaseline(baselinePath, baseline, error)) {
+            std::fprintf(stderr, "nature-bench: %s\n", error.c_str());
+            return 2;
+        }
+    }
+
+    std::vector<Benchmark> benchmarks;
+    if (micro) {
+        addMicroBenchmarks(benchmarks);
+    }
+    if (macro) {
+        addMacroBenchmarks(benchmarks, presetsDirectory, polyphony, blockSizes, sampleRate);
+    }
+
+    std::vector<Benchmark> selected;
+    for (auto& benchmark : benchmarks) {
+        if (matches(benchmark.name, filters)) {
+            selected.push_back(std::move(benchmark));
+        }
+    }
+
+    if (list) {
+        for (const auto& benchmark : selected) {
+            std::printf("%s\n", benchmark.name.c_str());
+        }
+        return 0;
+    }
+
+    // Progress goes to stderr when the JSON goes to stdout
+    std::FILE* log = jsonPath == "-" ? stderr : stdout;
+    std::fprintf(log, "engine kernels: %s (cpu: %s)\n", DSP::selectSimdKernels().name,
+                 DSP::getSimdLevelName(DSP::detectSimdLevel()));
+    std::fprintf(log, "%-56s %12s %14s %8s\n", "benchmark", "ns/sample", "cycles/voice", "allocs");
+
+    std::vector<BenchmarkResult> results;
+    int skipped = 0;
+    for (const auto& benchmark : selected) {
+        BenchmarkResult result = measure(benchmark, options);
+        if (result.samples == 0) {
+            std::fprintf(log, "%-56s %12s\n", benchmark.name.c_str(), "skipped");
+            ++skipped;
+            continue;
+        }
+        std::fprintf(log, "%-56s %12.3f %14.2f %8lld%s\n", result.name.c_str(), result.nsPerSample,
+                     result.cyclesPerVoiceSample, static_cast<long long>(result.allocationsPerRun),
+                     result.allocationsPerRun > 0 ? "  (allocates on the audio path)" : "");
+        std::fflush(log);
+        results.push_back(std::move(result));
+    }
+    if (skipped > 0) {
+        std::fprintf(log, "%d benchmark(s) skipped (engine or preset failed to load)\n", skipped);
+    }
+
+    if (!jsonPath.empty() && !writeResults(jsonPath, results, options)) {
+        std::fprintf(stderr, "nature-bench: cannot write %s\n", jsonPath.c_str());
+        return 2;
+    }
+
+    if (!baselinePath.empty()) {
+        return compareWithBaseline(results, baseline, tolerance, log) == 0 ? 0 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * main.cpp
+ *
+ * nature-preset-compile: JSON presets -> compiled binary presets
+ *
+ *   nature-preset-compile --engine NAME --out FILE in.json
+ *   nature-preset-compile --engine NAME --out-dir DIR in.json [in.json...]
+ *
+ * Each preset is compiled against the engine's ParameterRegistry and
+ * written in the PresetFormat.h binary layout, ready for the engine's
+ * loadBinaryPreset(). With --out-dir every input becomes DIR/<name>.nprb.
+ * The build runs this over the shipped factory presets
+ * (nature_binary_presets target).
+ *
+ * Only engines with a ParameterRegistry have an index space to compile
+ * against: "nature" always, "kanemarco" in builds with the plugin engines.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "dsp/NatureDSP_Pure.h"
+
+#if NATURE_RENDER_PLUGIN_ENGINES
+#include "dsp/KaneMarcoPureDSP.h"
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/** Compile json for Engine; false (with error) if no parameter matched */
+template <typename Engine>
+bool compileFor(const std::string& json, std::vector<uint8_t>& binary, std::string& error)
+{
+    typename Engine::Preset preset;
+    if (Engine::compilePreset(json.c_str(), preset) == 0) {
+        error = "no parameters of this engine found";
+        return false;
+    }
+
+    binary.resize(preset.binarySize());
+    if (preset.writeBinary(binary.data(), binary.size(), Engine::PARAMETERS.layoutHash()) != binary.size()) {
+        error = "binary encoding failed";
+        return false;
+    }
+    return true;
+}
+
+struct EngineCompiler
+{
+    const char* name;
+    bool (*compile)(const std::string& json, std::vector<uint8_t>& binary, std::string& error);
+};
+
+const EngineCompiler ENGINES[] = {
+    { "nature", compileFor<DSP::NatureDSP> },
+#if NATURE_RENDER_PLUGIN_ENGINES
+    { "kanemarco", compileFor<DSP::NaturePureDSP> },
+#endif
+};
+
+const EngineCompiler* findEngine(const std::string& name)
+{
+    for (const auto& engine : ENGINES) {
+        if (name == engine.name) {
+            return &engine;
+        }
+    }
+    return nullptr;
+}
+
+void printUsage()
+{
+    std::printf(
+        "usage: nature-preset-compile --engine NAME --out FILE in.json\n"
+        "       nature-preset-compile --engine NAME --out-dir DIR in.json [in.json...]\n"
+        "\n"
+        "engines:");
+    for (const auto& engine : ENGINES) {
+        std::printf(" %s", engine.name);
+    }
+    std::printf("\n");
+}
+
+bool readText(const std::string& path, std::string& text)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    text = stream.str();
+    return true;
+}
+
+bool writeBytes(const std::string& path, const std::vector<uint8_t>& bytes)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string engineName;
+    std::string outPath;
+    std::string outDir;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (option == "--engine" || option == "--out" || option == "--out-dir") {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "nature-preset-compile: missing value for %s\n", option.c_str());
+                return 2;
+            }
+            const std::string value = argv[++i];
+            if (option == "--engine") {
+                engineName = value;
+            } else if (option == "--out") {
+                outPath = value;
+            } else {
+                outDir = value;
+            }
+        } else if (option.rfind("--", 0) == 0) {
+            std::fprintf(stderr, "nature-preset-compile: unknown option %s\n", option.c_str());
+            printUsage();
+            return 2;
+        } else {
+            inputs.push_back(option);
+        }
+    }
+
+    const EngineCompiler* engine = findEngine(engineName);
+    if (engine == nullptr) {
+        std::fprintf(stderr, "nature-preset-compile: unknown engine '%s'\n", engineName.c_str());
+        printUsage();
+        return 2;
+    }
+    if (inputs.empty() || outPath.empty() == outDir.empty() || (!outPath.empty() && inputs.size() != 1)) {
+        std::fprintf(stderr, "nature-preset-compile: give --out with one input or --out-dir with any number\n");
+        return 2;
+    }
+
+    if (!outDir.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(outDir, error);
+        if (error) {
+            std::fprintf(stderr, "nature-preset-compile: cannot create %s\n", outDir.c_str());
+            return 1;
+        }
+    }
+
+    int failures = 0;
+    for (const auto& input : inputs) {
+        const std::string output = outPath.empty()
+            ? (std::filesystem::path(outDir) / std::filesystem::path(input).stem()).string() + ".nprb"
+            : outPath;
+
+        std::string json;
+        std::vector<uint8_t> binary;
+        std::string error;
+        if (!readText(input, json)) {
+            error = "cannot read";
+        } else if (engine->compile(json, binary, error) && !writeBytes(output, binary)) {
+            error = "cannot write " + output;
+        }
+
+        if (!error.empty()) {
+            std::fprintf(stderr, "nature-preset-compile: %s: %s\n", input.c_str(), error.c_str());
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+/*
+ * AudioFileWriter.cpp
+ *
+ * Streaming WAV / raw writer for offline rendering
+ *
+ * Created: January 19, 2026
+ */
+
+#include "AudioFileWriter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace DSP {
+namespace Render {
+
+namespace {
+
+constexpr uint16_t WAVE_FORMAT_PCM = 1;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 3;
+constexpr long WAV_HEADER_SIZE = 44;
+constexpr int64_t WAV_MAX_DATA_BYTES = 0xFFFFFFFFll - WAV_HEADER_SIZE;
+
+void putLittleEndian(uint8_t* out, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+int32_t toPcm(float sample, float scale, int32_t maximum)
+{
+    const float scaled = std::nearbyint(std::clamp(sample, -1.0f, 1.0f) * scale);
+    return std::clamp(static_cast<int32_t>(scaled), -maximum - 1, maximum);
+}
+
+} // namespace
+
+bool AudioFileWriter::open(const std::string& path, OutputFormat format, int numChannels, double sampleRate)
+{
+    close();
+
+    format_ = format;
+    numChannels_ = std::max(1, numChannels);
+    sampleRate_ = sampleRate;
+    framesWritten_ = 0;
+    failed_ = false;
+    error_.clear();
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (file_ == nullptr) {
+        error_ = "cannot create " + path;
+        failed_ = true;
+        return false;
+    }
+
+    buffer_.assign(static_cast<size_t>(BUFFER_FRAMES) * static_cast<size_t>(numChannels_)
+                   * static_cast<size_t>(bytesPerSample()), 0);
+    bufferedBytes_ = 0;
+
+    // Placeholder sizes, patched in close()
+    return format_ == OutputFormat::RawFloat32 || writeHeader();
+}
+
+int AudioFileWriter::bytesPerSample() const
+{
+    switch (format_) {
+        case OutputFormat::WavPcm16: return 2;
+        case OutputFormat::WavPcm24: return 3;
+        case OutputFormat::WavFloat32:
+        case OutputFormat::RawFloat32: return 4;
+    }
+    return 4;
+}
+
+bool AudioFileWriter::write(const float* const* channels, int numFrames)
+{
+    if (file_ == nullptr || failed_) {
+        return false;
+    }
+
+    const int sampleBytes = bytesPerSample();
+    const size_t frameBytes = static_cast<size_t>(sampleBytes) * static_cast<size_t>(numChannels_);
+
+    if (format_ != OutputFormat::RawFloat32) {
+        const int64_t dataBytes = (framesWritten_ + numFrames) * static_cast<int64_t>(frameBytes);
+        if (dataBytes > WAV_MAX_DATA_BYTES) {
+            error_ = "WAV output exceeds 4 GB; use raw output for renders this long";
+            failed_ = true;
+            return false;
+        }
+    }
+
+    for (int frame = 0; frame < numFrames; ++frame) {
+        if (bufferedBytes_ + frameBytes > buffer_.size() && !flush()) {
+            return false;
+        }
+
+        uint8_t* out = buffer_.data() + bufferedBytes_;
+        for (int ch = 0; ch < numChannels_; ++ch) {
+            const float sample = channels[ch][frame];
+            switch (format_) {
+                case OutputFormat::WavPcm16:
+                    putLittleEndian(out, static_cast<uint32_t>(toPcm(sample, 32767.0f, 32767)), 2);
+                    break;
+                case OutputFormat::WavPcm24:
+                    putLittleEndian(out, static_cast<uint32_t>(toPcm(sample, 8388607.0f, 8388607)), 3);
+                    break;
+                case OutputFormat::WavFloat32:
+                case OutputFormat::RawFloat32:
+                    std::memcpy(out, &sample, sizeof(float));
+                    break;
+            }
+            out += sampleBytes;
+        }
+        bufferedBytes_ += frameBytes;
+    }
+
+    framesWritten_ += numFrames;
+    return true;
+}
+
+bool AudioFileWriter::flush()
+{
+    if (bufferedBytes_ > 0 && std::fwrite(buffer_.data(), 1, bufferedBytes_, file_) != bufferedBytes_) {
+        error_ = "write failed (disk full?)";
+        failed_ = true;
+    }
+    bufferedBytes_ = 0;
+    return !failed_;
+}
+
+bool AudioFileWriter::writeHeader()
+{
+    const uint16_t formatTag = format_ == OutputFormat::WavFloat32 ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM;
+    const uint32_t sampleBytes = static_cast<uint32_t>(bytesPerSample());
+    const uint32_t blockAlign = sampleBytes * static_cast<uint32_t>(numChannels_);
+    const uint32_t rate = static_cast<uint32_t>(std::lround(sampleRate_));
+    const uint32_t dataBytes = static_cast<uint32_t>(framesWritten_ * blockAlign);
+
+    uint8_t header[WAV_HEADER_SIZE];
+    std::memcpy(header, "RIFF", 4);
+    putLittleEndian(header + 4, 36 + dataBytes, 4);
+    std::memcpy(header + 8, "WAVEfmt ", 8);
+    putLittleEndian(header + 16, 16, 4);
+    putLittleEndian(header + 20, formatTag, 2);
+    putLittleEndian(header + 22, static_cast<uint32_t>(numChannels_), 2);
+    putLittleEndian(header + 24, rate, 4);
+    putLittleEndian(header + 28, rate * blockAlign, 4);
+    putLittleEndian(header + 32, blockAlign, 2);
+    putLittleEndian(header + 34, sampleBytes * 8, 2);
+    std::memcpy(header + 36, "data", 4);
+    putLittleEndian(header + 40, dataBytes, 4);
+
+    if (std::fwrite(header, 1, sizeof(header), file_) != sizeof(header)) {
+        error_ = "write failed";
+        failed_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool AudioFileWriter::close()
+{
+    if (file_ == nullptr) {
+        return !failed_;
+    }
+
+    flush();
+
+    if (!failed_ && format_ != OutputFormat::RawFloat32) {
+        if (std::fseek(file_, 0, SEEK_SET) != 0 || !writeHeader()) {
+            error_ = "cannot finalize WAV header";
+            failed_ = true;
+        }
+    }
+
+    if (std::fclose(file_) != 0 && !failed_) {
+        error_ = "close failed";
+        failed_ = true;
+    }
+    file_ = nullptr;
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    return !failed_;
+}
+
+} // namespace Render
+} // namespace DSP
@@ -0,0 +1,67 @@
+/*
+ * AudioFileWriter.h
+ *
+ * Streaming WAV / raw writer for offline rendering
+ *
+ * - Constant memory: blocks are interleaved into one fixed buffer and
+ *   flushed, so an hour-long render needs no more RAM than a short one
+ * - WAV header sizes are patched on close(); formats are 16/24-bit PCM
+ *   (clipped, undithered) or 32-bit float
+ * - Raw output is headerless interleaved float32 in native byte order
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace DSP {
+namespace Render {
+
+enum class OutputFormat { WavFloat32, WavPcm16, WavPcm24, RawFloat32 };
+
+class AudioFileWriter
+{
+public:
+    static constexpr int BUFFER_FRAMES = 16384;
+
+    AudioFileWriter() = default;
+    ~AudioFileWriter() { close(); }
+
+    AudioFileWriter(const AudioFileWriter&) = delete;
+    AudioFileWriter& operator=(const AudioFileWriter&) = delete;
+
+    bool open(const std::string& path, OutputFormat format, int numChannels, double sampleRate);
+
+    /** @brief Append numFrames of planar audio (one pointer per channel) */
+    bool write(const float* const* channels, int numFrames);
+
+    /** @brief Flush, patch the header and close; false if any write failed */
+    bool close();
+
+    int64_t getFramesWritten() const { return framesWritten_; }
+    const std::string& getError() const { return error_; }
+
+private:
+    bool flush();
+    bool writeHeader();
+    int bytesPerSample() const;
+
+    std::FILE* file_ = nullptr;
+    OutputFormat format_ = OutputFormat::WavFloat32;
+    int numChannels_ = 0;
+    double sampleRate_ = 48000.0;
+    int64_t framesWritten_ = 0;
+    bool failed_ = false;
+    std::string error_;
+
+    std::vector<uint8_t> buffer_;  // BUFFER_FRAMES interleaved frames
+    size_t bufferedBytes_ = 0;
+};
+
+} // namespace Render
+} // namespace DSP
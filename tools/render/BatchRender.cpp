@@ -0,0 +1,207 @@
+/*
+ * BatchRender.cpp
+ *
+ * Headless, faster-than-real-time rendering of the pure DSP engines
+ *
+ * Created: January 19, 2026
+ */
+
+#include "BatchRender.h"
+#include "MidiFile.h"
+#include "dsp/NatureDSP_Pure.h"
+#include "dsp/ScheduledEventQueue.h"
+
+#if NATURE_RENDER_PLUGIN_ENGINES
+#include "dsp/KaneMarcoPureDSP.h"
+#include "dsp/AetherPureDSP.h"
+#include "dsp/StringPureDSP.h"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+namespace DSP {
+namespace Render {
+
+namespace {
+
+constexpr int MAX_CHANNELS = 2;
+
+bool readTextFile(const std::string& path, std::string& text)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char buffer[65536];
+    size_t count = 0;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, count);
+    }
+    std::fclose(file);
+    return true;
+}
+
+} // namespace
+
+std::unique_ptr<InstrumentDSP> createEngine(const std::string& name)
+{
+    if (name == "nature") {
+        return std::make_unique<NatureDSP>();
+    }
+#if NATURE_RENDER_PLUGIN_ENGINES
+    if (name == "kanemarco") {
+        return std::make_unique<NaturePureDSP>();
+    }
+    if (name == "aether") {
+        return std::make_unique<AetherPureDSP>();
+    }
+    if (name == "string") {
+        return std::make_unique<StringPureDSP>();
+    }
+#endif
+    return nullptr;
+}
+
+std::vector<std::string> getEngineNames()
+{
+#if NATURE_RENDER_PLUGIN_ENGINES
+    return { "nature", "kanemarco", "aether", "string" };
+#else
+    return { "nature" };
+#endif
+}
+
+RenderResult renderJob(const RenderJob& job)
+{
+    RenderResult result;
+    const auto start = std::chrono::steady_clock::now();
+
+    auto engine = createEngine(job.engine);
+    if (engine == nullptr) {
+        result.error = "unknown engine '" + job.engine + "'";
+        return result;
+    }
+
+    MidiFile midi;
+    if (!midi.load(job.midiPath, result.error)) {
+        result.error = job.midiPath + ": " + result.error;
+        return result;
+    }
+
+    const int blockSize = std::max(1, job.blockSize);
+    const int numChannels = std::clamp(job.numChannels, 1, MAX_CHANNELS);
+    if (!engine->prepare(job.sampleRate, blockSize)) {
+        result.error = "engine failed to prepare";
+        return result;
+    }
+
+    if (!job.presetPath.empty()) {
+        std::string preset;
+        if (!readTextFile(job.presetPath, preset)) {
+            result.error = "cannot read preset " + job.presetPath;
+            return result;
+        }
+        if (!engine->loadPreset(preset.c_str())) {
+            result.error = "engine rejected preset " + job.presetPath;
+            return result;
+        }
+    }
+
+    AudioFileWriter writer;
+    if (!writer.open(job.outputPath, job.format, numChannels, job.sampleRate)) {
+        result.error = writer.getError();
+        return result;
+    }
+
+    const int64_t totalFrames = static_cast<int64_t>(
+        std::ceil((midi.lengthSeconds + std::max(0.0, job.tailSeconds)) * job.sampleRate));
+
+    std::vector<float> audio(static_cast<size_t>(blockSize) * static_cast<size_t>(numChannels));
+    float* outputs[MAX_CHANNELS] = {};
+    for (int ch = 0; ch < numChannels; ++ch) {
+        outputs[ch] = audio.data() + static_cast<size_t>(ch) * static_cast<size_t>(blockSize);
+    }
+
+    // Events for one block, offsets relative to the block start
+    std::vector<ScheduledEvent> blockEvents;
+    size_t nextEvent = 0;
+
+    for (int64_t position = 0; position < totalFrames; position += blockSize) {
+        const int n = static_cast<int>(std::min<int64_t>(blockSize, totalFrames - position));
+
+        blockEvents.clear();
+        while (nextEvent < midi.events.size()) {
+            const auto& event = midi.events[nextEvent];
+            const int64_t sample = static_cast<int64_t>(std::llround(event.seconds * job.sampleRate));
+            if (sample >= position + n) {
+                break;
+            }
+
+            ScheduledEvent scheduled;
+            const uint32_t offset = static_cast<uint32_t>(std::max<int64_t>(0, sample - position));
+            if (toScheduledEvent(event.data, event.size, offset, scheduled)) {
+                blockEvents.push_back(scheduled);
+            }
+            ++nextEvent;
+        }
+
+        processWithEvents<MAX_CHANNELS>(*engine, outputs, numChannels, n,
+                                        blockEvents.data(), static_cast<int>(blockEvents.size()));
+
+        if (!writer.write(outputs, n)) {
+            result.error = writer.getError();
+            return result;
+        }
+    }
+
+    if (!writer.close()) {
+        result.error = writer.getError();
+        return result;
+    }
+
+    result.ok = true;
+    result.frames = writer.getFramesWritten();
+    result.renderSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::vector<RenderResult> renderJobs(const std::vector<RenderJob>& jobs, int numThreads)
+{
+    std::vector<RenderResult> results(jobs.size());
+    if (jobs.empty()) {
+        return results;
+    }
+
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    numThreads = std::min(numThreads, static_cast<int>(jobs.size()));
+
+    // Each thread takes the next unrendered job until none are left
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next.fetch_add(1); i < jobs.size(); i = next.fetch_add(1)) {
+            results[i] = renderJob(jobs[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(numThreads - 1));
+    for (int t = 1; t < numThreads; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return results;
+}
+
+} // namespace Render
+} // namespace DSP
@@ -0,0 +1,75 @@
+/*
+ * BatchRender.h
+ *
+ * Headless, faster-than-real-time rendering of the pure DSP engines
+ *
+ * - One job = engine + MIDI file + optional preset -> audio file
+ * - Engines are prepared for large blocks (default 4096), so no scratch
+ *   chunking happens; MIDI is fed straight into the sample-accurate event
+ *   path, bypassing the bounded per-block host queues, and parameters are
+ *   set directly rather than through the host parameter exchange
+ * - Output streams to disk through AudioFileWriter (constant memory)
+ * - renderJobs() runs independent jobs on a fixed set of threads, one
+ *   engine instance per job
+ *
+ * Engines: "nature" (NatureDSP) always; "kanemarco", "aether" and "string"
+ * when built with NATURE_RENDER_PLUGIN_ENGINES.
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include "AudioFileWriter.h"
+#include "dsp/InstrumentDSP.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace DSP {
+namespace Render {
+
+struct RenderJob
+{
+    std::string engine = "nature";
+    std::string midiPath;
+    std::string presetPath;     // JSON preset; empty keeps the engine defaults
+    std::string outputPath;
+    OutputFormat format = OutputFormat::WavFloat32;
+    double sampleRate = 48000.0;
+    int blockSize = 4096;
+    int numChannels = 2;
+    double tailSeconds = 2.0;   // Rendered after the last MIDI event
+};
+
+struct RenderResult
+{
+    bool ok = false;
+    std::string error;
+    int64_t frames = 0;
+    double renderSeconds = 0.0;  // Wall-clock time spent rendering
+
+    double getRealtimeFactor(double sampleRate) const
+    {
+        return renderSeconds > 0.0 ? static_cast<double>(frames) / sampleRate / renderSeconds : 0.0;
+    }
+};
+
+/** @brief Engine by name (see header notes), or nullptr if unknown / not built */
+std::unique_ptr<InstrumentDSP> createEngine(const std::string& name);
+
+/** @brief Names accepted by createEngine() in this build */
+std::vector<std::string> getEngineNames();
+
+/** @brief Render one job on the calling thread */
+RenderResult renderJob(const RenderJob& job);
+
+/**
+ * @brief Render every job, numThreads at a time (<= 0: hardware threads)
+ * @return One result per job, in job order
+ */
+std::vector<RenderResult> renderJobs(const std::vector<RenderJob>& jobs, int numThreads);
+
+} // namespace Render
+} // namespace DSP
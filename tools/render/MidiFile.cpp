@@ -0,0 +1,269 @@
+/*
+ * MidiFile.cpp
+ *
+ * Standard MIDI File reader for offline rendering
+ *
+ * Created: January 19, 2026
+ */
+
+#include "MidiFile.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace DSP {
+namespace Render {
+
+namespace {
+
+struct Reader {
+    const uint8_t* data;
+    size_t size;
+    size_t position = 0;
+
+    bool has(size_t count) const { return position + count <= size; }
+
+    uint32_t readBigEndian(int bytes)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value = (value << 8) | data[position++];
+        }
+        return value;
+    }
+
+    bool readVariableLength(uint32_t& value)
+    {
+        value = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (!has(1)) {
+                return false;
+            }
+            const uint8_t byte = data[position++];
+            value = (value << 7) | (byte & 0x7F);
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Parsed before the tempo map is applied
+struct TickEvent {
+    uint64_t tick;
+    uint32_t order;      // File order, keeps simultaneous events stable
+    uint32_t tempo;      // Microseconds per quarter note; 0 for channel events
+    uint8_t data[3];
+    uint8_t size;
+};
+
+int channelMessageLength(uint8_t status)
+{
+    const uint8_t type = status & 0xF0;
+    return (type == 0xC0 || type == 0xD0) ? 2 : 3;
+}
+
+bool parseTrack(Reader& track, std::vector<TickEvent>& events, uint32_t& order,
+                uint64_t& endTick, std::string& error)
+{
+    uint64_t tick = 0;
+    uint8_t runningStatus = 0;
+
+    while (track.has(1)) {
+        uint32_t delta = 0;
+        if (!track.readVariableLength(delta) || !track.has(1)) {
+            error = "truncated track event";
+            return false;
+        }
+        tick += delta;
+
+        uint8_t status = track.data[track.position];
+        if (status & 0x80) {
+            ++track.position;
+        } else if (runningStatus != 0) {
+            status = runningStatus;
+        } else {
+            error = "data byte without running status";
+            return false;
+        }
+
+        if (status == 0xFF) {
+            // Meta event
+            if (!track.has(1)) {
+                error = "truncated meta event";
+                return false;
+            }
+            const uint8_t type = track.data[track.position++];
+            uint32_t length = 0;
+            if (!track.readVariableLength(length) || !track.has(length)) {
+                error = "truncated meta event";
+                return false;
+            }
+            if (type == 0x51 && length == 3) {
+                TickEvent tempo{ tick, order++, track.readBigEndian(3), {}, 0 };
+                events.push_back(tempo);
+            } else {
+                track.position += length;
+            }
+            runningStatus = 0;
+            if (type == 0x2F) {
+                break;  // End of track
+            }
+            continue;
+        }
+
+        if (status == 0xF0 || status == 0xF7) {
+            // SysEx: skipped
+            uint32_t length = 0;
+            if (!track.readVariableLength(length) || !track.has(length)) {
+                error = "truncated SysEx event";
+                return false;
+            }
+            track.position += length;
+            runningStatus = 0;
+            continue;
+        }
+
+        if (status >= 0xF0) {
+            error = "unexpected system message in track";
+            return false;
+        }
+
+        const int length = channelMessageLength(status);
+        if (!track.has(static_cast<size_t>(length - 1))) {
+            error = "truncated channel message";
+            return false;
+        }
+
+        TickEvent event{ tick, order++, 0, { status, 0, 0 }, static_cast<uint8_t>(length) };
+        for (int i = 1; i < length; ++i) {
+            event.data[i] = track.data[track.position++] & 0x7F;
+        }
+        events.push_back(event);
+        runningStatus = status;
+    }
+
+    endTick = std::max(endTick, tick);
+    return true;
+}
+
+} // namespace
+
+bool MidiFile::load(const std::string& path, std::string& error)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[65536];
+    size_t count = 0;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + count);
+    }
+    std::fclose(file);
+
+    return parse(bytes.data(), bytes.size(), error);
+}
+
+bool MidiFile::parse(const uint8_t* data, size_t size, std::string& error)
+{
+    events.clear();
+    lengthSeconds = 0.0;
+
+    Reader reader{ data, size };
+    if (!reader.has(14) || std::equal(data, data + 4, "MThd") == false) {
+        error = "not a Standard MIDI File";
+        return false;
+    }
+    reader.position = 4;
+    const uint32_t headerLength = reader.readBigEndian(4);
+    if (headerLength < 6 || !reader.has(headerLength)) {
+        error = "bad MIDI header";
+        return false;
+    }
+    const uint32_t format = reader.readBigEndian(2);
+    const uint32_t numTracks = reader.readBigEndian(2);
+    const uint32_t division = reader.readBigEndian(2);
+    reader.position += headerLength - 6;
+
+    if (format > 1) {
+        error = "MIDI format 2 is not supported";
+        return false;
+    }
+    if (division == 0) {
+        error = "bad MIDI time division";
+        return false;
+    }
+
+    // SMPTE: negative frames per second in the high byte, ticks per frame low
+    const bool smpte = (division & 0x8000) != 0;
+    const int framesPerSecond = smpte ? -static_cast<int>(static_cast<int8_t>(division >> 8)) : 0;
+    const int ticksPerFrame = smpte ? static_cast<int>(division & 0xFF) : 0;
+    if (smpte && (framesPerSecond <= 0 || ticksPerFrame == 0)) {
+        error = "bad SMPTE time division";
+        return false;
+    }
+
+    std::vector<TickEvent> tickEvents;
+    uint32_t order = 0;
+    uint64_t endTick = 0;
+
+    for (uint32_t t = 0; t < numTracks && reader.has(8); ++t) {
+        const bool isTrack = std::equal(data + reader.position, data + reader.position + 4, "MTrk");
+        reader.position += 4;
+        const uint32_t length = reader.readBigEndian(4);
+        if (!reader.has(length)) {
+            error = "truncated track";
+            return false;
+        }
+        if (isTrack) {
+            Reader track{ data + reader.position, length };
+            if (!parseTrack(track, tickEvents, order, endTick, error)) {
+                return false;
+            }
+        }
+        reader.position += length;  // Unknown chunks are skipped
+    }
+
+    std::stable_sort(tickEvents.begin(), tickEvents.end(), [](const TickEvent& a, const TickEvent& b) {
+        return a.tick < b.tick;
+    });
+
+    // Tempo map: seconds advance at the tempo in force since the last change
+    const double smpteSecondsPerTick = smpte
+        ? 1.0 / (static_cast<double>(framesPerSecond) * static_cast<double>(ticksPerFrame))
+        : 0.0;
+    const double ticksPerQuarter = static_cast<double>(division & 0x7FFF);
+
+    double secondsPerTick = smpte ? smpteSecondsPerTick : 0.5 / ticksPerQuarter;  // 120 BPM default
+    double seconds = 0.0;
+    uint64_t lastTick = 0;
+
+    events.reserve(tickEvents.size());
+    for (const auto& tickEvent : tickEvents) {
+        seconds += static_cast<double>(tickEvent.tick - lastTick) * secondsPerTick;
+        lastTick = tickEvent.tick;
+
+        if (tickEvent.size == 0) {
+            if (!smpte && tickEvent.tempo > 0) {
+                secondsPerTick = static_cast<double>(tickEvent.tempo) * 1.0e-6 / ticksPerQuarter;
+            }
+            continue;
+        }
+
+        Event event;
+        event.seconds = seconds;
+        std::copy(tickEvent.data, tickEvent.data + 3, event.data);
+        event.size = tickEvent.size;
+        events.push_back(event);
+    }
+
+    lengthSeconds = seconds + static_cast<double>(endTick - std::min(endTick, lastTick)) * secondsPerTick;
+    return true;
+}
+
+} // namespace Render
+} // namespace DSP
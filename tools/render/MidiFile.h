@@ -0,0 +1,46 @@
+/*
+ * MidiFile.h
+ *
+ * Standard MIDI File reader for offline rendering
+ *
+ * - Formats 0 and 1; all tracks are merged into one time-ordered list
+ * - The tempo map (meta 0x51, any track) and SMPTE divisions are resolved,
+ *   so every event carries its time in seconds
+ * - Only channel messages are kept; meta and SysEx events are skipped
+ *
+ * Created: January 19, 2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DSP {
+namespace Render {
+
+struct MidiFile
+{
+    struct Event
+    {
+        double seconds = 0.0;
+        uint8_t data[3] = {};
+        uint8_t size = 0;
+    };
+
+    std::vector<Event> events;  // Sorted by time; simultaneous events keep file order
+    double lengthSeconds = 0.0; // Time of the last event (including end of track)
+
+    /**
+     * @brief Parse the file at path
+     * @return false with error set if the file can't be read or is malformed
+     */
+    bool load(const std::string& path, std::string& error);
+
+    /** @brief Parse an in-memory file */
+    bool parse(const uint8_t* data, size_t size, std::string& error);
+};
+
+} // namespace Render
+} // namespace DSP
@@ -0,0 +1,216 @@
+/*
+ * main.cpp
+ *
+ * nature-render: headless batch rendering from the command line
+ *
+ *   nature-render --midi in.mid --out out.wav [job options]
+ *   nature-render --jobs jobs.txt [--threads N]
+ *
+ * A jobs file holds one job per line using the same job options; blank
+ * lines and lines starting with '#' are ignored. Options given on the
+ * command line are defaults for every line.
+ *
+ * Created: January 19, 2026
+ */
+
+#include "BatchRender.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace DSP::Render;
+
+namespace {
+
+void printUsage()
+{
+    std::printf(
+        "usage: nature-render --midi FILE --out FILE [options]\n"
+        "       nature-render --jobs FILE [options]\n"
+        "\n"
+        "job options:\n"
+        "  --engine NAME     engine to render (default nature)\n"
+        "  --preset FILE     JSON preset to load\n"
+        "  --format FORMAT   wav (float32), wav16, wav24 or raw (float32)\n"
+        "  --rate HZ         sample rate (default 48000)\n"
+        "  --block N         render block size (default 4096)\n"
+        "  --channels N      1 or 2 (default 2)\n"
+        "  --tail SECONDS    render time after the last event (default 2)\n"
+        "\n"
+        "batch options:\n"
+        "  --jobs FILE       one job per line, using the job options\n"
+        "  --threads N       jobs rendered at once (default: all cores)\n"
+        "\n"
+        "engines:");
+    for (const auto& name : getEngineNames()) {
+        std::printf(" %s", name.c_str());
+    }
+    std::printf("\n");
+}
+
+bool parseFormat(const std::string& text, OutputFormat& format)
+{
+    if (text == "wav") { format = OutputFormat::WavFloat32; return true; }
+    if (text == "wav16") { format = OutputFormat::WavPcm16; return true; }
+    if (text == "wav24") { format = OutputFormat::WavPcm24; return true; }
+    if (text == "raw") { format = OutputFormat::RawFloat32; return true; }
+    return false;
+}
+
+/** Apply one job option; false if option isn't one */
+bool applyJobOption(const std::string& option, const std::string& value, RenderJob& job, std::string& error)
+{
+    if (option == "--engine") {
+        job.engine = value;
+    } else if (option == "--midi") {
+        job.midiPath = value;
+    } else if (option == "--preset") {
+        job.presetPath = value;
+    } else if (option == "--out") {
+        job.outputPath = value;
+    } else if (option == "--format") {
+        if (!parseFormat(value, job.format)) {
+            error = "unknown format '" + value + "'";
+        }
+    } else if (option == "--rate") {
+        job.sampleRate = std::atof(value.c_str());
+    } else if (option == "--block") {
+        job.blockSize = std::atoi(value.c_str());
+    } else if (option == "--channels") {
+        job.numChannels = std::atoi(value.c_str());
+    } else if (option == "--tail") {
+        job.tailSeconds = std::atof(value.c_str());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parseJobLine(const std::string& line, const RenderJob& defaults, RenderJob& job, std::string& error)
+{
+    job = defaults;
+    std::istringstream stream(line);
+    std::string option, value;
+    while (stream >> option) {
+        if (!(stream >> value)) {
+            error = "missing value for " + option;
+            return false;
+        }
+        if (!applyJobOption(option, value, job, error)) {
+            error = "unknown job option " + option;
+            return false;
+        }
+        if (!error.empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool validate(const RenderJob& job, std::string& error)
+{
+    if (job.midiPath.empty() || job.outputPath.empty()) {
+        error = "every job needs --midi and --out";
+        return false;
+    }
+    if (job.sampleRate <= 0.0 || job.blockSize <= 0 || job.numChannels < 1 || job.numChannels > 2) {
+        error = "bad --rate, --block or --channels";
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    RenderJob defaults;
+    std::string jobsPath;
+    int numThreads = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::fprintf(stderr, "nature-render: missing value for %s\n", option.c_str());
+            return 2;
+        }
+        const std::string value = argv[++i];
+
+        std::string error;
+        if (option == "--jobs") {
+            jobsPath = value;
+        } else if (option == "--threads") {
+            numThreads = std::atoi(value.c_str());
+        } else if (!applyJobOption(option, value, defaults, error)) {
+            std::fprintf(stderr, "nature-render: unknown option %s\n", option.c_str());
+            printUsage();
+            return 2;
+        }
+        if (!error.empty()) {
+            std::fprintf(stderr, "nature-render: %s\n", error.c_str());
+            return 2;
+        }
+    }
+
+    std::vector<RenderJob> jobs;
+    if (jobsPath.empty()) {
+        jobs.push_back(defaults);
+    } else {
+        std::ifstream file(jobsPath);
+        if (!file) {
+            std::fprintf(stderr, "nature-render: cannot open %s\n", jobsPath.c_str());
+            return 2;
+        }
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            if (line.find_first_not_of(" \t\r") == std::string::npos || line[line.find_first_not_of(" \t")] == '#') {
+                continue;
+            }
+            RenderJob job;
+            std::string error;
+            if (!parseJobLine(line, defaults, job, error)) {
+                std::fprintf(stderr, "nature-render: %s:%d: %s\n", jobsPath.c_str(), lineNumber, error.c_str());
+                return 2;
+            }
+            jobs.push_back(job);
+        }
+    }
+
+    for (const auto& job : jobs) {
+        std::string error;
+        if (!validate(job, error)) {
+            std::fprintf(stderr, "nature-render: %s\n", error.c_str());
+            return 2;
+        }
+    }
+
+    const auto results = renderJobs(jobs, numThreads);
+
+    int failures = 0;
+    double audioSeconds = 0.0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        const auto& job = jobs[i];
+        if (result.ok) {
+            audioSeconds += static_cast<double>(result.frames) / job.sampleRate;
+            std::printf("%s: %.1f s audio in %.2f s (%.0fx real time)\n", job.outputPath.c_str(),
+                        static_cast<double>(result.frames) / job.sampleRate, result.renderSeconds,
+                        result.getRealtimeFactor(job.sampleRate));
+        } else {
+            ++failures;
+            std::fprintf(stderr, "%s: FAILED: %s\n", job.outputPath.c_str(), result.error.c_str());
+        }
+    }
+
+    std::printf("%zu job(s), %d failed, %.1f s audio rendered\n", jobs.size(), failures, audioSeconds);
+    return failures == 0 ? 0 : 1;
+}